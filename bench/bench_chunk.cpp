@@ -0,0 +1,200 @@
+// Chunk meshing throughput on terrain-like chunks. Built once per chunk size (bench_chunk_16/32/64)
+// and once with the tiled layout (bench_chunk_32_tiled), since the mesher is compiled for one layout.
+//   chunk size: meshing the same 128 x 64 x 128 voxel patch, chunk / draw / vertex counts
+//   layout:     linear vs tiled voxel order for a generator-style fill and random Get
+//   mesher:     block registry lookups (MeshChunk) vs the literal-ID baseline it replaced
+
+#include <vector>
+#include <cmath>
+#include <random>
+
+#include "mesher.h"
+#include "bench_common.h"
+#if GOOSE_CHUNK_SIZE <= 32
+#include "baseline_mesher.h"
+#endif
+
+// Rolling hills with a few grass/dirt/stone layers, a water level and scattered glass, sampled in
+// world voxel coordinates so every chunk size cuts the same landscape.
+static uint8_t TerrainBlock(int wx, int wy, int wz) {
+    int height = 40 + (int)(6.0f * std::sin(wx * 0.11f) + 5.0f * std::cos(wz * 0.07f) + 3.0f * std::sin((wx + wz) * 0.23f));
+    if (wy > height) {
+        if (wy <= 38) return Block::WATER;
+        return ((wx * 7 + wz * 13 + wy * 3) % 97 == 0) ? Block::GLASS : Block::AIR;
+    }
+    if (wy == height) return Block::GRASS;
+    if (wy > height - 4) return Block::DIRT;
+    return Block::STONE;
+}
+
+template <typename ChunkType>
+static void FillTerrainChunk(ChunkType& chunk, int chunkX, int chunkY, int chunkZ) {
+    for (int y = 0; y < CHUNK_SIZE_PADDED; y++)
+        for (int z = 0; z < CHUNK_SIZE_PADDED; z++)
+            for (int x = 0; x < CHUNK_SIZE_PADDED; x++) {
+                chunk.Set(x, y, z, TerrainBlock(chunkX * CHUNK_SIZE + x - PADDING,
+                                                chunkY * CHUNK_SIZE + y - PADDING,
+                                                chunkZ * CHUNK_SIZE + z - PADDING));
+            }
+}
+
+struct MeshScratch {
+    LinearAllocator<PackedVertex> opaque{ 1u << 22 };
+    LinearAllocator<PackedVertex> trans{ 1u << 20 };
+    void Reset() { opaque.Reset(); trans.Reset(); }
+    uint64_t Hash() const {
+        return BenchHash((const uint32_t*)opaque.Data(), opaque.Count()) ^ (BenchHash((const uint32_t*)trans.Data(), trans.Count()) * 31);
+    }
+};
+
+constexpr int PATCH_WIDTH = 128;   // Voxels along X and Z
+constexpr int PATCH_HEIGHT = 64;   // Voxels along Y, the hills cross it
+
+// Every chunk of the patch, whatever the chunk size
+static std::vector<Chunk*> MakePatchChunks() {
+    std::vector<Chunk*> chunks;
+    for (int cy = 0; cy < PATCH_HEIGHT / CHUNK_SIZE; cy++)
+        for (int cz = 0; cz < PATCH_WIDTH / CHUNK_SIZE; cz++)
+            for (int cx = 0; cx < PATCH_WIDTH / CHUNK_SIZE; cx++) {
+                Chunk* chunk = new Chunk();
+                FillTerrainChunk(*chunk, cx, cy, cz);
+                chunks.push_back(chunk);
+            }
+    return chunks;
+}
+
+static void BenchChunkSize(const std::vector<Chunk*>& chunks) {
+    BenchHeader("Chunk size: whole 128 x 64 x 128 patch");
+    MeshScratch scratch;
+    size_t vertices = 0, draws = 0;
+    double total = BenchBestUs(5, 2, [&]() {
+        vertices = 0;
+        draws = 0;
+        for (const Chunk* chunk : chunks) {
+            scratch.Reset();
+            MeshChunk(*chunk, scratch.opaque, scratch.trans);
+            vertices += scratch.opaque.Count() + scratch.trans.Count();
+            draws += (scratch.opaque.Count() > 0) + (scratch.trans.Count() > 0);
+        }
+        g_benchSink = g_benchSink + vertices;
+    });
+    char note[96];
+    std::snprintf(note, sizeof(note), "%.2f ns/voxel", total * 1000.0 / ((double)PATCH_WIDTH * PATCH_WIDTH * PATCH_HEIGHT));
+    BenchLine("mesh the patch", total, note);
+    std::printf("  %zu chunks (map entries), %zu draw commands, %zu vertices\n", chunks.size(), draws, vertices);
+
+    // What a view distance costs in tracked chunks at this size (LOD 0 ring, 256 voxels up)
+    for (int radius : { 256, 512, 1024 }) {
+        long long perAxis = 2LL * ((radius + CHUNK_SIZE - 1) / CHUNK_SIZE) + 1;
+        std::printf("  view radius %4d voxels: %lld chunks in the ring\n", radius, perAxis * perAxis * (256 / CHUNK_SIZE));
+    }
+}
+
+static void BenchMesher(const std::vector<Chunk*>& chunks) {
+    BenchHeader("Mesher: registry lookups vs literal-ID baseline");
+    MeshScratch scratch;
+    size_t vertices = 0;
+    double current = BenchBestUs(5, 4, [&]() {
+        vertices = 0;
+        for (const Chunk* chunk : chunks) {
+            scratch.Reset();
+            MeshChunk(*chunk, scratch.opaque, scratch.trans);
+            vertices += scratch.opaque.Count() + scratch.trans.Count();
+            g_benchSink = g_benchSink + scratch.opaque.Count();
+        }
+    }) / chunks.size();
+    char note[96];
+    std::snprintf(note, sizeof(note), "per chunk (%zu chunks, %zu vertices)", chunks.size(), vertices);
+    BenchLine("MeshChunk (block registry)", current, note);
+
+#if GOOSE_CHUNK_SIZE <= 32
+    double baseline = BenchBestUs(5, 4, [&]() {
+        for (const Chunk* chunk : chunks) {
+            scratch.Reset();
+            BaselineMesher::MeshChunk(*chunk, scratch.opaque, scratch.trans);
+            g_benchSink = g_benchSink + scratch.opaque.Count();
+        }
+    }) / chunks.size();
+    BenchLine("BaselineMesher::MeshChunk (literal IDs)", baseline, "per chunk");
+
+    // Same meshes, or the comparison means nothing
+    size_t mismatches = 0;
+    MeshScratch reference;
+    for (const Chunk* chunk : chunks) {
+        scratch.Reset();
+        reference.Reset();
+        MeshChunk(*chunk, scratch.opaque, scratch.trans);
+        BaselineMesher::MeshChunk(*chunk, reference.opaque, reference.trans);
+        if (scratch.opaque.Count() != reference.opaque.Count() || scratch.trans.Count() != reference.trans.Count() ||
+            scratch.Hash() != reference.Hash()) mismatches++;
+    }
+    std::printf("  output: %s\n", mismatches == 0 ? "identical" : "DIFFERENT");
+#else
+    std::printf("  (baseline needs CHUNK_SIZE <= 32)\n");
+#endif
+}
+
+template <typename Layout>
+static void BenchLayoutAccess(const char* name, const std::vector<int>& queries) {
+    auto* chunk = new ChunkT<Layout>();
+    char label[64];
+
+    // Terrain sampled up front, so the loop is the generators' store pattern and not the noise
+    std::vector<uint8_t> source;
+    for (int y = 0; y < CHUNK_SIZE_PADDED; y++)
+        for (int z = 0; z < CHUNK_SIZE_PADDED; z++)
+            for (int x = 0; x < CHUNK_SIZE_PADDED; x++) source.push_back(TerrainBlock(x, y + 24, z));
+
+    std::snprintf(label, sizeof(label), "%s: generator fill (y, z, x order)", name);
+    double fill = BenchBestUs(5, 50, [&]() {
+        const uint8_t* src = source.data();
+        for (int y = 0; y < CHUNK_SIZE_PADDED; y++)
+            for (int z = 0; z < CHUNK_SIZE_PADDED; z++)
+                for (int x = 0; x < CHUNK_SIZE_PADDED; x++) chunk->Set(x, y, z, *src++);
+        g_benchSink = g_benchSink + chunk->voxels[7];
+    });
+    BenchLine(label, fill, "per chunk");
+
+    std::snprintf(label, sizeof(label), "%s: random Get", name);
+    double get = BenchBestUs(5, 1, [&]() {
+        uint32_t sum = 0;
+        for (int q : queries) {
+            sum += chunk->Get(1 + (q % CHUNK_SIZE), 1 + ((q / CHUNK_SIZE) % CHUNK_SIZE), 1 + ((q / (CHUNK_SIZE * CHUNK_SIZE)) % CHUNK_SIZE));
+        }
+        g_benchSink = g_benchSink + sum;
+    });
+    char note[64];
+    std::snprintf(note, sizeof(note), "%.2f ns per Get", get * 1000.0 / queries.size());
+    BenchLine(label, get, note);
+    delete chunk;
+}
+
+static void BenchLayout(const std::vector<Chunk*>& chunks) {
+    BenchHeader("Voxel layout: linear vs tiled 4x4x4 bricks");
+    std::mt19937 rng(1234);
+    std::vector<int> queries(1 << 20);
+    for (int& q : queries) q = (int)(rng() & 0x7FFFFFFF);
+    BenchLayoutAccess<LinearLayout>("linear", queries);
+    BenchLayoutAccess<TiledLayout>("tiled", queries);
+
+    // The mesher only exists for this build's layout, compare against the other build's line
+    MeshScratch scratch;
+    double mesh = BenchBestUs(5, 2, [&]() {
+        for (const Chunk* chunk : chunks) {
+            scratch.Reset();
+            MeshChunk(*chunk, scratch.opaque, scratch.trans);
+            g_benchSink = g_benchSink + scratch.opaque.Count();
+        }
+    }) / chunks.size();
+    BenchLine(ChunkLayout::IS_LINEAR ? "linear: MeshChunk (this build)" : "tiled: MeshChunk (this build)", mesh, "per chunk");
+}
+
+int main() {
+    std::printf("bench_chunk: CHUNK_SIZE %d, layout %s\n", CHUNK_SIZE, ChunkLayout::IS_LINEAR ? "linear" : "tiled");
+    std::vector<Chunk*> chunks = MakePatchChunks();
+    BenchChunkSize(chunks);
+    BenchLayout(chunks);
+    BenchMesher(chunks);
+    for (Chunk* chunk : chunks) delete chunk;
+    return 0;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <algorithm>
+
+// ================================================================================================
+//                                      BENCH HELPERS
+// Benchmarks are plain executables (bench/CMakeLists.txt, GOOSE_BUILD_BENCH), run by hand:
+//   cmake --build build --target bench_chunk_32 && ./build/bench/bench_chunk_32
+// Each case runs a few rounds and reports the best one (least disturbed by the OS), per iteration.
+// Results feed g_benchSink so the optimizer can't drop the work.
+// ================================================================================================
+
+inline volatile uint64_t g_benchSink = 0;
+
+/**
+ * @brief Best-of-rounds time of one fn() call, in microseconds.
+ */
+template <typename Fn>
+double BenchBestUs(int rounds, int iterations, Fn&& fn) {
+    double best = 1e30;
+    for (int r = 0; r < rounds; r++) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) fn();
+        double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        best = std::min(best, us / iterations);
+    }
+    return best;
+}
+
+inline void BenchHeader(const char* title) {
+    std::printf("\n== %s ==\n", title);
+}
+
+inline void BenchLine(const char* label, double us, const char* note = "") {
+    std::printf("  %-44s %10.2f us  %s\n", label, us, note);
+}
+
+// FNV-1a over a range of 32-bit words (output equality checks)
+inline uint64_t BenchHash(const uint32_t* data, size_t count) {
+    uint64_t h = 1469598103934665603ull;
+    for (size_t i = 0; i < count; i++) {
+        h ^= data[i];
+        h *= 1099511628211ull;
+    }
+    return h;
+}
@@ -0,0 +1,259 @@
+// LOD bookkeeping on a steady-state world: 4 LODs at radius 15, 8 chunks high (~25k nodes).
+//   unload scan: the LOD job's unload pass over unordered_map<key, ChunkNode*> vs the ChunkHotTable arrays
+//   lookups:     ChunkClipmap vs unordered_map for the LOD load-scan probes and GetBlockAt-style lookups
+// Nodes come out of a shuffled slab, so walking them touches memory in pool order, not grid order.
+
+#include <vector>
+#include <cmath>
+#include <random>
+#include <tuple>
+#include <algorithm>
+#include <unordered_map>
+
+#include "chunkNode.h"
+#include "chunk_table.h"
+#include "chunk_clipmap.h"
+#include "bench_common.h"
+
+constexpr int LOD_COUNT = 4;
+constexpr int LOD_RADIUS = 15;
+constexpr int HEIGHT_CHUNKS = 8;
+
+struct BenchWorld {
+    ChunkNode* slab = nullptr;
+    std::unordered_map<int64_t, ChunkNode*> map;
+    ChunkHotTable table;
+    ChunkClipmap clipmap;
+    int lodRadius[LOD_COUNT];
+
+    BenchWorld() {
+        for (int& r : lodRadius) r = LOD_RADIUS;
+
+        // Each LOD ring around the origin, minus the hole its finer LOD covers (same rule as Condition B)
+        std::vector<std::tuple<int, int, int, int>> cells;
+        for (int lod = 0; lod < LOD_COUNT; lod++) {
+            int inner = (lod > 0) ? (lodRadius[lod - 1] + 1) / 2 : 0;
+            for (int z = -lodRadius[lod]; z <= lodRadius[lod]; z++)
+                for (int x = -lodRadius[lod]; x <= lodRadius[lod]; x++) {
+                    if (std::abs(x) < inner && std::abs(z) < inner) continue;
+                    for (int y = 0; y < HEIGHT_CHUNKS; y++) cells.emplace_back(x, y, z, lod);
+                }
+        }
+
+        slab = new ChunkNode[cells.size()];
+        std::vector<size_t> order(cells.size());
+        for (size_t i = 0; i < order.size(); i++) order[i] = i;
+        std::shuffle(order.begin(), order.end(), std::mt19937(42));
+
+        table.Reserve(cells.size());
+        clipmap.Init(lodRadius, LOD_COUNT, HEIGHT_CHUNKS);
+        for (size_t i = 0; i < cells.size(); i++) {
+            auto [x, y, z, lod] = cells[i];
+            ChunkNode* node = &slab[order[i]];
+            node->Reset(x, y, z, lod);
+            node->uniqueID = ChunkKey(x, y, z, lod);
+            node->currentState = ChunkState::ACTIVE;
+            map[node->uniqueID] = node;
+            table.Add(node);
+            clipmap.Insert(node);
+        }
+    }
+
+    // World::FindChunk: clipmap first, the map only confirms misses while something overflowed
+    ChunkNode* FindChunk(int x, int y, int z, int lod) const {
+        if (ChunkNode* node = clipmap.Find(x, y, z, lod)) return node;
+        if (!clipmap.HasOverflow()) return nullptr;
+        auto it = map.find(ChunkKey(x, y, z, lod));
+        return (it != map.end()) ? it->second : nullptr;
+    }
+
+    ChunkNode* FindChunkMap(int x, int y, int z, int lod) const {
+        auto it = map.find(ChunkKey(x, y, z, lod));
+        return (it != map.end()) ? it->second : nullptr;
+    }
+
+    ~BenchWorld() { delete[] slab; }
+};
+
+// Stand-ins for World::IsParentReady / AreChildrenReady, only reached by candidates
+static bool IsParentReady(const ChunkNode* node) {
+    return node->parent && node->parent->currentState.load() == ChunkState::ACTIVE;
+}
+static bool AreChildrenReady(const ChunkNode* node) {
+    return node->childMask != 0 && node->activeChildMask.load() == node->childMask;
+}
+
+// The unload pass before the hot table: walk the map, read everything through the node
+static size_t UnloadScanMap(const BenchWorld& world, float camX, float camZ, std::vector<int64_t>& out) {
+    out.clear();
+    for (const auto& pair : world.map) {
+        ChunkNode* node = pair.second;
+        int lod = node->lodLevel;
+        int scale = 1 << lod;
+
+        int camChunkX = (int)floor(camX / (CHUNK_SIZE * scale));
+        int camChunkZ = (int)floor(camZ / (CHUNK_SIZE * scale));
+
+        int dx = abs(node->gridX - camChunkX);
+        int dz = abs(node->gridZ - camChunkZ);
+
+        bool shouldUnload = false;
+        if (dx > world.lodRadius[lod] || dz > world.lodRadius[lod]) {
+            if (IsParentReady(node)) {
+                shouldUnload = true;
+            } else if (lod < LOD_COUNT - 1) {
+                int pLod = lod + 1;
+                int pScale = 1 << pLod;
+                int pCamX = (int)floor(camX / (CHUNK_SIZE * pScale));
+                int pCamZ = (int)floor(camZ / (CHUNK_SIZE * pScale));
+                if (abs((node->gridX >> 1) - pCamX) > world.lodRadius[pLod] || abs((node->gridZ >> 1) - pCamZ) > world.lodRadius[pLod]) {
+                    shouldUnload = true;
+                }
+            }
+        } else if (lod > 0) {
+            int innerBoundary = (world.lodRadius[lod - 1] + 1) / 2;
+            if (dx < innerBoundary && dz < innerBoundary && AreChildrenReady(node)) shouldUnload = true;
+        }
+
+        if (shouldUnload) {
+            ChunkState s = node->currentState.load();
+            if (s != ChunkState::GENERATING && s != ChunkState::MESHING) out.push_back(pair.first);
+        }
+    }
+    return out.size();
+}
+
+// The unload pass now: dense key/grid/LOD arrays, the node only for candidates
+static size_t UnloadScanTable(const BenchWorld& world, float camX, float camZ, std::vector<int64_t>& out) {
+    out.clear();
+    int camChunkXByLod[LOD_COUNT], camChunkZByLod[LOD_COUNT];
+    for (int lod = 0; lod < LOD_COUNT; lod++) {
+        int scale = 1 << lod;
+        camChunkXByLod[lod] = (int)floor(camX / (CHUNK_SIZE * scale));
+        camChunkZByLod[lod] = (int)floor(camZ / (CHUNK_SIZE * scale));
+    }
+
+    const ChunkHotTable& table = world.table;
+    const size_t rowCount = table.Size();
+    const int32_t* rowX = table.gridX.data();
+    const int32_t* rowZ = table.gridZ.data();
+    const uint8_t* rowLod = table.lod.data();
+
+    for (size_t row = 0; row < rowCount; row++) {
+        int lod = rowLod[row];
+        int gridX = rowX[row];
+        int gridZ = rowZ[row];
+
+        int dx = abs(gridX - camChunkXByLod[lod]);
+        int dz = abs(gridZ - camChunkZByLod[lod]);
+
+        bool shouldUnload = false;
+        if (dx > world.lodRadius[lod] || dz > world.lodRadius[lod]) {
+            if (IsParentReady(table.nodes[row])) {
+                shouldUnload = true;
+            } else if (lod < LOD_COUNT - 1) {
+                int pLod = lod + 1;
+                if (abs((gridX >> 1) - camChunkXByLod[pLod]) > world.lodRadius[pLod] || abs((gridZ >> 1) - camChunkZByLod[pLod]) > world.lodRadius[pLod]) {
+                    shouldUnload = true;
+                }
+            }
+        } else if (lod > 0) {
+            int innerBoundary = (world.lodRadius[lod - 1] + 1) / 2;
+            if (dx < innerBoundary && dz < innerBoundary && AreChildrenReady(table.nodes[row])) shouldUnload = true;
+        }
+
+        if (shouldUnload) {
+            ChunkState s = table.nodes[row]->currentState.load();
+            if (s != ChunkState::GENERATING && s != ChunkState::MESHING) out.push_back(table.keys[row]);
+        }
+    }
+    return out.size();
+}
+
+static void BenchUnloadScan(const BenchWorld& world) {
+    BenchHeader("LOD unload pass: unordered_map vs hot table");
+    std::vector<int64_t> out;
+    out.reserve(world.table.Size());
+
+    // Steady state (camera at the ring centre, nothing to unload), then a jump of four coarsest
+    // chunks (every ring's trailing edge falls outside its own and its parent's ring)
+    for (float camX : { 0.5f, 4.0f * CHUNK_SIZE * (1 << (LOD_COUNT - 1)) }) {
+        size_t mapCount = 0, tableCount = 0;
+        double map = BenchBestUs(5, 20, [&]() { mapCount = UnloadScanMap(world, camX, 0.5f, out); g_benchSink = g_benchSink + mapCount; });
+        double table = BenchBestUs(5, 20, [&]() { tableCount = UnloadScanTable(world, camX, 0.5f, out); g_benchSink = g_benchSink + tableCount; });
+
+        char note[96];
+        std::snprintf(note, sizeof(note), "%zu candidates", mapCount);
+        BenchLine(camX < 1.0f ? "unordered_map scan (steady)" : "unordered_map scan (camera moved)", map, note);
+        std::snprintf(note, sizeof(note), "%zu candidates%s", tableCount, tableCount == mapCount ? "" : " (MISMATCH)");
+        BenchLine(camX < 1.0f ? "hot table scan (steady)" : "hot table scan (camera moved)", table, note);
+    }
+}
+
+// The LOD job's load scan: probe every cell of every ring around the (predicted) camera chunk
+template <typename Find>
+static size_t LoadScan(int camX, int camZ, Find&& find) {
+    size_t missing = 0;
+    for (int lod = 0; lod < LOD_COUNT; lod++) {
+        int cx = camX >> lod, cz = camZ >> lod;
+        for (int z = cz - LOD_RADIUS; z <= cz + LOD_RADIUS; z++)
+            for (int x = cx - LOD_RADIUS; x <= cx + LOD_RADIUS; x++)
+                for (int y = 0; y < HEIGHT_CHUNKS; y++) missing += (find(x, y, z, lod) == nullptr);
+    }
+    return missing;
+}
+
+static void BenchLookups(const BenchWorld& world) {
+    BenchHeader("Chunk lookups: unordered_map vs clipmap");
+    std::printf("  clipmap overflow %zu, %zu KB of cells\n", world.clipmap.GetOverflowCount(), world.clipmap.GetMemoryBytes() / 1024);
+
+    auto viaMap = [&](int x, int y, int z, int lod) { return world.FindChunkMap(x, y, z, lod); };
+    auto viaClipmap = [&](int x, int y, int z, int lod) { return world.FindChunk(x, y, z, lod); };
+    const size_t probes = (size_t)LOD_COUNT * (2 * LOD_RADIUS + 1) * (2 * LOD_RADIUS + 1) * HEIGHT_CHUNKS;
+    char note[96];
+
+    // Camera one chunk off the centre, so the scan sees a ring's worth of misses too
+    size_t mapMissing = 0, clipMissing = 0;
+    double map = BenchBestUs(5, 50, [&]() { mapMissing = LoadScan(1, 0, viaMap); g_benchSink = g_benchSink + mapMissing; });
+    double clip = BenchBestUs(5, 50, [&]() { clipMissing = LoadScan(1, 0, viaClipmap); g_benchSink = g_benchSink + clipMissing; });
+    std::snprintf(note, sizeof(note), "%zu probes, %zu missing", probes, mapMissing);
+    BenchLine("load scan: unordered_map", map, note);
+    std::snprintf(note, sizeof(note), "%zu probes, %zu missing%s", probes, clipMissing, clipMissing == mapMissing ? "" : " (MISMATCH)");
+    BenchLine("load scan: clipmap", clip, note);
+
+    // GetBlockAt without a chunk hint: world voxel -> LOD 0 chunk, random points in the LOD 0 ring
+    std::mt19937 rng(99);
+    const int extent = (2 * LOD_RADIUS + 1) * CHUNK_SIZE;
+    std::vector<int> points(200000 * 3);
+    for (size_t i = 0; i < points.size(); i += 3) {
+        points[i] = (int)(rng() % extent) - LOD_RADIUS * CHUNK_SIZE;
+        points[i + 1] = (int)(rng() % (HEIGHT_CHUNKS * CHUNK_SIZE));
+        points[i + 2] = (int)(rng() % extent) - LOD_RADIUS * CHUNK_SIZE;
+    }
+    auto blockLookups = [&](auto&& find) {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < points.size(); i += 3) {
+            int cx = static_cast<int>(std::floor(points[i] / (float)CHUNK_SIZE));
+            int cy = static_cast<int>(std::floor(points[i + 1] / (float)CHUNK_SIZE));
+            int cz = static_cast<int>(std::floor(points[i + 2] / (float)CHUNK_SIZE));
+            if (ChunkNode* node = find(cx, cy, cz, 0)) sum += node->gridY + 1;
+        }
+        return sum;
+    };
+    uint64_t mapSum = 0, clipSum = 0;
+    map = BenchBestUs(5, 5, [&]() { mapSum = blockLookups(viaMap); g_benchSink = g_benchSink + mapSum; });
+    clip = BenchBestUs(5, 5, [&]() { clipSum = blockLookups(viaClipmap); g_benchSink = g_benchSink + clipSum; });
+    std::snprintf(note, sizeof(note), "%zu lookups", points.size() / 3);
+    BenchLine("GetBlockAt-style: unordered_map", map, note);
+    std::snprintf(note, sizeof(note), "%zu lookups%s", points.size() / 3, clipSum == mapSum ? "" : " (MISMATCH)");
+    BenchLine("GetBlockAt-style: clipmap", clip, note);
+}
+
+int main() {
+    BenchWorld world;
+    std::printf("bench_lod: CHUNK_SIZE %d, %d LODs at radius %d, %d chunks high, %zu nodes\n",
+                CHUNK_SIZE, LOD_COUNT, LOD_RADIUS, HEIGHT_CHUNKS, world.table.Size());
+    BenchUnloadScan(world);
+    BenchLookups(world);
+    return 0;
+}
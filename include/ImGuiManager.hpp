@@ -10,6 +10,7 @@
 #include "world.h"
 #include "camera.h"
 #include "profiler.h"
+#include "logger.h"
 #include "terrain/terrain_system.h"
 #include "terrain/terrain_selector_ImGuiExpose.h"
 #include "playerController.h"
@@ -32,6 +33,7 @@ struct UIConfig {
     // --- Sub-window Toggles (Managed by F2 master switch usually) ---
     bool showCameraControls = true;
     bool showCullerControls = true;
+    bool showChunkCostMap = false;
 
     // --- Settings ---
     bool vsync = true;
@@ -48,6 +50,10 @@ struct UIConfig {
     // --- World Edit State ---
     std::unique_ptr<EngineConfig> editConfig;        
     int currentLODPreset = 1;       // 0=Low, 1=Med, 2=High, 3=Extreme
+
+    // --- Chunk Cost Map ---
+    int costMapLod = 0;
+    int costMapMetric = (int)ChunkCostMetric::TOTAL_US;
 };
 
 // ================================================================================================
@@ -148,6 +154,7 @@ public:
             RenderDebugPanel(world, config, VRAM_HEAP_SIZE_MB); // Top Left
             //RenderCameraControls(player, config);               // Top Right
             RenderCullerControls(world, config);                // Bottom Right
+            if (config.showChunkCostMap) RenderChunkCostMap(world, config, player);
         }
 
         if (config.crossHairEnabled)
@@ -181,6 +188,10 @@ private:
     // --------------------------------------------------------------------------------------------
     bool m_Initialized = false;
     GLFWwindow* m_Window = nullptr;
+
+    // Chunk cost heatmap, rebuilt a few times per second (BuildColumns walks every record)
+    ChunkCostGrid m_costGrid;
+    double m_costGridTime = -1.0;
     int m_WindowedX = 0, m_WindowedY = 0;
     int m_WindowedW = 1280, m_WindowedH = 720;
 
@@ -353,6 +364,15 @@ private:
                                         world.ReloadWorld(*config.editConfig);
                                     }
                                 }
+
+                                ImGui::Spacing();
+                                ImGui::Text("Heightfield From LOD");
+                                ImGui::SameLine();
+                                ImGui::SliderInt("##farfieldlod", &config.editConfig->settings.farFieldStartLod, 1, 12);
+                                if (ImGui::IsItemHovered()) ImGui::SetTooltip("LODs from here on are 2.5D heightfield tiles (one per column, no voxels).\nSet it to the LOD count or higher to keep every LOD as voxel chunks.");
+                                if (ImGui::IsItemDeactivatedAfterEdit()) {
+                                    world.ReloadWorld(*config.editConfig);
+                                }
                             }
                             ImGui::TreePop();
                         }
@@ -596,16 +616,118 @@ private:
             ImGui::Separator();
             
             ImGui::Checkbox("Enable Occlusion Culling", &settings.occlusionEnabled);
+            ImGui::Checkbox("Box Occluders (Solid Chunk Boxes)", &settings.boxOccluders);
+            ImGui::SliderInt("Occluder Radius (Chunks)", &settings.occluderRadius, 1, 8);
             ImGui::Checkbox("Freeze Culling Result", &settings.freezeCulling);
+            ImGui::Checkbox("Cave Culling (Connectivity)", &settings.caveCullingEnabled);
+            ImGui::Checkbox("Meshlet Culling (Clusters)", &settings.clusterCullingEnabled);
+            ImGui::Checkbox("Near-to-Far Opaque Draws (Buckets)", &settings.distanceBuckets);
+            if (settings.distanceBuckets) ImGui::SliderFloat("Nearest Bucket (Blocks)", &settings.bucketBaseDistance, 16.0f, 512.0f, "%.0f");
             
             ImGui::Spacing();
             ImGui::Separator();
             ImGui::Text("Chunks Drawn: %u", culler->GetDrawCount());
+            ImGui::Text("Opaque Draws: %u", culler->GetOpaqueCommandCount());
+            ImGui::Text("Occluder Boxes: %u", culler->GetOccluderCount());
+            if (culler->GetClusterOverflow() > 0)
+                ImGui::TextColored(ImVec4(1, 0, 0, 1), "Meshlet Overflow: %u", culler->GetClusterOverflow());
+            if (settings.distanceBuckets) {
+                const uint32_t* buckets = culler->GetBucketCounts();
+                ImGui::Text("Draws per Bucket:");
+                for (uint32_t b = 0; b < DRAW_DISTANCE_BUCKETS; b++) {
+                    ImGui::SameLine();
+                    ImGui::Text("%u", buckets[b]);
+                }
+            }
             
             ImGui::End();
         }
     }
 
+    void RenderChunkCostMap(World& world, UIConfig& config, const Player& player) {
+        ImGuiWindowFlags flags = config.isGameMode ? (ImGuiWindowFlags_NoInputs | ImGuiWindowFlags_NoMouseInputs) : 0;
+        if (config.isGameMode) ImGui::SetNextWindowBgAlpha(0.6f);
+        ImGui::SetNextWindowSize(ImVec2(420, 520), ImGuiCond_FirstUseEver);
+
+        if (ImGui::Begin("Chunk Cost Map", &config.showChunkCostMap, flags)) {
+            ImGui::SetWindowFontScale(config.DEBUG_FONT_SCALE);
+            ChunkCostMap& costs = world.GetChunkCostMap();
+
+            bool recording = costs.IsEnabled();
+            if (ImGui::Checkbox("Record Chunk Costs", &recording)) costs.SetEnabled(recording);
+            ImGui::SameLine();
+            if (ImGui::Button("Clear")) { costs.Clear(); m_costGridTime = -1.0; }
+            ImGui::Text("Chunks Recorded: %zu", costs.Size());
+            if (costs.IsFull()) ImGui::TextColored(ImVec4(1, 0, 0, 1), "Record limit reached, new chunks ignored");
+
+            int lodCount = world.GetConfig().settings.lodCount;
+            bool changed = ImGui::SliderInt("LOD", &config.costMapLod, 0, std::max(lodCount - 1, 0));
+            const char* metrics[(size_t)ChunkCostMetric::COUNT];
+            for (size_t m = 0; m < (size_t)ChunkCostMetric::COUNT; m++) metrics[m] = ChunkCostMetricName((ChunkCostMetric)m);
+            changed |= ImGui::Combo("Metric", &config.costMapMetric, metrics, (int)ChunkCostMetric::COUNT);
+
+            double now = ImGui::GetTime();
+            if (changed || m_costGridTime < 0.0 || now - m_costGridTime > 0.5) {
+                costs.BuildColumns(config.costMapLod, (ChunkCostMetric)config.costMapMetric, m_costGrid);
+                m_costGridTime = now;
+            }
+
+            if (ImGui::Button("Export CSV")) {
+                bool ok = costs.WriteCsv("chunk_costs.csv");
+                GOOSE_LOG_INFO("CostMap", (ok ? "Wrote" : "Failed to write") << " chunk_costs.csv");
+            }
+            ImGui::SameLine();
+            if (ImGui::Button("Export PNG")) {
+                std::string path = "chunk_costs_lod" + std::to_string(config.costMapLod) + ".png";
+                bool ok = ChunkCostMap::WriteHeatmapPng(m_costGrid, path);
+                GOOSE_LOG_INFO("CostMap", (ok ? "Wrote " : "Failed to write ") << path);
+            }
+
+            const ChunkCostGrid& grid = m_costGrid;
+            if (grid.width == 0) {
+                ImGui::TextDisabled("No chunks recorded at this LOD.");
+            } else {
+                ImGui::Text("Max Column: %.0f  (%d x %d columns)", grid.maxValue, grid.width, grid.depth);
+
+                // One rect per column, +X right / +Z down like the PNG
+                ImVec2 avail = ImGui::GetContentRegionAvail();
+                float cell = std::clamp(std::min(avail.x / grid.width, std::max(avail.y, 64.0f) / grid.depth), 1.0f, 12.0f);
+                ImVec2 origin = ImGui::GetCursorScreenPos();
+                ImDrawList* drawList = ImGui::GetWindowDrawList();
+                for (int z = 0; z < grid.depth; z++) {
+                    for (int x = 0; x < grid.width; x++) {
+                        if (!grid.Has(x, z)) continue;
+                        uint8_t rgb[3];
+                        HeatColor(grid.maxValue > 0.0 ? (float)(grid.At(x, z) / grid.maxValue) : 0.0f, rgb);
+                        ImVec2 a(origin.x + x * cell, origin.y + z * cell);
+                        drawList->AddRectFilled(a, ImVec2(a.x + cell, a.y + cell), IM_COL32(rgb[0], rgb[1], rgb[2], 255));
+                    }
+                }
+
+                // Player column
+                float chunkWorld = (float)CHUNK_SIZE * (float)(1 << config.costMapLod);
+                int px = (int)std::floor(player.camera.Position.x / chunkWorld) - grid.minX;
+                int pz = (int)std::floor(player.camera.Position.z / chunkWorld) - grid.minZ;
+                if (px >= 0 && px < grid.width && pz >= 0 && pz < grid.depth) {
+                    ImVec2 a(origin.x + px * cell, origin.y + pz * cell);
+                    drawList->AddRect(a, ImVec2(a.x + cell, a.y + cell), IM_COL32(255, 255, 255, 255), 0.0f, 0, 2.0f);
+                }
+
+                ImGui::InvisibleButton("##costmap", ImVec2(grid.width * cell, grid.depth * cell));
+                if (ImGui::IsItemHovered()) {
+                    ImVec2 mouse = ImGui::GetMousePos();
+                    int hx = (int)((mouse.x - origin.x) / cell);
+                    int hz = (int)((mouse.y - origin.y) / cell);
+                    if (hx >= 0 && hx < grid.width && hz >= 0 && hz < grid.depth && grid.Has(hx, hz)) {
+                        ImGui::SetTooltip("Column %d, %d (LOD %d)\n%s: %.0f", grid.minX + hx, grid.minZ + hz, config.costMapLod,
+                                          ChunkCostMetricName((ChunkCostMetric)config.costMapMetric), grid.At(hx, hz));
+                    }
+                }
+            }
+        }
+        ImGui::End();
+    }
+
     void RenderSimpleOverlay(const UIConfig& config, const Player& player) {
         //Engine::Profiler::ScopedTimer timer("ImGui::Overlay Render Time");
         const float PAD = 10.0f;
@@ -686,11 +808,31 @@ private:
             
             ImGui::Text("Active Chunks: %zu", activeChunks);
             ImGui::Text("Resident Vertices: %s", FormatNumber(totalVertices).c_str());
+            ImGui::Text("Clipmap Overflow: %zu (%.1f MB)", world.m_chunkClipmap.GetOverflowCount(),
+                        world.m_chunkClipmap.GetMemoryBytes() / (1024.0f * 1024.0f));
+            ChunkPayloadStore::Stats dedup = world.m_payloadStore.GetStats();
+            ImGui::Text("Dedup (%s): %.2fx (%zu chunks / %zu payloads, %zu voxel copies)", world.GetGenerator()->GetName(),
+                        dedup.livePayloads ? (float)dedup.liveRefs / (float)dedup.livePayloads : 1.0f,
+                        dedup.liveRefs, dedup.livePayloads, dedup.liveVoxelCopies);
+
+            // Per LOD cost, heightfield tiles vs voxel chunks
+            std::vector<World::LodFootprint> footprints;
+            world.GetLodFootprints(footprints);
+            for (size_t lod = 0; lod < footprints.size(); lod++) {
+                const World::LodFootprint& f = footprints[lod];
+                ImGui::Text("LOD %zu %s: %zu chunks, %.1f MB RAM, %.1f MB VRAM", lod, f.heightfield ? "[H]" : "[V]", f.chunks,
+                            f.ramBytes / (1024.0f * 1024.0f), f.vramBytes / (1024.0f * 1024.0f));
+            }
             
             if (ImGui::Checkbox("Wireframe Mode", &config.showWireframe)) {
                 glPolygonMode(GL_FRONT_AND_BACK, config.showWireframe ? GL_LINE : GL_FILL);
             }
             ImGui::Checkbox("Lock Frustum (F)", &config.lockFrustum);
+            ImGui::Checkbox("Chunk Cost Map", &config.showChunkCostMap);
+            bool predictive = world.GetPredictiveStreaming();
+            if (ImGui::Checkbox("Predictive Streaming", &predictive)) world.SetPredictiveStreaming(predictive);
+            bool threaded = world.IsThreadedStreaming();
+            if (ImGui::Checkbox("Streaming Thread", &threaded)) world.SetThreadedStreaming(threaded);
             if (config.lockFrustum) ImGui::TextColored(ImVec4(1,0,0,1), "FRUSTUM LOCKED");
 
             if (world.GetLODFreeze())
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+// ================================================================================================
+//                                   HEAP ALLOCATION TRACKER
+// Built only with -DGOOSE_ALLOC_TRACKING=ON (CMake), which replaces the global operator new /
+// delete (src/alloc_tracker.cpp). Every allocation is counted against the innermost profiler scope
+// of the allocating thread (ScopedTimer / BeginGPU push one) and that thread's index, in a fixed
+// lock-free table, so counting itself never allocates. Profiler::Update calls EndFrame(), which
+// turns the running totals into per-frame deltas for the UI: the steady-state goal is a frame with
+// no allocations at all.
+// Without the flag every call here is an empty inline and operator new is the standard one.
+// ================================================================================================
+
+namespace Engine {
+
+struct AllocScopeStats {
+    const char* scope;   // Profiler scope name, "(no scope)" outside any
+    uint32_t thread;     // Tracker thread index (1 = first thread that allocated)
+    uint64_t allocs;
+    uint64_t bytes;
+    uint64_t frees;      // Frees issued from this scope (the size of unsized deletes is unknown)
+};
+
+class AllocTracker {
+public:
+#if GOOSE_ALLOC_TRACKING
+    static constexpr bool COMPILED_IN = true;
+
+    // Scope stack of the calling thread. Names must outlive the scope (literals, map keys).
+    static void PushScope(const char* name);
+    static void PopScope();
+
+    /**
+     * @brief Latches the allocations since the last call (GetLastFrame). Once per frame, main thread.
+     */
+    static void EndFrame();
+
+    static const std::vector<AllocScopeStats>& GetLastFrame();   // Sorted by allocation count
+    static uint64_t GetLastFrameAllocs();
+    static uint64_t GetLastFrameBytes();
+    static uint32_t GetMainThreadIndex();                        // Thread that calls EndFrame
+    static bool IsTableFull();                                   // Overflowed scope/thread pairs go to one slot
+#else
+    static constexpr bool COMPILED_IN = false;
+
+    static void PushScope(const char*) {}
+    static void PopScope() {}
+    static void EndFrame() {}
+    static const std::vector<AllocScopeStats>& GetLastFrame() { static const std::vector<AllocScopeStats> empty; return empty; }
+    static uint64_t GetLastFrameAllocs() { return 0; }
+    static uint64_t GetLastFrameBytes() { return 0; }
+    static uint32_t GetMainThreadIndex() { return 0; }
+    static bool IsTableFull() { return false; }
+#endif
+};
+
+} // namespace Engine
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstdint>
+
+// ================================================================================================
+//                                      BLOCK REGISTRY
+// Single compile-time table for everything the engine needs to know about a block ID.
+// Flags and per-face texture layers are looked up with one array index instead of the
+// if-chains / literal ID checks that used to live in the mesher, physics and raycasts.
+// IDs follow the texture order in terrain_beach_world_2.h (texture layer == block ID by default).
+// ================================================================================================
+
+namespace Block {
+    enum : uint8_t {
+        AIR           = 0,
+        GRASS         = 1,
+        DIRT          = 2,
+        STONE         = 3,
+        SNOW          = 4,
+        SAND          = 5,
+        WATER         = 6,
+        GLASS         = 7,
+        CLAY          = 8,
+        GRAVEL        = 9,
+        MUD           = 10,
+        SANDSTONE     = 11,
+        ICE           = 12,
+        OAK_LOG       = 13,
+        OAK_LEAVES    = 14, // Also used as cactus green by the advanced generator
+        SPRUCE_LOG    = 15,
+        SPRUCE_LEAVES = 16,
+        SWAMP_GRASS   = 17,
+        SAVANNA_GRASS = 18,
+        OBSIDIAN      = 19, // Bedrock / volcanic rock
+        LAVA          = 20,
+        REDSTONE      = 21,
+        GOLD_ORE      = 22,
+        DIAMOND_ORE   = 23,
+        COPPER_ORE    = 24,
+    };
+}
+
+// --- Property Flags (packed into one byte per ID) ---
+constexpr uint8_t BLOCK_FLAG_OPAQUE      = 1 << 0; // Hides the faces behind it, occludes light/visibility
+constexpr uint8_t BLOCK_FLAG_TRANSPARENT = 1 << 1; // Rendered in the transparent pass
+constexpr uint8_t BLOCK_FLAG_SOLID       = 1 << 2; // Collides with the player
+constexpr uint8_t BLOCK_FLAG_LIQUID      = 1 << 3; // Swimmable, no collision
+
+// Face Order matches the mesher: 0=+X, 1=-X, 2=+Y (Top), 3=-Y (Bottom), 4=+Z, 5=-Z
+struct BlockTable {
+    uint8_t flags[256];
+    uint16_t faceTexture[256][6];
+};
+
+constexpr BlockTable BuildBlockTable() {
+    BlockTable t{};
+
+    // Default: any non-air ID is an opaque solid cube textured with its own ID
+    for (int id = 0; id < 256; id++) {
+        t.flags[id] = (id == Block::AIR) ? 0 : (BLOCK_FLAG_OPAQUE | BLOCK_FLAG_SOLID);
+        for (int face = 0; face < 6; face++) t.faceTexture[id][face] = (uint16_t)id;
+    }
+
+    t.flags[Block::WATER] = BLOCK_FLAG_TRANSPARENT | BLOCK_FLAG_LIQUID;
+    t.flags[Block::GLASS] = BLOCK_FLAG_TRANSPARENT | BLOCK_FLAG_SOLID;
+    // Leaves (14, 16) should be transparent too, but the occlusion AABBs still treat a whole
+    // tree chunk as one 32x32x32 occluder, which gives false positives. Keep them opaque for now.
+
+    // Grass: green top, dirt bottom, grass side
+    t.faceTexture[Block::GRASS][2] = 1;
+    t.faceTexture[Block::GRASS][3] = 2;
+    t.faceTexture[Block::GRASS][0] = t.faceTexture[Block::GRASS][1] = 3;
+    t.faceTexture[Block::GRASS][4] = t.faceTexture[Block::GRASS][5] = 3;
+
+    // Oak log: rings on top/bottom, bark on the sides
+    t.faceTexture[Block::OAK_LOG][2] = 25;
+    t.faceTexture[Block::OAK_LOG][3] = 25;
+
+    return t;
+}
+
+inline constexpr BlockTable BLOCK_TABLE = BuildBlockTable();
+
+// --- Lookups (branch-free, single table read) ---
+constexpr uint8_t GetBlockFlags(uint8_t id) { return BLOCK_TABLE.flags[id]; }
+constexpr uint32_t GetBlockTexture(uint8_t id, int face) { return BLOCK_TABLE.faceTexture[id][face]; }
+
+constexpr bool IsOpaque(uint8_t id)      { return (BLOCK_TABLE.flags[id] & BLOCK_FLAG_OPAQUE) != 0; }
+constexpr bool IsTransparent(uint8_t id) { return (BLOCK_TABLE.flags[id] & BLOCK_FLAG_TRANSPARENT) != 0; }
+constexpr bool IsSolid(uint8_t id)       { return (BLOCK_TABLE.flags[id] & BLOCK_FLAG_SOLID) != 0; }
+constexpr bool IsLiquid(uint8_t id)      { return (BLOCK_TABLE.flags[id] & BLOCK_FLAG_LIQUID) != 0; }
+
+// Anything that gets meshed (i.e. not air). Used by raycasts to pick the first visible block.
+constexpr bool IsVisibleBlock(uint8_t id) { return (BLOCK_TABLE.flags[id] & (BLOCK_FLAG_OPAQUE | BLOCK_FLAG_TRANSPARENT)) != 0; }
+
+static_assert(!IsOpaque(Block::AIR) && !IsSolid(Block::AIR), "Air must be empty");
+static_assert(IsTransparent(Block::WATER) && !IsSolid(Block::WATER), "Water must be see-through and walkable");
+static_assert(GetBlockTexture(Block::GRASS, 2) == 1 && GetBlockTexture(Block::OAK_LOG, 3) == 25, "Face texture LUT mismatch");
@@ -1,38 +1,103 @@
 #pragma once
 #include <FastNoise/FastNoise.h>
-#include <cstring> 
+#include <cstring>
+#include <cstdint>
 
-constexpr int CHUNK_SIZE = 32;
-constexpr int CHUNK_SIZE_PADDED = CHUNK_SIZE + 2; 
+// Chunk edge length in voxels. Set at configure time (cmake -DGOOSE_CHUNK_SIZE=16|32|64).
+// 64 cuts chunk count, draw commands and map entries for long view distances,
+// 16 keeps remeshing cheap in edit-heavy worlds.
+#ifndef GOOSE_CHUNK_SIZE
+#define GOOSE_CHUNK_SIZE 32
+#endif
 
-struct Chunk {
-    // Standardized Layout: Y-Major (Y is slow, X is fast).
-    // Conceptually: voxels[y][z][x]
-    uint8_t voxels[CHUNK_SIZE_PADDED * CHUNK_SIZE_PADDED * CHUNK_SIZE_PADDED];
+constexpr int CHUNK_SIZE = GOOSE_CHUNK_SIZE;
+constexpr int PADDING = 1; // Neighbour voxels stored on each side of the chunk
+constexpr int CHUNK_SIZE_PADDED = CHUNK_SIZE + 2 * PADDING;
+static_assert(CHUNK_SIZE == 16 || CHUNK_SIZE == 32 || CHUNK_SIZE == 64, "GOOSE_CHUNK_SIZE must be 16, 32 or 64");
 
-    //34×34×34=39,304 bytes per Chunk.
-    //1 Chunk ≈ 39 KB.
-    
-    Chunk() {
+// ================================================================================================
+//                                      VOXEL LAYOUTS
+// A layout maps padded (x, y, z) to an index in Chunk::voxels. Everything outside chunk.h goes
+// through GetIndex/Get/Set (or the mesher's layout-aware kernels), so the layout is a
+// compile-time switch: cmake -DGOOSE_CHUNK_LAYOUT=LINEAR|TILED
+// ================================================================================================
+
+/**
+ * @brief Y-major, X-contiguous: voxels[y][z][x].
+ * Cheap X runs, but a Y step jumps a whole 34x34 plane (1156 bytes).
+ */
+struct LinearLayout {
+    static constexpr bool IS_LINEAR = true;
+    static constexpr int DIM = CHUNK_SIZE_PADDED;
+    static constexpr int VOLUME = DIM * DIM * DIM;
+
+    static constexpr int Index(int x, int y, int z) {
+        return x + (z * DIM) + (y * DIM * DIM);
+    }
+};
+
+/**
+ * @brief 4x4x4 bricks (64 bytes = one cache line), bricks stored Y-major like the linear layout.
+ * Neighbours on every axis are usually in the same line, which helps the mesher's Y/Z passes and
+ * random access. The padded dimension is rounded up to a multiple of 4 (34 -> 36, ~19% more memory).
+ */
+struct TiledLayout {
+    static constexpr bool IS_LINEAR = false;
+    static constexpr int TILE = 4;
+    static constexpr int DIM = (CHUNK_SIZE_PADDED + TILE - 1) & ~(TILE - 1);
+    static constexpr int TILES_PER_AXIS = DIM / TILE;
+    static constexpr int VOLUME = DIM * DIM * DIM;
+
+    static constexpr int Index(int x, int y, int z) {
+        int tile = (x >> 2) + ((z >> 2) * TILES_PER_AXIS) + ((y >> 2) * TILES_PER_AXIS * TILES_PER_AXIS);
+        int local = (x & 3) | ((z & 3) << 2) | ((y & 3) << 4);
+        return (tile << 6) | local;
+    }
+};
+
+#define GOOSE_LAYOUT_LINEAR 0
+#define GOOSE_LAYOUT_TILED 1
+#ifndef GOOSE_CHUNK_LAYOUT
+#define GOOSE_CHUNK_LAYOUT GOOSE_LAYOUT_LINEAR
+#endif
+
+#if GOOSE_CHUNK_LAYOUT == GOOSE_LAYOUT_TILED
+using ChunkLayout = TiledLayout;
+#else
+using ChunkLayout = LinearLayout;
+#endif
+
+// ================================================================================================
+//                                          CHUNK
+// ================================================================================================
+
+template <typename Layout>
+struct ChunkT {
+    using LayoutType = Layout;
+
+    uint8_t voxels[Layout::VOLUME];
+
+    // Linear 32^3 chunks: 34×34×34=39,304 bytes per Chunk (≈ 39 KB).
+    // 16^3: 5,832 bytes. 64^3: 287,496 bytes. Tiled rounds the padded edge up to a multiple of 4.
+
+    ChunkT() {
         std::memset(voxels, 0, sizeof(voxels));
     }
 
-    // New Standard: X is contiguous. 
-    // This matches standard C 3D array layout: arr[y][z][x]
     inline int GetIndex(int x, int y, int z) const {
-        return x + (z * CHUNK_SIZE_PADDED) + (y * CHUNK_SIZE_PADDED * CHUNK_SIZE_PADDED);
+        return Layout::Index(x, y, z);
     }
 
     inline uint8_t Get(int x, int y, int z) const {
-        if (x < 0 || x >= CHUNK_SIZE_PADDED || 
-            y < 0 || y >= CHUNK_SIZE_PADDED || 
+        if (x < 0 || x >= CHUNK_SIZE_PADDED ||
+            y < 0 || y >= CHUNK_SIZE_PADDED ||
             z < 0 || z >= CHUNK_SIZE_PADDED) return 0;
         return voxels[GetIndex(x, y, z)];
     }
 
     inline void SetSafe(int x, int y, int z, uint8_t v) {
-        if (x < 0 || x >= CHUNK_SIZE_PADDED || 
-            y < 0 || y >= CHUNK_SIZE_PADDED || 
+        if (x < 0 || x >= CHUNK_SIZE_PADDED ||
+            y < 0 || y >= CHUNK_SIZE_PADDED ||
             z < 0 || z >= CHUNK_SIZE_PADDED) return;
         voxels[GetIndex(x, y, z)] = v;
     }
@@ -40,4 +105,33 @@ struct Chunk {
     inline void Set(int x, int y, int z, uint8_t v) {
         voxels[GetIndex(x, y, z)] = v;
     }
-};
\ No newline at end of file
+
+    /**
+     * @brief True if every voxel of the inner volume (padding excluded) equals id.
+     * Linear layout scans contiguous X rows, other layouts go through the index function.
+     */
+    bool IsInnerUniform(uint8_t id) const {
+        if constexpr (Layout::IS_LINEAR) {
+            for (int y = 1; y <= CHUNK_SIZE; ++y) {
+                for (int z = 1; z <= CHUNK_SIZE; ++z) {
+                    const uint8_t* row = voxels + GetIndex(1, y, z);
+                    // Contiguous X row (Compiler will likely auto-vectorize this)
+                    for (int x = 0; x < CHUNK_SIZE; ++x) {
+                        if (row[x] != id) return false;
+                    }
+                }
+            }
+        } else {
+            for (int y = 1; y <= CHUNK_SIZE; ++y) {
+                for (int z = 1; z <= CHUNK_SIZE; ++z) {
+                    for (int x = 1; x <= CHUNK_SIZE; ++x) {
+                        if (voxels[GetIndex(x, y, z)] != id) return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+};
+
+using Chunk = ChunkT<ChunkLayout>;
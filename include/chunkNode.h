@@ -20,6 +20,11 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include "packedVertex.h"
+#include "chunk_meshlets.h"
+#include "chunk_bounds.h"
+#include "heightfield_tile.h"
+
+struct ChunkPayload; // chunk_payload_store.h
 // ================================================================================================
 //                                    CHUNK DATA STRUCTURES
 // The "Chunk Node" is a little more vague than a "Chunk"
@@ -40,7 +45,7 @@ enum class ChunkState {
     GENERATING, // Currently being filled with voxels by a worker thread.
     GENERATED,  // Voxel data exists, waiting in queue for meshing.
     MESHING,    // Currently generating geometry (vertices/indices) in a worker thread.
-    MESHED,     // Geometry generated, waiting for upload to GPU.
+    MESHED,     // Uploaded but held off the culler: prefetched ahead of the camera ring (see World::ShouldHoldDraw).
     ACTIVE      // Fully uploaded and potentially visible in the world.
 };
 
@@ -63,6 +68,7 @@ struct ChunkNode {
     // These vectors hold vertex data temporarily before uploading to the GPU.
     std::vector<PackedVertex> cachedMeshOpaque; 
     std::vector<PackedVertex> cachedMeshTransparent;
+    std::vector<ChunkMeshlet> cachedMeshlets;       // Clusters of the opaque mesh (see chunk_meshlets.h).
 
     // --- State & Synchronization ---
     std::atomic<ChunkState> currentState{ChunkState::MISSING}; // Atomic to allow lock-free state checks.
@@ -74,16 +80,61 @@ struct ChunkNode {
     size_t vertexCountOpaque = 0;          // Number of vertices to draw (Opaque).
     size_t vertexCountTransparent = 0;     // Number of vertices to draw (Transparent).
 
+    long long vramOffsetMeshlets = -1;     // Byte offset of the opaque mesh's ChunkMeshlet records (same heap).
+    size_t meshletCount = 0;               // 0 = culled/drawn as one range.
+
     int64_t uniqueID;                      // Unique 64-bit spatial hash key.
 
     // --- Bounding Box for Culling ---
     glm::vec3 aabbMinWorld;                // Axis Aligned Bounding Box Min (World Space).
     glm::vec3 aabbMaxWorld;                // Axis Aligned Bounding Box Max (World Space).
+    ChunkMeshBounds meshBounds;            // Tight geometry box + solid occluder box, chunk-local (see chunk_bounds.h).
 
     // --- Optimization Flags ---
     bool isUniform = false;                // If true, chunk contains only one block type (e.g., all Air or all Stone).
     uint8_t uniformBlockID = 0;            // The ID of the block if the chunk is uniform.
 
+    // --- Far Field ---
+    // Heightfield nodes (see heightfield_tile.h) stand for a whole chunk column, always at gridY 0.
+    // The columns only live between the generate and the mesh task.
+    bool isHeightfield = false;
+    std::vector<TerrainColumn> heightfieldColumns;
+
+    // --- Visibility ---
+    // 6x6 face-to-face connectivity matrix written by the mesher thread (see chunk_visibility.h).
+    // All bits set = fully open, which is also the safe default before the chunk is meshed.
+    std::atomic<uint64_t> faceConnectivity{~0ULL};
+
+    // --- Hot Table ---
+    uint32_t tableIndex = 0xFFFFFFFFu;     // Row in World's ChunkHotTable (see chunk_table.h). Maintained by the table.
+
+    // --- LOD Hierarchy ---
+    // Links to the coarser parent (lod + 1) and the 8 finer children (lod - 1), wired by World on insert
+    // and unwired on unload (streaming step, under the map's unique lock). Child slot = x | z << 1 | y << 2.
+    ChunkNode* parent = nullptr;
+    ChunkNode* children[8] = {};
+    uint8_t childSlot = 0;                         // Our slot in the parent's children[].
+    uint8_t childMask = 0;                         // Children currently tracked in the map.
+    std::atomic<uint8_t> activeChildMask{0};       // Children currently ACTIVE. Kept in sync by SetState().
+    uint8_t expectedChildMask = 0;                 // Children the terrain says should exist (non-empty height range).
+    bool hasExpectedChildMask = false;             // Filled lazily by the LOD thread, it's 4 noise calls.
+
+    // --- Streaming ---
+    float requestTime = -1.0f;             // World time the load was requested, -1 once ACTIVE (latency measurement).
+    bool drawHeld = false;                 // In World's held list (MESHED, waiting for the camera ring). Streaming step only.
+
+    // --- Neighbours (same LOD) ---
+    // The 26 surrounding chunks, indexed by NeighborIndex(dx, dy, dz). Wired/unwired by World together
+    // with the LOD links, so a null entry simply means that neighbour isn't tracked right now.
+    ChunkNode* neighbors[26] = {};
+
+    // --- Shared Content ---
+    // Refcounted voxels/mesh shared by every chunk with identical content (see chunk_payload_store.h).
+    // The VRAM handles above are either the node's own upload or borrowed from a payload, ownsMesh says which.
+    ChunkPayload* payload = nullptr;        // Linked after generation, null for uniform or edited chunks.
+    ChunkPayload* retiredPayload = nullptr; // Edited (copy-on-write): still drawing the shared mesh until our remesh uploads.
+    bool ownsMesh = false;                  // VRAM handles are ours to free (uploaded, not published to the payload).
+
     /**
      * @brief Resets the node for reuse from the object pool.
      * @param x Grid X coordinate.
@@ -104,17 +155,76 @@ struct ChunkNode {
         
         aabbMinWorld = worldPosition;
         aabbMaxWorld = worldPosition + glm::vec3(sizeInUnits);
+        meshBounds = ChunkMeshBounds{};
+        isHeightfield = false;
+        heightfieldColumns.clear();
         
         currentState = ChunkState::MISSING;
         cachedMeshOpaque.clear();
         cachedMeshTransparent.clear();
+        cachedMeshlets.clear();
         vramOffsetOpaque = -1;
         vramOffsetTransparent = -1;
         vertexCountOpaque = 0;
         vertexCountTransparent = 0;
+        vramOffsetMeshlets = -1;
+        meshletCount = 0;
+        faceConnectivity = ~0ULL;
+
+        parent = nullptr;
+        for (ChunkNode*& child : children) child = nullptr;
+        childSlot = (uint8_t)((x & 1) | ((z & 1) << 1) | ((y & 1) << 2));
+        childMask = 0;
+        activeChildMask = 0;
+        expectedChildMask = 0;
+        hasExpectedChildMask = false;
+        for (ChunkNode*& neighbor : neighbors) neighbor = nullptr;
+        requestTime = -1.0f;
+        drawHeld = false;
+        payload = nullptr;
+        retiredPayload = nullptr;
+        ownsMesh = false;
+    }
+
+    /**
+     * @brief Changes lifecycle state and mirrors ACTIVE into the parent's activeChildMask.
+     * Streaming step or main thread between steps (same as every other state write).
+     */
+    void SetState(ChunkState state) {
+        currentState = state;
+        if (parent) {
+            uint8_t bit = (uint8_t)(1u << childSlot);
+            if (state == ChunkState::ACTIVE) parent->activeChildMask.fetch_or(bit);
+            else parent->activeChildMask.fetch_and((uint8_t)~bit);
+        }
     }
 };
 
+/**
+ * @brief Slot of the neighbour at offset (dx, dy, dz) in ChunkNode::neighbors, each offset in [-1, 1].
+ * The centre (0, 0, 0) has no slot, everything after it shifts down by one.
+ */
+constexpr int NeighborIndex(int dx, int dy, int dz) {
+    int i = (dx + 1) + (dy + 1) * 3 + (dz + 1) * 9;
+    return (i > 13) ? i - 1 : i;
+}
+
+// The slot layout is point-symmetric around the centre, so the reverse link is just 25 - index.
+constexpr int OppositeNeighbor(int index) { return 25 - index; }
+
+static_assert(NeighborIndex(-1, -1, -1) == 0 && NeighborIndex(1, 1, 1) == 25, "Neighbour slots must cover 0..25");
+static_assert(OppositeNeighbor(NeighborIndex(1, 0, -1)) == NeighborIndex(-1, 0, 1), "Neighbour slots must be symmetric");
+
+/**
+ * @brief Inverse of NeighborIndex.
+ */
+inline void NeighborOffset(int index, int& dx, int& dy, int& dz) {
+    int i = (index >= 13) ? index + 1 : index;
+    dx = (i % 3) - 1;
+    dy = ((i / 3) % 3) - 1;
+    dz = (i / 9) - 1;
+}
+
 /**
  * @brief Generates a unique 64-bit integer key for a chunk based on position and LOD.
  * * Bit Layout (Total 64 bits):
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+#include "chunk.h"
+#include "mesher.h"
+#include "chunk_meshlets.h"
+
+// ================================================================================================
+//                                   CHUNK BOUNDS / OCCLUDER BOX
+// Two boxes per meshed chunk, both in chunk-local voxel units (0..CHUNK_SIZE):
+//   geometry - tight bounds of every emitted vertex. The culler's AABB used to be the full chunk
+//              cube, so a chunk with a thin strip of grass at the bottom was frustum-tested (and
+//              occlusion-tested) as if it was 32 blocks tall.
+//   occluder - a box that lies entirely inside OPAQUE voxels. Whatever it hides is really hidden,
+//              so rasterising these (instead of last frame's depth) gives Hi-Z occluders that never
+//              produce false culls from reprojection, foliage or transparent geometry.
+// The occluder is the largest cuboid anchored at the chunk's bottom or top face (terrain is layered
+// vertically): per column we count the opaque run from that face, then for every distinct run height
+// h the largest rectangle of columns with run >= h gives a candidate of volume area * h.
+// Pure CPU code, runs on the mesher thread next to MeshChunk.
+// ================================================================================================
+
+/**
+ * @brief Mesher output, shared through ChunkPayload like the mesh itself.
+ */
+struct ChunkMeshBounds {
+    bool hasGeometry = false;
+    uint8_t geometryMin[3] = { 0, 0, 0 };
+    uint8_t geometryMax[3] = { 0, 0, 0 };
+
+    bool hasOccluder = false;
+    uint8_t occluderMin[3] = { 0, 0, 0 };
+    uint8_t occluderMax[3] = { 0, 0, 0 };   // Exclusive (voxel faces), so a full chunk is 0..CHUNK_SIZE
+};
+
+// Anything smaller than a quarter of one full layer isn't worth a draw in the occluder pass
+constexpr int OCCLUDER_MIN_VOLUME = (CHUNK_SIZE * CHUNK_SIZE) / 4;
+
+inline void GrowGeometryBounds(ChunkMeshBounds& bounds, uint32_t minX, uint32_t minY, uint32_t minZ,
+                               uint32_t maxX, uint32_t maxY, uint32_t maxZ) {
+    if (!bounds.hasGeometry) {
+        bounds.geometryMin[0] = (uint8_t)minX; bounds.geometryMin[1] = (uint8_t)minY; bounds.geometryMin[2] = (uint8_t)minZ;
+        bounds.geometryMax[0] = (uint8_t)maxX; bounds.geometryMax[1] = (uint8_t)maxY; bounds.geometryMax[2] = (uint8_t)maxZ;
+        bounds.hasGeometry = true;
+        return;
+    }
+    bounds.geometryMin[0] = (uint8_t)std::min<uint32_t>(bounds.geometryMin[0], minX);
+    bounds.geometryMin[1] = (uint8_t)std::min<uint32_t>(bounds.geometryMin[1], minY);
+    bounds.geometryMin[2] = (uint8_t)std::min<uint32_t>(bounds.geometryMin[2], minZ);
+    bounds.geometryMax[0] = (uint8_t)std::max<uint32_t>(bounds.geometryMax[0], maxX);
+    bounds.geometryMax[1] = (uint8_t)std::max<uint32_t>(bounds.geometryMax[1], maxY);
+    bounds.geometryMax[2] = (uint8_t)std::max<uint32_t>(bounds.geometryMax[2], maxZ);
+}
+
+/**
+ * @brief Grows the geometry bounds by a packed mesh (chunk-local vertex coordinates).
+ */
+inline void AccumulateGeometryBounds(const PackedVertex* vertices, size_t vertexCount, ChunkMeshBounds& bounds) {
+    if (vertexCount == 0) return;
+
+    uint32_t minX = ~0u, minY = ~0u, minZ = ~0u, maxX = 0, maxY = 0, maxZ = 0;
+    for (size_t i = 0; i < vertexCount; i++) {
+        uint32_t data = vertices[i].data;
+        uint32_t x = data & PACKED_COORD_MASK;
+        uint32_t y = (data >> PACKED_COORD_BITS) & PACKED_COORD_MASK;
+        uint32_t z = (data >> (PACKED_COORD_BITS * 2)) & PACKED_COORD_MASK;
+        minX = std::min(minX, x); maxX = std::max(maxX, x);
+        minY = std::min(minY, y); maxY = std::max(maxY, y);
+        minZ = std::min(minZ, z); maxZ = std::max(maxZ, z);
+    }
+    GrowGeometryBounds(bounds, minX, minY, minZ, maxX, maxY, maxZ);
+}
+
+/**
+ * @brief Same from meshlets, whose boxes already cover every vertex of the mesh they were built from.
+ * The opaque mesh is the big one, this saves a second walk over it.
+ */
+inline void AccumulateGeometryBounds(const std::vector<ChunkMeshlet>& meshlets, ChunkMeshBounds& bounds) {
+    for (const ChunkMeshlet& m : meshlets) {
+        GrowGeometryBounds(bounds, m.boundsMin & 0xFF, (m.boundsMin >> 8) & 0xFF, (m.boundsMin >> 16) & 0xFF,
+                                   m.boundsMax & 0xFF, (m.boundsMax >> 8) & 0xFF, (m.boundsMax >> 16) & 0xFF);
+    }
+}
+
+/**
+ * @brief Largest rectangle in a CHUNK_SIZE x CHUNK_SIZE grid of column runs where every run >= minRun.
+ * Histogram-stack method, one row (z) at a time. Returns the area, rectangle in [x0, x1) x [z0, z1).
+ */
+inline int LargestColumnRectangle(const uint8_t* runs, int minRun, int& outX0, int& outX1, int& outZ0, int& outZ1) {
+    int heights[CHUNK_SIZE + 1];
+    int stack[CHUNK_SIZE + 1];
+    std::fill(heights, heights + CHUNK_SIZE + 1, 0);
+
+    int bestArea = 0;
+    for (int z = 0; z < CHUNK_SIZE; z++) {
+        for (int x = 0; x < CHUNK_SIZE; x++) {
+            heights[x] = (runs[x + z * CHUNK_SIZE] >= minRun) ? heights[x] + 1 : 0;
+        }
+        heights[CHUNK_SIZE] = 0; // Sentinel flushes the stack
+
+        int top = 0;
+        for (int x = 0; x <= CHUNK_SIZE; x++) {
+            while (top > 0 && heights[stack[top - 1]] >= heights[x]) {
+                int h = heights[stack[--top]];
+                int left = (top > 0) ? stack[top - 1] + 1 : 0;
+                int area = h * (x - left);
+                if (area > bestArea) {
+                    bestArea = area;
+                    outX0 = left; outX1 = x;
+                    outZ0 = z - h + 1; outZ1 = z + 1;
+                }
+            }
+            stack[top++] = x;
+        }
+    }
+    return bestArea;
+}
+
+/**
+ * @brief Finds a conservative solid box (all voxels inside are BLOCK_FLAG_OPAQUE) for occlusion.
+ * Leaves hasOccluder false if nothing of at least OCCLUDER_MIN_VOLUME exists.
+ */
+inline void ComputeOccluderBox(const Chunk& chunk, ChunkMeshBounds& bounds) {
+    constexpr int COLUMNS = CHUNK_SIZE * CHUNK_SIZE;
+    uint8_t runUp[COLUMNS];
+    uint8_t runDown[COLUMNS];
+
+    // Opaque run length from the bottom (y = 0) and from the top (y = CHUNK_SIZE - 1) of every column.
+    // Walked layer by layer (x rows are contiguous) instead of column by column, and a direction stops
+    // as soon as a whole layer has no column left that is still solid from its face.
+    auto MeasureRuns = [&chunk](uint8_t* runs, bool fromTop) {
+        std::fill(runs, runs + COLUMNS, (uint8_t)0);
+        for (int step = 0; step < CHUNK_SIZE; step++) {
+            int y = (fromTop ? CHUNK_SIZE - 1 - step : step) + PADDING;
+            uint32_t grown = 0;
+            for (int z = 0; z < CHUNK_SIZE; z++) {
+                uint8_t* row = runs + z * CHUNK_SIZE;
+                for (int x = 0; x < CHUNK_SIZE; x++) {
+                    // Only columns still solid all the way from the face (run == step) can grow
+                    uint32_t grow = (uint32_t)(row[x] == step) & (uint32_t)IsOpaque(chunk.voxels[chunk.GetIndex(x + PADDING, y, z + PADDING)]);
+                    row[x] = (uint8_t)(row[x] + grow);
+                    grown |= grow;
+                }
+            }
+            if (!grown) break;
+        }
+    };
+    MeasureRuns(runUp, false);
+    MeasureRuns(runDown, true);
+
+    int bestVolume = OCCLUDER_MIN_VOLUME - 1;
+    auto Search = [&](const uint8_t* runs, bool fromTop) {
+        // The rectangle at height h can't hold more than the columns reaching h, so h * columnsAtLeast[h]
+        // bounds its volume. Thresholds are tried best bound first and the search stops once no bound
+        // beats what we already have, which usually leaves 2-4 rectangle searches instead of ~30.
+        int columnsAtLeast[CHUNK_SIZE + 2] = {};
+        for (int i = 0; i < COLUMNS; i++) columnsAtLeast[runs[i]]++;
+
+        std::pair<int, int> candidates[CHUNK_SIZE]; // (volume bound, h) for every run height present
+        int candidateCount = 0;
+        for (int h = CHUNK_SIZE; h > 0; h--) {
+            bool present = columnsAtLeast[h] > 0;
+            columnsAtLeast[h] += columnsAtLeast[h + 1];
+            if (present) candidates[candidateCount++] = { h * columnsAtLeast[h], h };
+        }
+        std::sort(candidates, candidates + candidateCount, std::greater<std::pair<int, int>>());
+
+        for (int c = 0; c < candidateCount; c++) {
+            int h = candidates[c].second;
+            if (candidates[c].first <= bestVolume) break;
+
+            int x0 = 0, x1 = 0, z0 = 0, z1 = 0;
+            int area = LargestColumnRectangle(runs, h, x0, x1, z0, z1);
+            if (area * h <= bestVolume) continue;
+
+            bestVolume = area * h;
+            bounds.hasOccluder = true;
+            bounds.occluderMin[0] = (uint8_t)x0;
+            bounds.occluderMin[1] = (uint8_t)(fromTop ? CHUNK_SIZE - h : 0);
+            bounds.occluderMin[2] = (uint8_t)z0;
+            bounds.occluderMax[0] = (uint8_t)x1;
+            bounds.occluderMax[1] = (uint8_t)(fromTop ? CHUNK_SIZE : h);
+            bounds.occluderMax[2] = (uint8_t)z1;
+        }
+    };
+
+    bounds.hasOccluder = false;
+    Search(runUp, false);
+    Search(runDown, true);
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include "chunkNode.h"
+
+// ================================================================================================
+//                                      CHUNK CLIPMAP
+// Each LOD ring is a (2r+1)^2 window around the camera, so instead of hashing we keep one
+// toroidally addressed array of chunk handles per LOD: cell = (x & mask, z & mask, y).
+// Nothing has to be copied when the camera moves - a cell simply gets a new owner once the chunk
+// that scrolled out is unloaded and the one that scrolled in is inserted.
+// Each cell stores the owner's key, so a probe is one array read + compare, no node dereference.
+//
+// The window is sized with a margin for unload hysteresis (chunks wait for their parent/children
+// before leaving), but anything that still lands on an occupied cell, or outside the height range,
+// isn't stored here. Those are counted as overflow; while the count is non-zero a miss has to be
+// confirmed against m_activeChunkMap (see World::FindChunk).
+// Same locking as the map: written under the unique lock, read under the shared lock.
+// ================================================================================================
+
+class ChunkClipmap {
+public:
+    /**
+     * @brief (Re)builds the per-LOD windows. Drops every entry.
+     * @param lodRadius Horizontal radius per LOD (EngineConfig::settings.lodRadius).
+     * @param lodCount Number of LOD levels in use.
+     * @param heightChunks Vertical chunk count (worldHeightChunks), same for every LOD.
+     */
+    void Init(const int* lodRadius, int lodCount, int heightChunks) {
+        m_levels.assign(std::max(lodCount, 0), Level{});
+        for (int lod = 0; lod < lodCount; lod++) {
+            Level& level = m_levels[lod];
+
+            // +2 on each side: room for chunks that are waiting on hysteresis past the ring edge
+            int minSize = lodRadius[lod] * 2 + 5;
+            level.size = 1;
+            while (level.size < minSize) level.size <<= 1;
+            level.mask = level.size - 1;
+            level.height = std::max(heightChunks, 1);
+            level.cells.assign((size_t)level.size * level.size * level.height, Cell{});
+        }
+        m_overflowCount = 0;
+    }
+
+    void Clear() {
+        for (Level& level : m_levels) std::fill(level.cells.begin(), level.cells.end(), Cell{});
+        m_overflowCount = 0;
+    }
+
+    /**
+     * @brief Claims the node's cell. Returns false (and counts it as overflow) if the cell is taken
+     * by another chunk or the node is outside the window's LOD/height range.
+     */
+    bool Insert(ChunkNode* node) {
+        Cell* cell = CellAt(node->gridX, node->gridY, node->gridZ, node->lodLevel);
+        if (!cell || cell->node) {
+            m_overflowCount++;
+            return false;
+        }
+        cell->key = node->uniqueID;
+        cell->node = node;
+        return true;
+    }
+
+    void Remove(ChunkNode* node) {
+        Cell* cell = CellAt(node->gridX, node->gridY, node->gridZ, node->lodLevel);
+        if (cell && cell->node == node) {
+            *cell = Cell{};
+        } else if (m_overflowCount > 0) {
+            m_overflowCount--;
+        }
+    }
+
+    /**
+     * @brief Array lookup. nullptr means "not in the clipmap" - only a definite miss if !HasOverflow().
+     */
+    ChunkNode* Find(int x, int y, int z, int lod) const {
+        long long index = CellIndex(x, y, z, lod);
+        if (index < 0) return nullptr;
+        const Cell& cell = m_levels[lod].cells[(size_t)index];
+        return (cell.key == ChunkKey(x, y, z, lod)) ? cell.node : nullptr;
+    }
+
+    bool HasOverflow() const { return m_overflowCount > 0; }
+    size_t GetOverflowCount() const { return m_overflowCount; }
+
+    // Memory used by the cell arrays (for the profiler window)
+    size_t GetMemoryBytes() const {
+        size_t bytes = 0;
+        for (const Level& level : m_levels) bytes += level.cells.size() * sizeof(Cell);
+        return bytes;
+    }
+
+private:
+    struct Cell {
+        int64_t key = -1;           // Only ChunkKey(-1, -1, -1, 7) hashes to -1, and y = -1 never gets a cell
+        ChunkNode* node = nullptr;
+    };
+
+    struct Level {
+        int size = 0;               // Power of two >= 2r + 5
+        int mask = 0;
+        int height = 0;
+        std::vector<Cell> cells;    // [y][z][x], x/z wrapped
+    };
+
+    // -1 if the coordinate is outside the LOD/height range
+    long long CellIndex(int x, int y, int z, int lod) const {
+        if (lod < 0 || lod >= (int)m_levels.size()) return -1;
+        const Level& level = m_levels[lod];
+        if (y < 0 || y >= level.height) return -1;
+        return (long long)(x & level.mask) + (long long)(z & level.mask) * level.size + (long long)y * level.size * level.size;
+    }
+
+    Cell* CellAt(int x, int y, int z, int lod) {
+        long long index = CellIndex(x, y, z, lod);
+        return (index < 0) ? nullptr : &m_levels[lod].cells[(size_t)index];
+    }
+
+    std::vector<Level> m_levels;
+    size_t m_overflowCount = 0;
+};
@@ -0,0 +1,204 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <mutex>
+#include <atomic>
+#include <fstream>
+#include <cstdint>
+#include <algorithm>
+#include <unordered_map>
+
+#include "chunkNode.h"
+#include "stb_image_write.h"
+
+// ================================================================================================
+//                                      CHUNK COST MAP
+// Per-chunk cost attribution for streaming stalls. The worker tasks record generation and meshing
+// time (and the quad count), the streaming step the VRAM the chunk draws from. Each chunk keeps its
+// latest sample. BuildColumns sums a metric over Y into a top-down grid per LOD (the heatmap in the
+// Engine Debug panel); WriteCsv / WriteHeatmapPng export the raw records / one heatmap.
+// Off by default: when disabled the tasks skip the clock reads and nothing is locked.
+// Thread-safe (workers, streaming step and UI), pure CPU code.
+// ================================================================================================
+
+enum class ChunkCostMetric : uint8_t { GENERATION_US, MESH_US, TOTAL_US, QUADS, VRAM_BYTES, COUNT };
+
+inline const char* ChunkCostMetricName(ChunkCostMetric metric) {
+    static const char* names[(size_t)ChunkCostMetric::COUNT] = {
+        "Generation (us)", "Meshing (us)", "Gen + Mesh (us)", "Quads", "VRAM (bytes)"
+    };
+    return names[(size_t)metric];
+}
+
+struct ChunkCostRecord {
+    int gridX = 0, gridY = 0, gridZ = 0, lod = 0;
+    float generationUs = 0.0f;
+    float meshUs = 0.0f;
+    uint32_t quads = 0;
+    uint64_t vramBytes = 0;
+    uint32_t samples = 0;       // Generations recorded (reloads overwrite the values)
+
+    double Value(ChunkCostMetric metric) const {
+        switch (metric) {
+            case ChunkCostMetric::GENERATION_US: return generationUs;
+            case ChunkCostMetric::MESH_US:       return meshUs;
+            case ChunkCostMetric::TOTAL_US:      return (double)generationUs + meshUs;
+            case ChunkCostMetric::QUADS:         return quads;
+            case ChunkCostMetric::VRAM_BYTES:    return (double)vramBytes;
+            default:                             return 0.0;
+        }
+    }
+};
+
+/**
+ * @brief Top-down grid of one LOD: cell (x, z) = sum over the chunk column, in LOD grid units.
+ */
+struct ChunkCostGrid {
+    int minX = 0, minZ = 0;
+    int width = 0, depth = 0;
+    std::vector<double> values;     // width * depth, row-major in z
+    std::vector<uint8_t> occupied;  // 1 if any chunk of the column was recorded
+    double maxValue = 0.0;
+
+    double At(int x, int z) const { return values[(size_t)z * width + x]; }
+    bool Has(int x, int z) const { return occupied[(size_t)z * width + x] != 0; }
+};
+
+/**
+ * @brief Heat ramp for t in [0, 1]: blue -> cyan -> green -> yellow -> red.
+ */
+inline void HeatColor(float t, uint8_t rgb[3]) {
+    t = std::clamp(t, 0.0f, 1.0f);
+    static const float stops[5][3] = { {0, 0, 1}, {0, 1, 1}, {0, 1, 0}, {1, 1, 0}, {1, 0, 0} };
+    float scaled = t * 4.0f;
+    int i = std::min((int)scaled, 3);
+    float f = scaled - (float)i;
+    for (int c = 0; c < 3; c++) rgb[c] = (uint8_t)((stops[i][c] + (stops[i + 1][c] - stops[i][c]) * f) * 255.0f + 0.5f);
+}
+
+class ChunkCostMap {
+public:
+    static constexpr size_t MAX_RECORDS = 1 << 18; // New chunks are dropped past this (Clear to restart)
+
+    void SetEnabled(bool enabled) { m_enabled.store(enabled, std::memory_order_relaxed); }
+    bool IsEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+    void RecordGeneration(const ChunkNode* node, float microseconds) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ChunkCostRecord* record = Find(node);
+        if (!record) return;
+        record->generationUs = microseconds;
+        record->samples++;
+    }
+
+    void RecordMesh(const ChunkNode* node, float microseconds, uint32_t quads) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ChunkCostRecord* record = Find(node);
+        if (!record) return;
+        record->meshUs = microseconds;
+        record->quads = quads;
+    }
+
+    void RecordVram(const ChunkNode* node, uint64_t bytes) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ChunkCostRecord* record = Find(node);
+        if (record) record->vramBytes = bytes;
+    }
+
+    void Clear() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_records.clear();
+        m_full = false;
+    }
+
+    size_t Size() const { std::lock_guard<std::mutex> lock(m_mutex); return m_records.size(); }
+    bool IsFull() const { std::lock_guard<std::mutex> lock(m_mutex); return m_full; }
+
+    /**
+     * @brief Sums metric over every recorded column of one LOD. Empty grid if the LOD has no records.
+     */
+    void BuildColumns(int lod, ChunkCostMetric metric, ChunkCostGrid& out) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        out = ChunkCostGrid();
+
+        int minX = INT32_MAX, minZ = INT32_MAX, maxX = INT32_MIN, maxZ = INT32_MIN;
+        for (const auto& pair : m_records) {
+            const ChunkCostRecord& r = pair.second;
+            if (r.lod != lod) continue;
+            minX = std::min(minX, r.gridX); maxX = std::max(maxX, r.gridX);
+            minZ = std::min(minZ, r.gridZ); maxZ = std::max(maxZ, r.gridZ);
+        }
+        if (minX > maxX) return;
+
+        out.minX = minX;
+        out.minZ = minZ;
+        out.width = maxX - minX + 1;
+        out.depth = maxZ - minZ + 1;
+        out.values.assign((size_t)out.width * out.depth, 0.0);
+        out.occupied.assign((size_t)out.width * out.depth, 0);
+
+        for (const auto& pair : m_records) {
+            const ChunkCostRecord& r = pair.second;
+            if (r.lod != lod) continue;
+            size_t cell = (size_t)(r.gridZ - minZ) * out.width + (r.gridX - minX);
+            out.values[cell] += r.Value(metric);
+            out.occupied[cell] = 1;
+        }
+        for (double v : out.values) out.maxValue = std::max(out.maxValue, v);
+    }
+
+    /**
+     * @brief Every record, one line each.
+     */
+    bool WriteCsv(const std::string& path) const {
+        std::ofstream file(path);
+        if (!file) return false;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        file << "lod,grid_x,grid_y,grid_z,generation_us,mesh_us,quads,vram_bytes,samples\n";
+        for (const auto& pair : m_records) {
+            const ChunkCostRecord& r = pair.second;
+            file << r.lod << ',' << r.gridX << ',' << r.gridY << ',' << r.gridZ << ','
+                 << r.generationUs << ',' << r.meshUs << ',' << r.quads << ',' << r.vramBytes << ',' << r.samples << '\n';
+        }
+        return (bool)file;
+    }
+
+    /**
+     * @brief One pixel per column (+X right, +Z down), heat ramp over [0, max], unrecorded columns black.
+     */
+    static bool WriteHeatmapPng(const ChunkCostGrid& grid, const std::string& path) {
+        if (grid.width == 0 || grid.depth == 0) return false;
+        std::vector<uint8_t> pixels((size_t)grid.width * grid.depth * 3, 0);
+        for (int z = 0; z < grid.depth; z++) {
+            for (int x = 0; x < grid.width; x++) {
+                if (!grid.Has(x, z)) continue;
+                float t = grid.maxValue > 0.0 ? (float)(grid.At(x, z) / grid.maxValue) : 0.0f;
+                HeatColor(t, &pixels[((size_t)z * grid.width + x) * 3]);
+            }
+        }
+        return stbi_write_png(path.c_str(), grid.width, grid.depth, 3, pixels.data(), grid.width * 3) != 0;
+    }
+
+private:
+    // Caller holds m_mutex. nullptr when the table is full.
+    ChunkCostRecord* Find(const ChunkNode* node) {
+        int64_t key = ChunkKey(node->gridX, node->gridY, node->gridZ, node->lodLevel);
+        auto it = m_records.find(key);
+        if (it != m_records.end()) return &it->second;
+        if (m_records.size() >= MAX_RECORDS) { m_full = true; return nullptr; }
+
+        ChunkCostRecord& record = m_records[key];
+        record.gridX = node->gridX;
+        record.gridY = node->gridY;
+        record.gridZ = node->gridZ;
+        record.lod = node->lodLevel;
+        return &record;
+    }
+
+    std::atomic<bool> m_enabled{ false };
+    mutable std::mutex m_mutex;
+    std::unordered_map<int64_t, ChunkCostRecord> m_records;
+    bool m_full = false;
+};
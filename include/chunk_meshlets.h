@@ -0,0 +1,168 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <glm/glm.hpp>
+
+#include "packedVertex.h"
+
+// ================================================================================================
+//                                      CHUNK MESHLETS
+// A chunk's opaque mesh split into clusters of up to MESHLET_MAX_QUADS quads, each with its own
+// chunk-local AABB and a mask of the face directions it contains. The culler tests these per
+// cluster, so a chunk that's 5% on screen no longer pays for 100% of its vertices.
+// The mesher emits quads face by face (+X, -X, +Y, -Y, +Z, -Z) and slice by slice, so consecutive
+// quads already share a normal and sit close together: a cluster is cut every 64 quads or whenever
+// the face direction changes. The face mask is the (axis aligned) normal cone - a cluster holding
+// only +X faces can't be seen from anywhere with x below its min.
+// Pure CPU code, no GL. CullMeshletsReference mirrors the compute shader's cluster test.
+// ================================================================================================
+
+constexpr uint32_t MESHLET_MAX_QUADS = 64;
+constexpr uint32_t MESHLET_VERTICES_PER_QUAD = 6;  // Two triangles, no index buffer
+
+/**
+ * @brief One cluster, 16 bytes. Mirrors MeshletGpuData in CULL_COMPUTE.glsl.
+ * Bounds are in chunk-local voxel units (0..CHUNK_SIZE), 8 bits per axis.
+ */
+struct ChunkMeshlet {
+    uint32_t firstVertex;   // Relative to the start of the chunk's opaque range
+    uint32_t vertexCount;
+    uint32_t boundsMin;     // x | y << 8 | z << 16 | faceMask << 24
+    uint32_t boundsMax;     // x | y << 8 | z << 16
+};
+static_assert(sizeof(ChunkMeshlet) == 16, "ChunkMeshlet must match the std430 layout in CULL_COMPUTE.glsl");
+static_assert(CHUNK_SIZE <= 255, "Meshlet bounds are stored in 8 bits per axis");
+
+inline glm::vec3 MeshletBoundsMin(const ChunkMeshlet& m) {
+    return glm::vec3((float)(m.boundsMin & 0xFF), (float)((m.boundsMin >> 8) & 0xFF), (float)((m.boundsMin >> 16) & 0xFF));
+}
+
+inline glm::vec3 MeshletBoundsMax(const ChunkMeshlet& m) {
+    return glm::vec3((float)(m.boundsMax & 0xFF), (float)((m.boundsMax >> 8) & 0xFF), (float)((m.boundsMax >> 16) & 0xFF));
+}
+
+inline uint32_t MeshletFaceMask(const ChunkMeshlet& m) { return m.boundsMin >> 24; }
+
+/**
+ * @brief Splits a mesh (6 vertices per quad, mesher order) into meshlets.
+ * @param out Cleared and refilled. Empty for an empty mesh.
+ */
+inline void BuildMeshlets(const PackedVertex* vertices, size_t vertexCount, std::vector<ChunkMeshlet>& out) {
+    out.clear();
+    size_t quadCount = vertexCount / MESHLET_VERTICES_PER_QUAD;
+    if (quadCount == 0) return;
+    out.reserve(quadCount / MESHLET_MAX_QUADS + 6);
+
+    uint32_t minX = ~0u, minY = ~0u, minZ = ~0u, maxX = 0, maxY = 0, maxZ = 0;
+    uint32_t faceMask = 0, currentFace = 0xFFFFFFFFu;
+    uint32_t quadsInCluster = 0;
+    uint32_t clusterStart = 0;
+
+    auto Flush = [&](uint32_t endVertex) {
+        if (quadsInCluster == 0) return;
+        ChunkMeshlet m;
+        m.firstVertex = clusterStart;
+        m.vertexCount = endVertex - clusterStart;
+        m.boundsMin = minX | (minY << 8) | (minZ << 16) | (faceMask << 24);
+        m.boundsMax = maxX | (maxY << 8) | (maxZ << 16);
+        out.push_back(m);
+        quadsInCluster = 0;
+        faceMask = 0;
+        minX = minY = minZ = ~0u;
+        maxX = maxY = maxZ = 0;
+        clusterStart = endVertex;
+    };
+
+    for (size_t q = 0; q < quadCount; q++) {
+        uint32_t first = (uint32_t)(q * MESHLET_VERTICES_PER_QUAD);
+        uint32_t face = (vertices[first].data >> PACKED_NORM_SHIFT) & 0x7;
+
+        if (quadsInCluster == MESHLET_MAX_QUADS || (quadsInCluster > 0 && face != currentFace)) Flush(first);
+
+        // The first triangle holds both opposite corners in either winding, that's the quad's box
+        for (uint32_t v = 0; v < 3; v++) {
+            uint32_t data = vertices[first + v].data;
+            uint32_t x = data & PACKED_COORD_MASK;
+            uint32_t y = (data >> PACKED_COORD_BITS) & PACKED_COORD_MASK;
+            uint32_t z = (data >> (PACKED_COORD_BITS * 2)) & PACKED_COORD_MASK;
+            minX = std::min(minX, x); maxX = std::max(maxX, x);
+            minY = std::min(minY, y); maxY = std::max(maxY, y);
+            minZ = std::min(minZ, z); maxZ = std::max(maxZ, z);
+        }
+        faceMask |= 1u << face;
+        currentFace = face;
+        quadsInCluster++;
+    }
+    Flush((uint32_t)(quadCount * MESHLET_VERTICES_PER_QUAD));
+}
+
+// ================================================================================================
+//                                  CPU REFERENCE CULLER
+// Same math as the cluster loop in CULL_COMPUTE.glsl (frustum planes for 0..1 clip depth, then the
+// face-direction test), for validating the GPU path and measuring cluster stats without a context.
+// ================================================================================================
+
+/**
+ * @brief Gribb/Hartmann planes (left, right, bottom, top, near, far), 0..1 depth like glClipControl.
+ */
+inline void ExtractFrustumPlanes(const glm::mat4& viewProj, glm::vec4 planes[6]) {
+    glm::mat4 m = glm::transpose(viewProj);
+    planes[0] = m[3] + m[0];
+    planes[1] = m[3] - m[0];
+    planes[2] = m[3] + m[1];
+    planes[3] = m[3] - m[1];
+    planes[4] = m[2];
+    planes[5] = m[3] - m[2];
+}
+
+inline bool IsBoxInFrustum(const glm::vec4 planes[6], glm::vec3 minPos, glm::vec3 maxPos) {
+    for (int i = 0; i < 6; i++) {
+        glm::vec3 p(planes[i].x >= 0.0f ? maxPos.x : minPos.x,
+                    planes[i].y >= 0.0f ? maxPos.y : minPos.y,
+                    planes[i].z >= 0.0f ? maxPos.z : minPos.z);
+        if (glm::dot(glm::vec4(p, 1.0f), planes[i]) < 0.0f) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Face directions of a world-space box that can face the camera (bit = face index, +X = 0 ... -Z = 5).
+ * A +X face on the plane x = p is front-facing only when camera.x > p, and every face plane of the
+ * cluster lies inside its box.
+ */
+inline uint32_t FrontFacingMask(glm::vec3 cameraPos, glm::vec3 minPos, glm::vec3 maxPos) {
+    uint32_t mask = 0;
+    if (cameraPos.x > minPos.x) mask |= 1u << 0;
+    if (cameraPos.x < maxPos.x) mask |= 1u << 1;
+    if (cameraPos.y > minPos.y) mask |= 1u << 2;
+    if (cameraPos.y < maxPos.y) mask |= 1u << 3;
+    if (cameraPos.z > minPos.z) mask |= 1u << 4;
+    if (cameraPos.z < maxPos.z) mask |= 1u << 5;
+    return mask;
+}
+
+inline bool IsMeshletVisible(const ChunkMeshlet& meshlet, glm::vec3 chunkOrigin, float scale,
+                             const glm::vec4 planes[6], glm::vec3 cameraPos) {
+    glm::vec3 minPos = chunkOrigin + MeshletBoundsMin(meshlet) * scale;
+    glm::vec3 maxPos = chunkOrigin + MeshletBoundsMax(meshlet) * scale;
+    if ((MeshletFaceMask(meshlet) & FrontFacingMask(cameraPos, minPos, maxPos)) == 0) return false;
+    return IsBoxInFrustum(planes, minPos, maxPos);
+}
+
+/**
+ * @brief Culls one chunk's meshlets. Returns the number of vertices that survive.
+ * @param visibleOut Optional, receives the indices of the surviving meshlets.
+ */
+inline size_t CullMeshletsReference(const std::vector<ChunkMeshlet>& meshlets, glm::vec3 chunkOrigin, float scale,
+                                    const glm::vec4 planes[6], glm::vec3 cameraPos,
+                                    std::vector<uint32_t>* visibleOut = nullptr) {
+    size_t vertices = 0;
+    for (uint32_t i = 0; i < (uint32_t)meshlets.size(); i++) {
+        if (!IsMeshletVisible(meshlets[i], chunkOrigin, scale, planes, cameraPos)) continue;
+        vertices += meshlets[i].vertexCount;
+        if (visibleOut) visibleOut->push_back(i);
+    }
+    return vertices;
+}
@@ -0,0 +1,376 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+#include "chunk.h"
+#include "chunkNode.h"
+#include "object_pool.h"
+
+// ================================================================================================
+//                                    CHUNK PAYLOAD STORE
+// Superflat worlds, open ocean and deep stone produce lots of non-uniform chunks whose padded voxel
+// arrays are byte-for-byte identical. Without this each one gets its own 39 KB Chunk, its own
+// meshing job and its own VRAM range.
+// After generation every non-uniform chunk is hashed (128 bit, see Hash()) and linked to a shared,
+// refcounted ChunkPayload:
+//   - voxels: one Chunk per distinct content. Matches are confirmed with memcmp while it's alive.
+//   - mesh:   the first node of a payload to upload publishes its VRAM ranges here, every later node
+//             skips meshing and points its culler entry at the same vertices. Vertices are chunk
+//             local, the per-chunk position/scale live in the culler's ChunkGpuData.
+// LOD > 0 chunks drop their voxels once uploaded, so the voxel copy can be gone while the mesh is
+// still shared; matches against such a payload rely on the full 128-bit hash.
+// SetBlock copies the voxels before writing (copy-on-write) and moves the node to retiredPayload,
+// which keeps the shared mesh alive until the node's own remesh is uploaded.
+// Link() runs on the worker threads, everything else in the streaming step (or the main thread between steps); the store mutex covers both.
+// ================================================================================================
+
+struct ContentKey {
+    uint64_t lo = 0, hi = 0;
+    bool operator==(const ContentKey& other) const { return lo == other.lo && hi == other.hi; }
+};
+
+struct ContentKeyHash {
+    size_t operator()(const ContentKey& key) const { return (size_t)(key.lo ^ (key.hi * 0x9E3779B97F4A7C15ULL)); }
+};
+
+struct ChunkPayload {
+    ContentKey key;
+    Chunk* voxels = nullptr;            // Shared voxel copy, owned by the payload. Null once no node reads it.
+    uint32_t refs = 0;                  // Nodes linked to this payload (payload or retiredPayload)
+    uint32_t voxelRefs = 0;             // Nodes whose voxelData points at voxels
+
+    // --- Shared mesh (valid once hasMesh) ---
+    bool hasMesh = false;
+    long long vramOffsetOpaque = -1;
+    long long vramOffsetTransparent = -1;
+    size_t vertexCountOpaque = 0;
+    size_t vertexCountTransparent = 0;
+    long long vramOffsetMeshlets = -1;
+    size_t meshletCount = 0;
+    uint64_t faceConnectivity = ~0ULL;
+    ChunkMeshBounds meshBounds;
+};
+
+class ChunkPayloadStore {
+public:
+    // VRAM ranges a released payload leaves behind. The store has no GL access, World frees them.
+    struct MeshRange {
+        long long offset = -1;
+        size_t bytes = 0;
+    };
+
+    struct Stats {
+        size_t linked = 0;          // Non-uniform chunks hashed since the last Clear()
+        size_t voxelHits = 0;       // ...that reused an existing voxel copy
+        size_t meshHits = 0;        // ...that draw a mesh another chunk uploaded
+        size_t liveRefs = 0;        // Nodes currently linked
+        size_t livePayloads = 0;    // Distinct payloads currently alive
+        size_t liveVoxelCopies = 0; // Payloads still holding a Chunk
+    };
+
+    void Init(ObjectPool<Chunk>* voxelPool) { m_voxelPool = voxelPool; }
+
+    /**
+     * @brief 128-bit content hash of the whole padded array (padding included: it affects the mesh).
+     * Two independent multiply/rotate lanes over 8-byte words, murmur3 finaliser on each.
+     */
+    static ContentKey Hash(const Chunk& chunk) {
+        const uint8_t* bytes = chunk.voxels;
+        const size_t size = sizeof(chunk.voxels);
+        uint64_t h1 = 0x243F6A8885A308D3ULL ^ size;
+        uint64_t h2 = 0x13198A2E03707344ULL;
+
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8) {
+            uint64_t word;
+            std::memcpy(&word, bytes + i, 8);
+            h1 = Rotl(h1 ^ (word * 0x87C37B91114253D5ULL), 27) * 5 + 0x52DCE729;
+            h2 = Rotl(h2 ^ (word * 0x4CF5AD432745937FULL), 31) * 5 + 0x38495AB5;
+        }
+        uint64_t tail = 0;
+        for (size_t shift = 0; i < size; i++, shift += 8) tail |= (uint64_t)bytes[i] << shift;
+        h1 ^= tail * 0x87C37B91114253D5ULL;
+        h2 ^= tail * 0x4CF5AD432745937FULL;
+
+        ContentKey key;
+        key.lo = Mix(h1 + h2);
+        key.hi = Mix(h2 ^ Rotl(h1, 17));
+        return key;
+    }
+
+    /**
+     * @brief Worker thread, right after generation. Links the node to the payload for its content.
+     * If an identical voxel copy exists, the node's own Chunk goes back to the pool and voxelData
+     * points at the shared one. Otherwise a new payload adopts the node's Chunk.
+     */
+    void Link(ChunkNode* node) {
+        if (!node->voxelData || node->isUniform) return;
+        ContentKey key = Hash(*node->voxelData);
+
+        Chunk* toRelease = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_linked++;
+
+            auto it = m_payloads.find(key);
+            if (it == m_payloads.end()) {
+                ChunkPayload* payload = new ChunkPayload();
+                payload->key = key;
+                payload->voxels = node->voxelData;
+                payload->refs = 1;
+                payload->voxelRefs = 1;
+                m_payloads.emplace(key, payload);
+                m_liveRefs++;
+                m_liveVoxelCopies++;
+                node->payload = payload;
+                return;
+            }
+
+            ChunkPayload* payload = it->second;
+            if (payload->voxels) {
+                // Hash matched and the copy is still around: confirm before sharing
+                if (std::memcmp(payload->voxels->voxels, node->voxelData->voxels, sizeof(Chunk)) != 0) return;
+                toRelease = node->voxelData;
+                node->voxelData = payload->voxels;
+                payload->voxelRefs++;
+                m_voxelHits++;
+            } else {
+                // Mesh-only payload (the copy was dropped): this node's array becomes the shared copy again
+                payload->voxels = node->voxelData;
+                payload->voxelRefs = 1;
+                m_liveVoxelCopies++;
+            }
+            payload->refs++;
+            m_liveRefs++;
+            node->payload = payload;
+        }
+        if (toRelease) m_voxelPool->Release(toRelease);
+    }
+
+    /**
+     * @brief The node no longer needs its voxels (LOD > 0 after upload). Frees the shared copy when
+     * nobody reads it anymore, the payload itself (and its mesh) stays.
+     */
+    void DropVoxels(ChunkNode* node) {
+        ChunkPayload* payload = node->payload;
+        if (!payload || !node->voxelData || node->voxelData != payload->voxels) return;
+
+        Chunk* toRelease = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (--payload->voxelRefs == 0) {
+                toRelease = payload->voxels;
+                payload->voxels = nullptr;
+                m_liveVoxelCopies--;
+            }
+        }
+        node->voxelData = nullptr;
+        if (toRelease) m_voxelPool->Release(toRelease);
+    }
+
+    /**
+     * @brief Copy-on-write before SetBlock touches the node's voxels. Gives the node a private copy
+     * and moves the link to retiredPayload (the shared mesh is still what the culler draws).
+     * @return false if the pool is out of chunks, the node is left untouched.
+     */
+    bool Detach(ChunkNode* node) {
+        ChunkPayload* payload = node->payload;
+        if (!payload) return true;
+
+        if (node->voxelData && node->voxelData == payload->voxels) {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (payload->voxelRefs == 1) {
+                // Last reader: take the copy instead of duplicating it (a mesher may still be reading it).
+                // The payload keeps its mesh and is matched by hash alone from now on.
+                payload->voxels = nullptr;
+                payload->voxelRefs = 0;
+                m_liveVoxelCopies--;
+            } else {
+                lock.unlock();
+                Chunk* copy = m_voxelPool->Acquire();
+                if (!copy) return false;
+                std::memcpy(copy->voxels, payload->voxels->voxels, sizeof(Chunk));
+                DropVoxels(node);
+                node->voxelData = copy;
+            }
+        }
+
+        // A node is only ever linked at generation, so it can't already have a retired payload here
+        node->payload = nullptr;
+        node->retiredPayload = payload;
+        return true;
+    }
+
+    /**
+     * @brief Streaming step, on upload: the first node to upload a payload's mesh hands its VRAM ranges
+     * over to the payload. From then on they're freed with the payload, not with the node.
+     */
+    void PublishMesh(ChunkNode* node) {
+        ChunkPayload* payload = node->payload;
+        if (!payload || payload->hasMesh) return;
+        payload->hasMesh = true;
+        node->ownsMesh = false;
+        payload->vramOffsetOpaque = node->vramOffsetOpaque;
+        payload->vramOffsetTransparent = node->vramOffsetTransparent;
+        payload->vertexCountOpaque = node->vertexCountOpaque;
+        payload->vertexCountTransparent = node->vertexCountTransparent;
+        payload->vramOffsetMeshlets = node->vramOffsetMeshlets;
+        payload->meshletCount = node->meshletCount;
+        payload->faceConnectivity = node->faceConnectivity.load();
+        payload->meshBounds = node->meshBounds;
+    }
+
+    /**
+     * @brief Points the node's VRAM handles at the payload's shared mesh (they're borrowed, never freed by the node).
+     */
+    void BorrowMesh(ChunkNode* node) {
+        ChunkPayload* payload = node->payload;
+        node->vramOffsetOpaque = payload->vramOffsetOpaque;
+        node->vramOffsetTransparent = payload->vramOffsetTransparent;
+        node->vertexCountOpaque = payload->vertexCountOpaque;
+        node->vertexCountTransparent = payload->vertexCountTransparent;
+        node->vramOffsetMeshlets = payload->vramOffsetMeshlets;
+        node->meshletCount = payload->meshletCount;
+        node->faceConnectivity = payload->faceConnectivity;
+        node->meshBounds = payload->meshBounds;
+        node->ownsMesh = false;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_meshHits++;
+    }
+
+    /**
+     * @brief Drops the node's links (payload and retiredPayload) and its shared voxels.
+     * Borrowed VRAM handles are reset on the node (owned ones are left for World::FreeNodeMesh).
+     * Ranges of payloads that died are appended to meshesToFree.
+     */
+    void Unlink(ChunkNode* node, std::vector<MeshRange>& meshesToFree) {
+        bool borrowed = !node->ownsMesh;
+        DropVoxels(node);
+
+        if (node->payload) {
+            Release(node->payload, meshesToFree);
+            node->payload = nullptr;
+        }
+        if (node->retiredPayload) {
+            Release(node->retiredPayload, meshesToFree);
+            node->retiredPayload = nullptr;
+        }
+
+        if (borrowed) {
+            node->vramOffsetOpaque = -1;
+            node->vramOffsetTransparent = -1;
+            node->vertexCountOpaque = 0;
+            node->vertexCountTransparent = 0;
+            node->vramOffsetMeshlets = -1;
+            node->meshletCount = 0;
+        }
+    }
+
+    /**
+     * @brief Releases only the retired link (the node's own remesh just replaced the shared mesh).
+     */
+    void ReleaseRetired(ChunkNode* node, std::vector<MeshRange>& meshesToFree) {
+        if (!node->retiredPayload) return;
+        Release(node->retiredPayload, meshesToFree);
+        node->retiredPayload = nullptr;
+    }
+
+    /**
+     * @brief Drops every payload (world reload). Nodes must already be unlinked or about to be released.
+     */
+    void Clear(std::vector<MeshRange>& meshesToFree) {
+        std::vector<Chunk*> toRelease;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto& pair : m_payloads) {
+                ChunkPayload* payload = pair.second;
+                if (payload->voxels) toRelease.push_back(payload->voxels);
+                AppendRanges(meshesToFree, payload);
+                delete payload;
+            }
+            m_payloads.clear();
+            m_linked = m_voxelHits = m_meshHits = 0;
+            m_liveRefs = m_liveVoxelCopies = 0;
+        }
+        for (Chunk* chunk : toRelease) m_voxelPool->Release(chunk);
+    }
+
+    // Restarts the cumulative counters (generator switch), live counts are untouched
+    void ResetCounters() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_linked = m_voxelHits = m_meshHits = 0;
+    }
+
+    Stats GetStats() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Stats stats;
+        stats.linked = m_linked;
+        stats.voxelHits = m_voxelHits;
+        stats.meshHits = m_meshHits;
+        stats.liveRefs = m_liveRefs;
+        stats.livePayloads = m_payloads.size();
+        stats.liveVoxelCopies = m_liveVoxelCopies;
+        return stats;
+    }
+
+    ~ChunkPayloadStore() {
+        // Chunks belong to the pool, which frees its pages itself
+        for (auto& pair : m_payloads) delete pair.second;
+    }
+
+private:
+    static uint64_t Rotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+    static uint64_t Mix(uint64_t k) {
+        k ^= k >> 33; k *= 0xFF51AFD7ED558CCDULL;
+        k ^= k >> 33; k *= 0xC4CEB9FE1A85EC53ULL;
+        k ^= k >> 33;
+        return k;
+    }
+
+    // The shared mesh's VRAM ranges (vertices and meshlet records live in the same heap)
+    static void AppendRanges(std::vector<MeshRange>& out, const ChunkPayload* payload) {
+        if (!payload->hasMesh) return;
+        if (payload->vramOffsetOpaque != -1)
+            out.push_back({ payload->vramOffsetOpaque, payload->vertexCountOpaque * sizeof(PackedVertex) });
+        if (payload->vramOffsetTransparent != -1)
+            out.push_back({ payload->vramOffsetTransparent, payload->vertexCountTransparent * sizeof(PackedVertex) });
+        if (payload->vramOffsetMeshlets != -1)
+            out.push_back({ payload->vramOffsetMeshlets, payload->meshletCount * sizeof(ChunkMeshlet) });
+    }
+
+    // Drops one ref. On the last one the payload dies and its mesh ranges go to meshesToFree.
+    bool Release(ChunkPayload* payload, std::vector<MeshRange>& meshesToFree) {
+        Chunk* toRelease = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_liveRefs--;
+            if (--payload->refs > 0) return false;
+
+            if (payload->voxels) {
+                toRelease = payload->voxels;
+                m_liveVoxelCopies--;
+            }
+            m_payloads.erase(payload->key);
+        }
+        if (toRelease) m_voxelPool->Release(toRelease);
+
+        AppendRanges(meshesToFree, payload);
+        delete payload;
+        return true;
+    }
+
+    ObjectPool<Chunk>* m_voxelPool = nullptr;
+    std::mutex m_mutex;
+    std::unordered_map<ContentKey, ChunkPayload*, ContentKeyHash> m_payloads;
+
+    size_t m_linked = 0;
+    size_t m_voxelHits = 0;
+    size_t m_meshHits = 0;
+    size_t m_liveRefs = 0;
+    size_t m_liveVoxelCopies = 0;
+};
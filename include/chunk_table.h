@@ -0,0 +1,84 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include "chunkNode.h"
+
+// ================================================================================================
+//                                      CHUNK HOT TABLE
+// Structure-of-arrays view of every tracked chunk, kept next to m_activeChunkMap.
+// The per-frame LOD scans only need key, grid position and LOD, so those live in dense parallel
+// arrays (21 bytes per chunk) instead of being read through a ChunkNode* that drags in mesh
+// vectors, AABBs and VRAM handles. The ChunkNode itself is the cold record; its pool address is
+// the stable handle, and nodes[] maps a dense row back to it.
+// Rows are swap-removed, so a node's row can move; ChunkNode::tableIndex always points at it.
+// Same locking as the map: written under the unique lock, read under the shared lock.
+// ================================================================================================
+
+constexpr uint32_t CHUNK_TABLE_INVALID = 0xFFFFFFFFu;
+
+struct ChunkHotTable {
+    // --- Hot (scanned every LOD pass) ---
+    std::vector<int64_t> keys;
+    std::vector<int32_t> gridX, gridY, gridZ;
+    std::vector<uint8_t> lod;
+
+    // --- Handle to cold data ---
+    std::vector<ChunkNode*> nodes;
+
+    size_t Size() const { return keys.size(); }
+
+    void Reserve(size_t count) {
+        keys.reserve(count);
+        gridX.reserve(count); gridY.reserve(count); gridZ.reserve(count);
+        lod.reserve(count);
+        nodes.reserve(count);
+    }
+
+    /**
+     * @brief Appends a row for a node that was just Reset() and inserted into the map.
+     */
+    void Add(ChunkNode* node) {
+        node->tableIndex = (uint32_t)keys.size();
+        keys.push_back(node->uniqueID);
+        gridX.push_back(node->gridX);
+        gridY.push_back(node->gridY);
+        gridZ.push_back(node->gridZ);
+        lod.push_back((uint8_t)node->lodLevel);
+        nodes.push_back(node);
+    }
+
+    /**
+     * @brief Removes a node's row by moving the last row into its slot. O(1).
+     */
+    void Remove(ChunkNode* node) {
+        uint32_t row = node->tableIndex;
+        if (row == CHUNK_TABLE_INVALID || row >= keys.size()) return;
+
+        size_t last = keys.size() - 1;
+        if (row != last) {
+            keys[row] = keys[last];
+            gridX[row] = gridX[last];
+            gridY[row] = gridY[last];
+            gridZ[row] = gridZ[last];
+            lod[row] = lod[last];
+            nodes[row] = nodes[last];
+            nodes[row]->tableIndex = row;
+        }
+
+        keys.pop_back();
+        gridX.pop_back(); gridY.pop_back(); gridZ.pop_back();
+        lod.pop_back();
+        nodes.pop_back();
+        node->tableIndex = CHUNK_TABLE_INVALID;
+    }
+
+    void Clear() {
+        for (ChunkNode* node : nodes) node->tableIndex = CHUNK_TABLE_INVALID;
+        keys.clear();
+        gridX.clear(); gridY.clear(); gridZ.clear();
+        lod.clear();
+        nodes.clear();
+    }
+};
@@ -0,0 +1,233 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+#include "chunk.h"
+#include "block_registry.h"
+
+// ================================================================================================
+//                                 CHUNK CONNECTIVITY / CAVE CULLING
+// Every meshed chunk stores a 6x6 face-to-face connectivity matrix: bit (a * 6 + b) is set if
+// you can walk from face a to face b through air/transparent cells inside the chunk.
+// A breadth-first walk from the camera chunk then only passes through chunks whose matrix
+// allows the entry->exit pair, which gives us a potentially visible set (PVS) that hides caves
+// behind solid ground without needing Hi-Z.
+// Depends only on the voxel storage (chunk.h) and the block registry, no OpenGL or glm, so it
+// runs headless on synthetic layouts (tests/chunk_visibility_test.cpp).
+// ================================================================================================
+
+// Face Order matches the mesher: 0=+X, 1=-X, 2=+Y, 3=-Y, 4=+Z, 5=-Z
+constexpr int CHUNK_FACE_COUNT = 6;
+constexpr uint64_t CONNECTIVITY_NONE = 0ULL;
+constexpr uint64_t CONNECTIVITY_ALL = (1ULL << (CHUNK_FACE_COUNT * CHUNK_FACE_COUNT)) - 1ULL;
+
+constexpr int FACE_DIR_X[CHUNK_FACE_COUNT] = { 1, -1, 0,  0, 0,  0 };
+constexpr int FACE_DIR_Y[CHUNK_FACE_COUNT] = { 0,  0, 1, -1, 0,  0 };
+constexpr int FACE_DIR_Z[CHUNK_FACE_COUNT] = { 0,  0, 0,  0, 1, -1 };
+
+inline int OppositeFace(int face) { return face ^ 1; }
+
+inline bool AreFacesConnected(uint64_t connectivity, int faceA, int faceB) {
+    return (connectivity >> (faceA * CHUNK_FACE_COUNT + faceB)) & 1ULL;
+}
+
+/**
+ * @brief Builds the symmetric connectivity matrix for every pair of faces in a touched-face mask.
+ * @param faceMask 6-bit mask of the faces one flood fill region reached.
+ */
+inline uint64_t ConnectivityFromFaceMask(uint8_t faceMask) {
+    uint64_t result = 0;
+    for (int a = 0; a < CHUNK_FACE_COUNT; a++) {
+        if (!(faceMask & (1u << a))) continue;
+        for (int b = 0; b < CHUNK_FACE_COUNT; b++) {
+            if (faceMask & (1u << b)) result |= 1ULL << (a * CHUNK_FACE_COUNT + b);
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Flood fills the non-opaque cells of a chunk's inner volume (padding excluded)
+ * and records which faces each connected region touches.
+ * Runs on the mesher thread right after MeshChunk, so it reuses thread-local scratch.
+ */
+inline uint64_t ComputeChunkConnectivity(const Chunk& chunk) {
+    constexpr int VOLUME = CHUNK_SIZE * CHUNK_SIZE * CHUNK_SIZE;
+    constexpr int LAST = CHUNK_SIZE - 1;
+
+    static thread_local std::vector<uint8_t> visited;
+    static thread_local std::vector<int> stack;
+    if (visited.size() != (size_t)VOLUME) {
+        visited.resize(VOLUME);
+        stack.reserve(VOLUME);
+    }
+    std::memset(visited.data(), 0, VOLUME);
+
+    // Local (unpadded) index: x fastest, then z, then y (same order as Chunk::GetIndex)
+    auto LocalIndex = [](int x, int y, int z) { return x + (z * CHUNK_SIZE) + (y * CHUNK_SIZE * CHUNK_SIZE); };
+
+    uint64_t connectivity = CONNECTIVITY_NONE;
+
+    for (int y = 0; y < CHUNK_SIZE; y++) {
+        for (int z = 0; z < CHUNK_SIZE; z++) {
+            for (int x = 0; x < CHUNK_SIZE; x++) {
+                int seed = LocalIndex(x, y, z);
+                if (visited[seed]) continue;
+                visited[seed] = 1;
+                if (IsOpaque(chunk.Get(x + PADDING, y + PADDING, z + PADDING))) continue;
+
+                // --- Flood fill one open region ---
+                uint8_t faceMask = 0;
+                stack.clear();
+                stack.push_back(seed);
+
+                while (!stack.empty()) {
+                    int idx = stack.back();
+                    stack.pop_back();
+
+                    int cx = idx % CHUNK_SIZE;
+                    int cz = (idx / CHUNK_SIZE) % CHUNK_SIZE;
+                    int cy = idx / (CHUNK_SIZE * CHUNK_SIZE);
+
+                    if (cx == LAST) faceMask |= 1u << 0;
+                    if (cx == 0)    faceMask |= 1u << 1;
+                    if (cy == LAST) faceMask |= 1u << 2;
+                    if (cy == 0)    faceMask |= 1u << 3;
+                    if (cz == LAST) faceMask |= 1u << 4;
+                    if (cz == 0)    faceMask |= 1u << 5;
+
+                    for (int f = 0; f < CHUNK_FACE_COUNT; f++) {
+                        int nx = cx + FACE_DIR_X[f];
+                        int ny = cy + FACE_DIR_Y[f];
+                        int nz = cz + FACE_DIR_Z[f];
+                        if (nx < 0 || nx > LAST || ny < 0 || ny > LAST || nz < 0 || nz > LAST) continue;
+
+                        int nIdx = LocalIndex(nx, ny, nz);
+                        if (visited[nIdx]) continue;
+                        visited[nIdx] = 1;
+                        if (IsOpaque(chunk.Get(nx + PADDING, ny + PADDING, nz + PADDING))) continue;
+                        stack.push_back(nIdx);
+                    }
+                }
+
+                connectivity |= ConnectivityFromFaceMask(faceMask);
+                if (connectivity == CONNECTIVITY_ALL) return connectivity; // Can't get any more open
+            }
+        }
+    }
+    return connectivity;
+}
+
+// ================================================================================================
+//                                    VISIBILITY TRAVERSAL
+// ================================================================================================
+
+/**
+ * @brief Breadth-first traversal over LOD 0 chunk cells, starting in the camera chunk.
+ * * A cell is entered through one face and may only be left through faces that its connectivity
+ * matrix links to the entry face. We also never step back against a direction we already
+ * travelled, which is what stops the search from leaking around corners into every cave.
+ * Visits are tracked per (cell, entry face): a cell that was a dead end from one side may
+ * still lead on when reached through another.
+ * Scratch memory is kept between frames so the per-frame cost is just the walk itself.
+ */
+class ChunkVisibilityGraph {
+public:
+    struct Cell { int x, y, z; };
+
+    /**
+     * @brief Walks the grid and fills the list of reachable (potentially visible) cells.
+     * @param camX, camY, camZ Camera chunk coordinates (LOD 0 grid).
+     * @param radius Horizontal search radius in chunks (usually lodRadius[0]).
+     * @param minY, maxY Inclusive vertical bounds of the chunk grid.
+     * @param getConnectivity Callable (x, y, z) -> uint64_t. Return CONNECTIVITY_ALL for
+     *        unknown/unloaded/air chunks so the result stays conservative.
+     * @return Reachable cells, camera cell first.
+     */
+    template <typename ConnectivityFn>
+    const std::vector<Cell>& Traverse(int camX, int camY, int camZ, int radius, int minY, int maxY, ConnectivityFn&& getConnectivity) {
+        m_visibleCells.clear();
+        if (radius < 0 || maxY < minY) return m_visibleCells;
+
+        m_width = radius * 2 + 1;
+        m_height = maxY - minY + 1;
+        m_originX = camX - radius;
+        m_originY = minY;
+        m_originZ = camZ - radius;
+
+        size_t cellCount = (size_t)m_width * m_width * m_height;
+        if (m_visited.size() < cellCount) m_visited.resize(cellCount);
+        std::fill(m_visited.begin(), m_visited.begin() + cellCount, 0);
+
+        // Camera outside the vertical range: start from the nearest layer instead
+        int startY = std::clamp(camY, minY, maxY);
+
+        m_queue.clear();
+        m_queue.push_back({ camX, startY, camZ, NO_ENTRY_FACE, 0 });
+        m_visited[DenseIndex(camX, startY, camZ)] = ALL_ENTRY_FACES; // Open to every face already
+
+        for (size_t head = 0; head < m_queue.size(); head++) {
+            const Step step = m_queue[head];
+            uint8_t& flags = m_visited[DenseIndex(step.x, step.y, step.z)];
+            if (!(flags & LISTED)) {
+                flags |= LISTED;
+                m_visibleCells.push_back({ step.x, step.y, step.z });
+            }
+
+            uint64_t connectivity = (step.entryFace == NO_ENTRY_FACE) ? CONNECTIVITY_ALL : getConnectivity(step.x, step.y, step.z);
+            if (connectivity == CONNECTIVITY_NONE) continue; // Solid: visible itself, but nothing behind it
+
+            for (int face = 0; face < CHUNK_FACE_COUNT; face++) {
+                // Never walk back against a direction we already took
+                if (step.travelledMask & (1u << OppositeFace(face))) continue;
+                if (step.entryFace != NO_ENTRY_FACE && !AreFacesConnected(connectivity, step.entryFace, face)) continue;
+
+                int nx = step.x + FACE_DIR_X[face];
+                int ny = step.y + FACE_DIR_Y[face];
+                int nz = step.z + FACE_DIR_Z[face];
+                if (!InBounds(nx, ny, nz)) continue;
+
+                uint8_t entryFace = (uint8_t)OppositeFace(face);
+                uint8_t& visited = m_visited[DenseIndex(nx, ny, nz)];
+                if (visited & (1u << entryFace)) continue;
+                visited |= 1u << entryFace;
+
+                m_queue.push_back({ nx, ny, nz, entryFace, (uint8_t)(step.travelledMask | (1u << face)) });
+            }
+        }
+        return m_visibleCells;
+    }
+
+    const std::vector<Cell>& GetVisibleCells() const { return m_visibleCells; }
+
+private:
+    static constexpr uint8_t NO_ENTRY_FACE = 0xFF;
+    static constexpr uint8_t ALL_ENTRY_FACES = (1u << CHUNK_FACE_COUNT) - 1u;
+    static constexpr uint8_t LISTED = 1u << CHUNK_FACE_COUNT;   // Already in m_visibleCells
+
+    struct Step {
+        int x, y, z;
+        uint8_t entryFace;      // Face of THIS cell we came in through
+        uint8_t travelledMask;  // Directions taken so far from the camera
+    };
+
+    bool InBounds(int x, int y, int z) const {
+        return x >= m_originX && x < m_originX + m_width &&
+               y >= m_originY && y < m_originY + m_height &&
+               z >= m_originZ && z < m_originZ + m_width;
+    }
+
+    size_t DenseIndex(int x, int y, int z) const {
+        return (size_t)(x - m_originX) + (size_t)(z - m_originZ) * m_width + (size_t)(y - m_originY) * m_width * m_width;
+    }
+
+    int m_width = 0, m_height = 0;
+    int m_originX = 0, m_originY = 0, m_originZ = 0;
+
+    std::vector<uint8_t> m_visited;     // Per cell: entry faces queued (bits 0-5) | LISTED
+    std::vector<Step> m_queue;
+    std::vector<Cell> m_visibleCells;
+};
@@ -56,11 +56,8 @@ public:
             int cy = (int)floor(m_targetWorldPos.y / size);
             int cz = (int)floor(m_targetWorldPos.z / size);
 
-            int64_t key = ChunkKey(cx, cy, cz, lod);
-
-            auto it = world.m_activeChunkMap.find(key);
-            if (it != world.m_activeChunkMap.end()) {
-                m_selectedNode = it->second;
+            if (ChunkNode* node = world.FindChunk(cx, cy, cz, lod)) {
+                m_selectedNode = node;
                 break; 
             }
         }
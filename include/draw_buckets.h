@@ -0,0 +1,103 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <glm/glm.hpp>
+
+// ================================================================================================
+//                                   DISTANCE-BUCKETED DRAW ORDER
+// The cull shader appends opaque draw commands through one atomic counter, so the MDI draws them in
+// whatever order the invocations happened to finish. With reverse-Z early depth only rejects what
+// lies behind something already drawn, so near-first order lets it discard most of the far geometry.
+// A full sort is too expensive; a handful of distance buckets is enough:
+//   cull    - each command gets its chunk's bucket (camera distance to the chunk AABB) and a local
+//             index from that bucket's atomic counter, written unsorted to a scratch buffer
+//   compact - prefix of the bucket counts gives every bucket's start, each command is copied to
+//             start + local index in the real indirect buffer
+// Order inside a bucket stays arbitrary. Buckets double in width: [0, base), [base, 2 base), ...
+// the last one is open-ended.
+// Pure CPU code, no GL. BinDrawsReference mirrors the two GPU passes, EmitOpaqueCommandsReference
+// the split budget that keeps the cull pass inside the opaque buffer.
+// ================================================================================================
+
+constexpr uint32_t DRAW_DISTANCE_BUCKETS = 8;     // Mirrors DRAW_DISTANCE_BUCKETS in CULL_COMPUTE.glsl / DRAW_BUCKET_COMPACT.glsl
+constexpr uint32_t DRAW_BUCKET_KEY_SHIFT = 28;    // Key = bucket << 28 | local index
+constexpr uint32_t DRAW_BUCKET_LOCAL_MASK = (1u << DRAW_BUCKET_KEY_SHIFT) - 1u;
+static_assert(DRAW_DISTANCE_BUCKETS <= (1u << (32 - DRAW_BUCKET_KEY_SHIFT)), "Bucket index must fit the key");
+
+/**
+ * @brief Distance from a point to an AABB (0 inside).
+ */
+inline float DistanceToBox(glm::vec3 point, glm::vec3 boxMin, glm::vec3 boxMax) {
+    glm::vec3 outside = glm::max(glm::max(boxMin - point, point - boxMax), glm::vec3(0.0f));
+    return glm::length(outside);
+}
+
+/**
+ * @brief Bucket of a distance, same math as DistanceBucket in CULL_COMPUTE.glsl.
+ */
+inline uint32_t DistanceBucket(float distance, float baseDistance) {
+    if (distance < baseDistance) return 0;
+    uint32_t bucket = (uint32_t)std::log2(distance / baseDistance) + 1u;
+    return std::min(bucket, DRAW_DISTANCE_BUCKETS - 1u);
+}
+
+/**
+ * @brief CPU version of cull + compact: commands in emission order with their chunk distances in,
+ * draw order out (order[drawIndex] = emission index).
+ * @param bucketCounts Optional, receives the per-bucket command counts.
+ */
+inline void BinDrawsReference(const std::vector<float>& distances, float baseDistance, std::vector<uint32_t>& order,
+                              uint32_t* bucketCounts = nullptr) {
+    uint32_t counts[DRAW_DISTANCE_BUCKETS] = {};
+    std::vector<uint32_t> keys(distances.size());
+
+    // Cull pass: bucket + local index from that bucket's counter
+    for (size_t i = 0; i < distances.size(); i++) {
+        uint32_t bucket = DistanceBucket(distances[i], baseDistance);
+        keys[i] = (bucket << DRAW_BUCKET_KEY_SHIFT) | counts[bucket]++;
+    }
+
+    // Compact pass: exclusive prefix of the counts, then scatter
+    uint32_t starts[DRAW_DISTANCE_BUCKETS];
+    uint32_t running = 0;
+    for (uint32_t b = 0; b < DRAW_DISTANCE_BUCKETS; b++) { starts[b] = running; running += counts[b]; }
+
+    order.assign(distances.size(), 0u);
+    for (size_t i = 0; i < keys.size(); i++) {
+        uint32_t bucket = keys[i] >> DRAW_BUCKET_KEY_SHIFT;
+        order[starts[bucket] + (keys[i] & DRAW_BUCKET_LOCAL_MASK)] = (uint32_t)i;
+    }
+
+    if (bucketCounts) std::copy(counts, counts + DRAW_DISTANCE_BUCKETS, bucketCounts);
+}
+
+/**
+ * @brief CPU version of the cull pass's opaque emission under the split budget (ReserveSplit in
+ * CULL_COMPUTE.glsl), for visible chunks taken in order. A chunk with n visible meshlets asks for
+ * n - 1 extra commands; if they don't fit in maxOpaqueCommands - maxChunks it draws one whole-range
+ * command instead. Chunks with no visible meshlet emit nothing.
+ * @param commandDistances Receives one chunk distance per emitted command, in emission order.
+ * @return Extra commands asked for in total (the GPU's split counter, see GpuCuller::GetClusterOverflow).
+ */
+inline uint32_t EmitOpaqueCommandsReference(const std::vector<uint32_t>& visibleMeshlets, const std::vector<float>& chunkDistances,
+                                            uint32_t maxChunks, uint32_t maxOpaqueCommands, std::vector<float>& commandDistances) {
+    uint32_t budget = maxOpaqueCommands - maxChunks;
+    uint32_t splitRequested = 0;
+    commandDistances.clear();
+    for (size_t i = 0; i < visibleMeshlets.size(); i++) {
+        uint32_t visible = visibleMeshlets[i];
+        if (visible == 0) continue;
+
+        bool split = true;
+        if (visible > 1) {
+            uint32_t used = splitRequested;
+            splitRequested += visible - 1;
+            split = used + (visible - 1) <= budget;
+        }
+        commandDistances.insert(commandDistances.end(), split ? visible : 1u, chunkDistances[i]);
+    }
+    return splitRequested;
+}
@@ -8,6 +8,7 @@
 struct RuntimeConfig {
     int lodCount = 4;                                           
     int lodRadius[12] = { 15, 15, 15, 15, 0, 0, 0, 0 , 0, 0, 0, 0};
+    int farFieldStartLod = 3;                                   // LODs from here on are heightfield tiles (>= lodCount = off, LOD 0 never)
     bool occlusionCulling = false;
     bool enableCaves = false; 
 
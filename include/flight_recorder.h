@@ -0,0 +1,344 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fstream>
+#include <algorithm>
+#include <cstdint>
+
+#include "metrics.h"
+#include "logger.h"
+
+// ================================================================================================
+//                                      FLIGHT RECORDER
+// Keeps the last seconds of scope events (every Profiler::ScopedTimer, on every thread, profiler on
+// or off) in a fixed ring, plus one sample per frame: frame time and every metrics gauge (queue
+// depths, pools, VRAM...). When a frame takes longer than the spike threshold, the window around it
+// (windowSeconds before, POST_WINDOW_SECONDS after) is copied out and written by a background thread
+// as a Chrome trace (open in chrome://tracing or ui.perfetto.dev): one track per thread, the frames
+// on the main track, the gauges as counter tracks, the hitch as a marker.
+// Recording a scope is a relaxed fetch_add and a few stores into a seqlocked slot: never locks, never
+// allocates. The per-frame gauge sample (main thread) takes the metrics registry's mutex, like any
+// other gauge reader. Only the dump allocates. Off until Start(), then ~3 MB for the event ring.
+// One dump is written at a time: spikes and requests while the writer is busy are skipped.
+// ================================================================================================
+
+namespace Engine {
+
+class FlightRecorder {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t EVENT_CAPACITY = 1 << 16;     // Power of two. Scope events kept
+    static constexpr size_t FRAME_CAPACITY = 2048;        // Frames kept (~14 s at 144 fps)
+    static constexpr size_t MAX_GAUGES = 48;              // Gauges sampled per frame (registration order)
+    static constexpr uint32_t MAX_THREADS = 64;           // Named threads (the rest are "Thread N")
+    static constexpr float POST_WINDOW_SECONDS = 1.0f;    // Recorded after the spike before dumping
+    static constexpr float COOLDOWN_SECONDS = 10.0f;      // No new spike dump this soon after the last one
+    static constexpr uint32_t MAX_DUMPS = 32;             // Per session, keeps a bad run from filling the disk
+
+    static FlightRecorder& Get() {
+        static FlightRecorder instance;
+        return instance;
+    }
+
+    /**
+     * @brief Starts recording. Dumps go to <pathPrefix>_<session>_<n>.json.
+     * @param spikeThresholdMs Frames longer than this trigger a dump.
+     * @param windowSeconds History written before the spike frame.
+     */
+    void Start(const std::string& pathPrefix, float spikeThresholdMs, float windowSeconds) {
+        m_pathPrefix = pathPrefix + "_" + std::to_string(
+            std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+        m_spikeThresholdMs = spikeThresholdMs;
+        m_windowNs = (int64_t)(windowSeconds * 1e9);
+        if (IsRecording()) return;
+
+        if (!m_events) m_events = std::make_unique<EventSlot[]>(EVENT_CAPACITY);
+        if (!m_frames) m_frames = std::make_unique<FrameSample[]>(FRAME_CAPACITY);
+        m_frameStartNs = -1;
+        m_recording.store(true, std::memory_order_release);
+        GOOSE_LOG_INFO("FlightRecorder", "Recording, frames over " << spikeThresholdMs << " ms dump the last "
+                                         << windowSeconds << " s to " << m_pathPrefix << "_*.json");
+    }
+
+    /**
+     * @brief Stops recording and waits for a dump still being written. Before exit.
+     */
+    void Shutdown() {
+        m_recording.store(false, std::memory_order_relaxed);
+        if (m_writer.joinable()) m_writer.join();
+    }
+
+    bool IsRecording() const { return m_recording.load(std::memory_order_acquire); }
+
+    // --- Recording (any thread) ---
+    void RecordScope(const char* name, Clock::time_point start, Clock::time_point end) {
+        uint64_t index = m_writeIndex.fetch_add(1, std::memory_order_relaxed);
+        EventSlot& slot = m_events[index & (EVENT_CAPACITY - 1)];
+        slot.sequence.store(index * 2 + 1, std::memory_order_relaxed); // Odd: being written
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.name.store(name, std::memory_order_relaxed);
+        slot.startNs.store(ToNs(start), std::memory_order_relaxed);
+        slot.endNs.store(ToNs(end), std::memory_order_relaxed);
+        slot.thread.store(ThreadIndex(), std::memory_order_relaxed);
+        slot.sequence.store(index * 2 + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Names the calling thread's track. name must outlive the recorder (a literal).
+     */
+    void NameCurrentThread(const char* name) {
+        uint32_t index = ThreadIndex();
+        if (index < MAX_THREADS) m_threadNames[index].store(name, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief RAII event for code that doesn't include the profiler (pure CPU headers).
+     */
+    struct Scope {
+        const char* name;
+        Clock::time_point start;
+        bool active;
+
+        explicit Scope(const char* name) : name(name), active(FlightRecorder::Get().IsRecording()) {
+            if (active) start = Clock::now();
+        }
+        ~Scope() {
+            if (active) FlightRecorder::Get().RecordScope(name, start, Clock::now());
+        }
+    };
+
+    // --- Main thread ---
+    /**
+     * @brief Closes the frame (Profiler::Update, top of the loop): samples the gauges, checks for a spike
+     * and, once the window after a spike has been recorded, hands the dump to the writer thread.
+     */
+    void EndFrame() {
+        if (!IsRecording()) return;
+        int64_t now = ToNs(Clock::now());
+        if (m_frameStartNs < 0) NameCurrentThread("Main");
+
+        if (m_frameStartNs >= 0) {
+            FrameSample& frame = m_frames[m_frameCount % FRAME_CAPACITY];
+            frame.startNs = m_frameStartNs;
+            frame.ms = (float)((now - m_frameStartNs) / 1e6);
+            frame.gaugeCount = (uint32_t)MetricsRegistry::Get().SampleGauges(frame.gauges, MAX_GAUGES);
+            m_frameCount++;
+
+            if (frame.ms > m_spikeThresholdMs && m_pendingSpikeNs < 0 && now >= m_cooldownUntilNs && m_dumpCount < MAX_DUMPS && !IsWriting()) {
+                m_pendingSpikeNs = frame.startNs;
+                m_pendingSpikeMs = frame.ms;
+                GOOSE_LOG_WARN("FlightRecorder", frame.ms << " ms frame, dumping in " << POST_WINDOW_SECONDS << " s");
+            }
+        }
+        m_frameStartNs = now;
+
+        if (m_pendingSpikeNs >= 0 && now - m_pendingSpikeNs >= (int64_t)(POST_WINDOW_SECONDS * 1e9)) {
+            Dump(now);
+        }
+    }
+
+    /**
+     * @brief Dumps the window ending POST_WINDOW_SECONDS from now, spike or not (UI button). Not cooled
+     * down, but ignored while the previous dump is still being written.
+     */
+    void RequestDump() {
+        if (!IsRecording() || m_pendingSpikeNs >= 0 || IsWriting()) return;
+        m_pendingSpikeNs = ToNs(Clock::now());
+        m_pendingSpikeMs = 0.0f;
+    }
+
+    float GetSpikeThresholdMs() const { return m_spikeThresholdMs; }
+    void SetSpikeThresholdMs(float ms) { m_spikeThresholdMs = ms; }
+    uint32_t GetDumpCount() const { return m_dumpCount; }
+    const std::string& GetLastDumpPath() const { return m_lastDumpPath; }
+    bool IsDumpPending() const { return m_pendingSpikeNs >= 0; }
+    bool IsWriting() const { return m_writing.load(std::memory_order_acquire); }
+
+private:
+    struct EventSlot {
+        std::atomic<uint64_t> sequence{ 0 };   // 2 * index + 2 once written, odd while writing, 0 never used
+        std::atomic<const char*> name{ nullptr };
+        std::atomic<int64_t> startNs{ 0 };
+        std::atomic<int64_t> endNs{ 0 };
+        std::atomic<uint32_t> thread{ 0 };
+    };
+
+    struct FrameSample {
+        int64_t startNs = 0;
+        float ms = 0.0f;
+        uint32_t gaugeCount = 0;
+        double gauges[MAX_GAUGES] = {};
+    };
+
+    struct TraceEvent {
+        const char* name;
+        int64_t startNs, endNs;
+        uint32_t thread;
+    };
+
+    // Everything the writer thread needs, copied out on the main thread
+    struct DumpData {
+        std::string path;
+        int64_t spikeNs = 0;
+        float spikeMs = 0.0f;
+        float thresholdMs = 0.0f;
+        bool truncated = false;                 // The event ring didn't reach back to the window start
+        uint32_t mainThread = 0;
+        std::vector<TraceEvent> events;
+        std::vector<FrameSample> frames;
+        std::vector<std::string> gaugeNames;
+        std::vector<std::string> threadNames;   // By thread index, empty = unnamed
+    };
+
+    FlightRecorder() = default;
+    ~FlightRecorder() { Shutdown(); }
+    FlightRecorder(const FlightRecorder&) = delete;
+    FlightRecorder& operator=(const FlightRecorder&) = delete;
+
+    int64_t ToNs(Clock::time_point t) const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(t - m_epoch).count();
+    }
+
+    uint32_t ThreadIndex() {
+        thread_local uint32_t index = m_nextThread.fetch_add(1, std::memory_order_relaxed);
+        return index;
+    }
+
+    void Dump(int64_t now) {
+        auto dump = std::make_unique<DumpData>();
+        int64_t windowStart = m_pendingSpikeNs - m_windowNs;
+        dump->path = m_pathPrefix + "_" + std::to_string(m_dumpCount) + ".json";
+        dump->spikeNs = m_pendingSpikeNs;
+        dump->spikeMs = m_pendingSpikeMs;
+        dump->thresholdMs = m_spikeThresholdMs;
+        dump->mainThread = ThreadIndex();
+
+        // Events: every written slot overlapping the window (torn slots, rewritten while copying, are skipped)
+        int64_t oldestStart = INT64_MAX;
+        for (size_t i = 0; i < EVENT_CAPACITY; i++) {
+            EventSlot& slot = m_events[i];
+            uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+            if (sequence == 0 || (sequence & 1)) continue;
+            TraceEvent event = { slot.name.load(std::memory_order_relaxed), slot.startNs.load(std::memory_order_relaxed),
+                                 slot.endNs.load(std::memory_order_relaxed), slot.thread.load(std::memory_order_relaxed) };
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) != sequence) continue;
+            oldestStart = std::min(oldestStart, event.startNs);
+            if (event.endNs >= windowStart && event.startNs <= now) dump->events.push_back(event);
+        }
+        dump->truncated = m_writeIndex.load(std::memory_order_relaxed) > EVENT_CAPACITY && oldestStart > windowStart;
+
+        size_t frameCount = std::min<uint64_t>(m_frameCount, FRAME_CAPACITY);
+        for (size_t i = 0; i < frameCount; i++) {
+            const FrameSample& frame = m_frames[(m_frameCount - frameCount + i) % FRAME_CAPACITY];
+            if (frame.startNs >= windowStart) dump->frames.push_back(frame);
+        }
+        dump->gaugeNames = MetricsRegistry::Get().GetGaugeNames();
+        for (uint32_t t = 0; t < MAX_THREADS; t++) {
+            const char* name = m_threadNames[t].load(std::memory_order_relaxed);
+            dump->threadNames.push_back(name ? name : "");
+        }
+
+        m_lastDumpPath = dump->path;
+        m_dumpCount++;
+        m_pendingSpikeNs = -1;
+        m_cooldownUntilNs = now + (int64_t)(COOLDOWN_SECONDS * 1e9);
+
+        // Nothing is armed while the writer is busy, so the previous thread is done or returning: no wait here
+        if (m_writer.joinable()) m_writer.join();
+        m_writing.store(true, std::memory_order_relaxed);
+        m_writer = std::thread([this, data = std::move(dump)]() {
+            WriteTrace(*data);
+            m_writing.store(false, std::memory_order_release);
+        });
+    }
+
+    static void WriteJsonString(std::ostream& out, const char* s) {
+        out << '"';
+        for (; s && *s; s++) {
+            if (*s == '"' || *s == '\\') out << '\\';
+            if ((unsigned char)*s >= 0x20) out << *s;
+        }
+        out << '"';
+    }
+
+    // Chrome trace event format, timestamps in microseconds
+    static void WriteTrace(const DumpData& dump) {
+        std::ofstream out(dump.path);
+        if (!out) {
+            GOOSE_LOG_WARN("FlightRecorder", "Could not write " << dump.path);
+            return;
+        }
+        out.precision(15);
+        out << "{\"displayTimeUnit\":\"ms\",\"otherData\":{\"spike_ms\":" << dump.spikeMs
+            << ",\"threshold_ms\":" << dump.thresholdMs << ",\"truncated\":" << (dump.truncated ? "true" : "false")
+            << "},\n\"traceEvents\":[\n";
+
+        bool first = true;
+        auto next = [&]() -> std::ostream& { out << (first ? "" : ",\n"); first = false; return out; };
+
+        std::vector<bool> seen(MAX_THREADS, false);
+        for (const TraceEvent& e : dump.events) if (e.thread < MAX_THREADS) seen[e.thread] = true;
+        if (dump.mainThread < MAX_THREADS) seen[dump.mainThread] = true;
+        for (uint32_t t = 0; t < MAX_THREADS; t++) {
+            if (!seen[t]) continue;
+            std::string name = dump.threadNames[t].empty() ? "Thread " + std::to_string(t) : dump.threadNames[t];
+            next() << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << t << ",\"args\":{\"name\":";
+            WriteJsonString(out, name.c_str());
+            out << "}}";
+        }
+
+        next() << "{\"name\":" << (dump.spikeMs > 0.0f ? "\"Hitch\"" : "\"Manual dump\"") << ",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":"
+               << dump.mainThread << ",\"ts\":" << dump.spikeNs / 1000.0 << ",\"args\":{\"frame_ms\":" << dump.spikeMs << "}}";
+
+        for (const FrameSample& frame : dump.frames) {
+            next() << "{\"name\":\"Frame\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":" << dump.mainThread
+                   << ",\"ts\":" << frame.startNs / 1000.0 << ",\"dur\":" << frame.ms * 1000.0 << "}";
+            for (uint32_t g = 0; g < frame.gaugeCount && g < dump.gaugeNames.size(); g++) {
+                next() << "{\"name\":";
+                WriteJsonString(out, dump.gaugeNames[g].c_str());
+                out << ",\"ph\":\"C\",\"pid\":1,\"ts\":" << frame.startNs / 1000.0 << ",\"args\":{\"value\":" << frame.gauges[g] << "}}";
+            }
+        }
+
+        for (const TraceEvent& e : dump.events) {
+            next() << "{\"name\":";
+            WriteJsonString(out, e.name);
+            out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << e.thread << ",\"ts\":" << e.startNs / 1000.0
+                << ",\"dur\":" << (e.endNs - e.startNs) / 1000.0 << "}";
+        }
+        out << "\n]}\n";
+        GOOSE_LOG_INFO("FlightRecorder", "Wrote " << dump.path << " (" << dump.events.size() << " events, "
+                                         << dump.frames.size() << " frames" << (dump.truncated ? ", window truncated" : "") << ")");
+    }
+
+    const Clock::time_point m_epoch = Clock::now();
+    std::atomic<bool> m_recording{ false };
+    std::atomic<uint64_t> m_writeIndex{ 0 };
+    std::atomic<uint32_t> m_nextThread{ 0 };
+    std::unique_ptr<EventSlot[]> m_events;
+    std::atomic<const char*> m_threadNames[MAX_THREADS] = {};
+    std::atomic<bool> m_writing{ false };   // Writer thread busy, cleared as its last step
+
+    // Main thread only
+    std::unique_ptr<FrameSample[]> m_frames;
+    uint64_t m_frameCount = 0;
+    int64_t m_frameStartNs = -1;
+    float m_spikeThresholdMs = 100.0f;
+    int64_t m_windowNs = 0;
+    int64_t m_pendingSpikeNs = -1;      // Start of the frame that triggered the dump being recorded, -1 = none
+    float m_pendingSpikeMs = 0.0f;
+    int64_t m_cooldownUntilNs = 0;
+    uint32_t m_dumpCount = 0;
+    std::string m_pathPrefix;
+    std::string m_lastDumpPath;
+    std::thread m_writer;
+};
+
+} // namespace Engine
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+
+#include "chunk_meshlets.h"
+
+// ================================================================================================
+//                                      PER-FRAME CONSTANTS
+// Everything the cull compute and the world vertex / fragment stages read per frame, in one std140
+// uniform block at binding 0 (FrameConstants in CULL_COMPUTE.glsl, VERT_UPGRADED.glsl and
+// FRAG_UPGRADED.glsl). World::Draw fills the camera part, GpuCuller::Cull the cull part and uploads
+// it once, before the cull dispatch. The frustum planes are extracted here, once, instead of in
+// every cull invocation.
+// ================================================================================================
+
+// Bits of FrameConstants::cullFlags, mirrored as CULL_FLAG_* in CULL_COMPUTE.glsl
+constexpr uint32_t CULL_FLAG_OCCLUSION        = 1u << 0;  // Test against u_DepthPyramid
+constexpr uint32_t CULL_FLAG_OCCLUDER_BOXES   = 1u << 1;  // u_DepthPyramid holds this frame's occluder boxes
+constexpr uint32_t CULL_FLAG_PVS              = 1u << 2;
+constexpr uint32_t CULL_FLAG_CLUSTERS         = 1u << 3;
+constexpr uint32_t CULL_FLAG_DISTANCE_BUCKETS = 1u << 4;
+
+/**
+ * @brief CPU image of the std140 block. Every member starts on its std140 offset, checked below.
+ */
+struct FrameConstants {
+    glm::mat4 viewProjection;           // Current frame (frustum test, vertex transform)
+    glm::mat4 prevViewProjection;       // Previous frame (depth reprojection)
+    glm::vec4 frustumPlanes[6];         // Left, Right, Bottom, Top, Near, Far (ExtractFrustumPlanes, 0..1 depth)
+    glm::vec3 cameraPos;                // Eye position (face-direction test, distance buckets, fog)
+    float bucketBaseDistance;           // Width of distance bucket 0
+    glm::vec4 projParams;               // proj[0][0], proj[1][1], zNear, zFar
+    glm::vec2 pyramidSize;              // Mip 0 of the bound depth pyramid
+    uint32_t maxChunks;
+    uint32_t maxOpaqueCommands;
+    uint32_t cullFlags;                 // CULL_FLAG_*
+    int32_t debugMode;                  // 0=Default, 1=Normals, 2=AO, 3=UVs
+    uint32_t pad0;
+    uint32_t pad1;
+};
+
+static_assert(offsetof(FrameConstants, frustumPlanes) == 128, "std140: frustumPlanes");
+static_assert(offsetof(FrameConstants, cameraPos) == 224, "std140: cameraPos");
+static_assert(offsetof(FrameConstants, bucketBaseDistance) == 236, "std140: vec3 + float share a slot");
+static_assert(offsetof(FrameConstants, projParams) == 240, "std140: projParams");
+static_assert(offsetof(FrameConstants, pyramidSize) == 256, "std140: pyramidSize");
+static_assert(offsetof(FrameConstants, cullFlags) == 272, "std140: cullFlags");
+static_assert(sizeof(FrameConstants) == 288, "Must match the FrameConstants uniform block");
+
+class FrameConstantsBuffer {
+public:
+    static constexpr GLuint BINDING = 0; // layout(std140, binding = 0) uniform FrameConstants
+
+    FrameConstantsBuffer() {
+        glCreateBuffers(1, &m_bufferId);
+        glNamedBufferStorage(m_bufferId, sizeof(FrameConstants), nullptr, GL_DYNAMIC_STORAGE_BIT);
+    }
+
+    ~FrameConstantsBuffer() {
+        glDeleteBuffers(1, &m_bufferId);
+    }
+
+    FrameConstantsBuffer(const FrameConstantsBuffer&) = delete;
+    FrameConstantsBuffer& operator=(const FrameConstantsBuffer&) = delete;
+
+    /**
+     * @brief Camera part of the block, including the frustum planes of viewProj.
+     */
+    void SetCamera(const glm::mat4& viewProj, const glm::mat4& prevViewProj, const glm::mat4& proj, const glm::vec3& cameraPos) {
+        m_data.viewProjection = viewProj;
+        m_data.prevViewProjection = prevViewProj;
+        ExtractFrustumPlanes(viewProj, m_data.frustumPlanes);
+        m_data.cameraPos = cameraPos;
+        m_data.projParams.x = proj[0][0];
+        m_data.projParams.y = proj[1][1];
+    }
+
+    FrameConstants& Data() { return m_data; }
+    const FrameConstants& Data() const { return m_data; }
+
+    /**
+     * @brief Copies the block to the GPU and binds it. Once per frame, before the first reader.
+     */
+    void Upload() {
+        glNamedBufferSubData(m_bufferId, 0, sizeof(FrameConstants), &m_data);
+        glBindBufferBase(GL_UNIFORM_BUFFER, BINDING, m_bufferId);
+    }
+
+    GLuint GetID() const { return m_bufferId; }
+
+private:
+    GLuint m_bufferId = 0;
+    FrameConstants m_data = {};
+};
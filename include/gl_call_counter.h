@@ -0,0 +1,252 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <atomic>
+#include <type_traits>
+#include <vector>
+#include <thread>
+#include <unordered_map>
+
+// ================================================================================================
+//                                      GL CALL COUNTER
+// Opt-in interception layer over the glad function pointers. Install() swaps every hooked
+// glad_glXxx for a wrapper that counts the call (and the bytes it moves, for uploads / copies)
+// and forwards to the original. Uninstall() puts the originals back; when not installed there is
+// no cost at all. Counts go to the current frame and to the innermost open scope (Profiler GPU
+// passes and render-thread CPU timers open one). EndFrame() latches them for the UI.
+// Render thread only: the only thread that makes GL calls. Needs no context, so stub function
+// pointers work as well as a driver.
+// ================================================================================================
+
+namespace Engine {
+
+enum class GlCallKind : uint8_t {
+    DRAW,       // glDraw* / glMultiDraw*
+    DISPATCH,   // glDispatchCompute*
+    UPLOAD,     // CPU -> GPU data (buffer sub data, flushes of the mapped heap, texture uploads)
+    COPY,       // GPU -> GPU copies and readbacks
+    UNIFORM,    // glUniform*
+    STATE,      // Binds and fixed-function state
+    SYNC,       // Barriers, fences, query results
+    QUERY,      // glGet* round trips
+    COUNT
+};
+
+inline const char* GlCallKindName(GlCallKind kind) {
+    static const char* names[(size_t)GlCallKind::COUNT] = {
+        "Draw", "Dispatch", "Upload", "Copy", "Uniform", "State", "Sync", "Query"
+    };
+    return names[(size_t)kind];
+}
+
+struct GlCallStats {
+    uint32_t calls = 0;
+    uint32_t byKind[(size_t)GlCallKind::COUNT] = {};
+    uint64_t uploadBytes = 0;
+    uint64_t copyBytes = 0;
+
+    void Add(GlCallKind kind, uint64_t bytes) {
+        calls++;
+        byKind[(size_t)kind]++;
+        if (kind == GlCallKind::UPLOAD) uploadBytes += bytes;
+        else if (kind == GlCallKind::COPY) copyBytes += bytes;
+    }
+
+    uint32_t Count(GlCallKind kind) const { return byKind[(size_t)kind]; }
+};
+
+class GlCallCounter {
+public:
+    static GlCallCounter& Get() {
+        static GlCallCounter instance;
+        return instance;
+    }
+
+    /**
+     * @brief Hooks the glad pointers (after gladLoadGL). The calling thread becomes the counted thread.
+     * Functions the loader didn't resolve stay null and unhooked.
+     */
+    void Install();
+    void Uninstall();
+    bool IsInstalled() const { return m_installed.load(std::memory_order_relaxed); }
+
+    // --- Called by the hooks ---
+    void Record(GlCallKind kind, uint64_t bytes) {
+        m_frame.Add(kind, bytes);
+        (m_scopeStack.empty() ? m_unscoped : *m_scopeStack.back()).Add(kind, bytes);
+    }
+
+    // --- Scopes (innermost wins). Ignored when not installed or off the render thread. ---
+    /**
+     * @return true if a scope was opened (then EndScope must follow).
+     */
+    bool BeginScope(const char* name) {
+        if (!m_installed.load(std::memory_order_relaxed) || std::this_thread::get_id() != m_thread) return false;
+        m_scopeStack.push_back(&m_scopes[name]);
+        return true;
+    }
+
+    void EndScope() {
+        if (!m_scopeStack.empty()) m_scopeStack.pop_back();
+    }
+
+    /**
+     * @brief Latches this frame's counts (GetLastFrame / GetLastScopes) and starts the next frame.
+     */
+    void EndFrame() {
+        if (!IsInstalled()) return;
+        m_lastFrame = m_frame;
+        m_frame = GlCallStats();
+
+        m_lastScopes.clear();
+        for (auto& [name, stats] : m_scopes) {
+            if (stats.calls > 0) m_lastScopes.emplace_back(name, stats);
+            stats = GlCallStats();
+        }
+        if (m_unscoped.calls > 0) m_lastScopes.emplace_back("(outside scopes)", m_unscoped);
+        m_unscoped = GlCallStats();
+        m_frameCount++;
+    }
+
+    const GlCallStats& GetLastFrame() const { return m_lastFrame; }
+    const std::vector<std::pair<std::string, GlCallStats>>& GetLastScopes() const { return m_lastScopes; }
+    uint64_t GetFrameCount() const { return m_frameCount; }
+    size_t GetHookCount() const { return m_hookCount; }
+
+private:
+    GlCallCounter() = default;
+    GlCallCounter(const GlCallCounter&) = delete;
+    GlCallCounter& operator=(const GlCallCounter&) = delete;
+
+    std::atomic<bool> m_installed{ false }; // Read by ScopedTimer on every thread
+    size_t m_hookCount = 0;
+    std::thread::id m_thread;
+
+    GlCallStats m_frame;
+    GlCallStats m_unscoped;
+    std::unordered_map<std::string, GlCallStats> m_scopes;
+    std::vector<GlCallStats*> m_scopeStack;
+
+    GlCallStats m_lastFrame;
+    std::vector<std::pair<std::string, GlCallStats>> m_lastScopes;
+    uint64_t m_frameCount = 0;
+};
+
+// ------------------------------------------------------------------------------------------------
+// Hooks: one wrapper per glad pointer, generated from its signature. SizeArg is the index of the
+// byte count argument (-1 = the call moves no countable bytes).
+// ------------------------------------------------------------------------------------------------
+template <auto* Slot, GlCallKind Kind, int SizeArg, typename Fn = std::remove_pointer_t<decltype(Slot)>>
+struct GlHook;
+
+template <auto* Slot, GlCallKind Kind, int SizeArg, typename R, typename... Args>
+struct GlHook<Slot, Kind, SizeArg, R (APIENTRYP)(Args...)> {
+    static inline R (APIENTRYP s_original)(Args...) = nullptr;
+
+    static R APIENTRY Call(Args... args) {
+        uint64_t bytes = 0;
+        if constexpr (SizeArg >= 0) bytes = (uint64_t)std::get<SizeArg>(std::forward_as_tuple(args...));
+        GlCallCounter::Get().Record(Kind, bytes);
+        return s_original(args...);
+    }
+
+    static bool Install() {
+        if (*Slot == nullptr || *Slot == &Call) return false;
+        s_original = *Slot;
+        *Slot = &Call;
+        return true;
+    }
+
+    static void Uninstall() {
+        if (*Slot == &Call) *Slot = s_original;
+    }
+};
+
+// Every hooked function: X(glad pointer, kind, byte count argument)
+#define GOOSE_GL_COUNTED_FUNCTIONS(X) \
+    X(glad_glDrawArrays,                    DRAW,     -1) \
+    X(glad_glDrawArraysInstanced,           DRAW,     -1) \
+    X(glad_glDrawElements,                  DRAW,     -1) \
+    X(glad_glDrawElementsInstanced,         DRAW,     -1) \
+    X(glad_glMultiDrawArraysIndirect,       DRAW,     -1) \
+    X(glad_glMultiDrawArraysIndirectCount,  DRAW,     -1) \
+    X(glad_glDispatchCompute,               DISPATCH, -1) \
+    X(glad_glDispatchComputeIndirect,       DISPATCH, -1) \
+    X(glad_glNamedBufferSubData,            UPLOAD,    2) \
+    X(glad_glBufferSubData,                 UPLOAD,    2) \
+    X(glad_glBufferData,                    UPLOAD,    1) \
+    X(glad_glFlushMappedNamedBufferRange,   UPLOAD,    2) \
+    X(glad_glTextureSubImage3D,             UPLOAD,   -1) \
+    X(glad_glCopyNamedBufferSubData,        COPY,      4) \
+    X(glad_glGetNamedBufferSubData,         COPY,      2) \
+    X(glad_glCopyImageSubData,              COPY,     -1) \
+    X(glad_glBlitNamedFramebuffer,          COPY,     -1) \
+    X(glad_glUniform1i,                     UNIFORM,  -1) \
+    X(glad_glUniform1ui,                    UNIFORM,  -1) \
+    X(glad_glUniform1f,                     UNIFORM,  -1) \
+    X(glad_glUniform2f,                     UNIFORM,  -1) \
+    X(glad_glUniform2fv,                    UNIFORM,  -1) \
+    X(glad_glUniform3f,                     UNIFORM,  -1) \
+    X(glad_glUniform3fv,                    UNIFORM,  -1) \
+    X(glad_glUniform4f,                     UNIFORM,  -1) \
+    X(glad_glUniform4fv,                    UNIFORM,  -1) \
+    X(glad_glUniformMatrix2fv,              UNIFORM,  -1) \
+    X(glad_glUniformMatrix3fv,              UNIFORM,  -1) \
+    X(glad_glUniformMatrix4fv,              UNIFORM,  -1) \
+    X(glad_glUseProgram,                    STATE,    -1) \
+    X(glad_glBindBuffer,                    STATE,    -1) \
+    X(glad_glBindBufferBase,                STATE,    -1) \
+    X(glad_glBindVertexArray,               STATE,    -1) \
+    X(glad_glBindTexture,                   STATE,    -1) \
+    X(glad_glActiveTexture,                 STATE,    -1) \
+    X(glad_glBindSampler,                   STATE,    -1) \
+    X(glad_glBindImageTexture,              STATE,    -1) \
+    X(glad_glBindFramebuffer,               STATE,    -1) \
+    X(glad_glEnable,                        STATE,    -1) \
+    X(glad_glDisable,                       STATE,    -1) \
+    X(glad_glDepthMask,                     STATE,    -1) \
+    X(glad_glDepthFunc,                     STATE,    -1) \
+    X(glad_glViewport,                      STATE,    -1) \
+    X(glad_glPolygonOffset,                 STATE,    -1) \
+    X(glad_glBlendFunc,                     STATE,    -1) \
+    X(glad_glMemoryBarrier,                 SYNC,     -1) \
+    X(glad_glFenceSync,                     SYNC,     -1) \
+    X(glad_glClientWaitSync,                SYNC,     -1) \
+    X(glad_glDeleteSync,                    SYNC,     -1) \
+    X(glad_glGetQueryObjectiv,              SYNC,     -1) \
+    X(glad_glGetQueryObjectui64v,           SYNC,     -1) \
+    X(glad_glFinish,                        SYNC,     -1) \
+    X(glad_glGetIntegerv,                   QUERY,    -1) \
+    X(glad_glGetBooleanv,                   QUERY,    -1) \
+    X(glad_glGetFloatv,                     QUERY,    -1) \
+    X(glad_glIsEnabled,                     QUERY,    -1) \
+    X(glad_glGetUniformLocation,            QUERY,    -1)
+
+inline void GlCallCounter::Install() {
+    if (IsInstalled()) return;
+    m_thread = std::this_thread::get_id();
+    m_hookCount = 0;
+#define GOOSE_GL_INSTALL_HOOK(fn, kind, sizeArg) \
+    if (GlHook<&fn, GlCallKind::kind, sizeArg>::Install()) m_hookCount++;
+    GOOSE_GL_COUNTED_FUNCTIONS(GOOSE_GL_INSTALL_HOOK)
+#undef GOOSE_GL_INSTALL_HOOK
+    m_frame = m_unscoped = GlCallStats();
+    m_scopeStack.clear();
+    m_installed = true;
+}
+
+inline void GlCallCounter::Uninstall() {
+    if (!IsInstalled()) return;
+#define GOOSE_GL_UNINSTALL_HOOK(fn, kind, sizeArg) \
+    GlHook<&fn, GlCallKind::kind, sizeArg>::Uninstall();
+    GOOSE_GL_COUNTED_FUNCTIONS(GOOSE_GL_UNINSTALL_HOOK)
+#undef GOOSE_GL_UNINSTALL_HOOK
+    m_scopeStack.clear();
+    m_installed = false;
+}
+
+} // namespace Engine
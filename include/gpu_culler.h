@@ -7,6 +7,9 @@
 #include <memory>
 #include <unordered_map>
 
+#include "draw_buckets.h"
+#include "frame_constants.h"
+
 // Forward Declarations
 class Shader;
 
@@ -17,7 +20,8 @@ class Shader;
 // Represents the static data of a chunk on the GPU.
 // Must be aligned to 16 bytes for std140/std430 layout compatibility.
 struct alignas(16) ChunkGpuData {
-    glm::vec4 minAABB_scale; // xyz: min bounds, w: scale
+    glm::vec4 origin_scale;  // xyz: chunk origin (vertex offset), w: scale
+    glm::vec4 minAABB_pad;   // xyz: min bounds of the emitted geometry, w: padding
     glm::vec4 maxAABB_pad;   // xyz: max bounds, w: padding
     
     // Opaque Mesh Range
@@ -27,15 +31,40 @@ struct alignas(16) ChunkGpuData {
     // Transparent Mesh Range
     uint32_t firstVertexTrans;
     uint32_t vertexCountTrans;
+
+    // Opaque mesh clusters (ChunkMeshlet records in the meshlet buffer). 0 = draw the whole range.
+    uint32_t firstMeshlet;
+    uint32_t meshletCount;
+    uint32_t pad0;
+    uint32_t pad1;
+};
+static_assert(sizeof(ChunkGpuData) == 80, "ChunkGpuData must match the std430 layout in CULL_COMPUTE.glsl");
+
+// A solid box (world space) rasterised into the occluder depth pyramid. See chunk_bounds.h.
+struct alignas(16) OccluderBox {
+    glm::vec4 minPos; // xyz: min corner, w: padding
+    glm::vec4 maxPos; // xyz: max corner, w: padding
 };
+static_assert(sizeof(OccluderBox) == 32, "OccluderBox must match the std430 layout in OCCLUDER_VERT.glsl");
+
+// Opaque draw commands reserved per chunk slot. Clusters turn one opaque draw per chunk into one per
+// visible meshlet: one command per chunk is always there, the rest is a shared split budget. A chunk
+// whose meshlet commands don't fit draws its whole range instead (counted in GetClusterOverflow()).
+constexpr size_t OPAQUE_COMMANDS_PER_CHUNK = 4;
 
 // Settings exposed to the UI (ImGui) to control culling behavior live.
 struct CullerSettings {
     float zNear = 0.1f;
     float zFar = 100000000.0f;   // Default: Infinite horizon
-    bool occlusionEnabled = false; // with new terrain systems, cant get this working, either second mesh or non-collidables are screwing it up
+    bool occlusionEnabled = true;
+    bool boxOccluders = true;    // Occlude with this frame's solid chunk boxes. Off: last frame's reprojected depth (leaks foliage/water, lags a frame)
+    int occluderRadius = 4;      // LOD 0 chunks around the camera (each axis) that can supply an occluder box
     bool freezeCulling = false;  // Stops the compute shader updates (locks visibility)
     float frustumPadding = 0.0f; // Expand/Contract frustum for debugging
+    bool caveCullingEnabled = true; // Skip LOD 0 chunks the CPU connectivity walk could not reach
+    bool clusterCullingEnabled = true; // Cull opaque meshes per meshlet (frustum + face direction)
+    bool distanceBuckets = true; // Emit opaque draws near to far in DRAW_DISTANCE_BUCKETS bins (see draw_buckets.h)
+    float bucketBaseDistance = 64.0f; // Width of the nearest bucket in blocks, each further one doubles
 };
 
 // ================================================================================================
@@ -56,18 +85,32 @@ public:
     
     // Uploads chunk metadata to the GPU.
     // If chunkID exists, updates it. If new, allocates a new slot.
+    // origin is where the chunk's vertices start, minAABB/maxAABB only bound what was emitted.
     uint32_t AddOrUpdateChunk(int64_t chunkID, 
+                              const glm::vec3& origin,
                               const glm::vec3& minAABB, 
                               const glm::vec3& maxAABB, 
                               float scale, 
                               size_t firstVertexOpaque, 
                               size_t vertexCountOpaque,
                               size_t firstVertexTrans,
-                              size_t vertexCountTrans);
+                              size_t vertexCountTrans,
+                              size_t firstMeshlet = 0,
+                              size_t meshletCount = 0);
     
     // Marks a slot as free and zeroes out the vertex count on the GPU to prevent drawing.
     void RemoveChunk(int64_t chunkID);
 
+    // Uploads the potentially visible set for this frame (LOD 0 chunk IDs reached by the
+    // connectivity traversal). LOD 0 slots not in the list are skipped, other LODs are untouched.
+    void SetPotentiallyVisibleSet(const std::vector<int64_t>& visibleChunkIDs);
+
+    // Disables the PVS test until the next SetPotentiallyVisibleSet call.
+    void ClearPotentiallyVisibleSet() { m_pvsActive = false; }
+
+    // Buffer holding the ChunkMeshlet records that firstMeshlet indexes (World uses its vertex heap).
+    void SetMeshletBuffer(GLuint buffer) { m_meshletBuffer = buffer; }
+
     // --------------------------------------------------------------------------------------------
     // FRAME PIPELINE
     // --------------------------------------------------------------------------------------------
@@ -75,18 +118,30 @@ public:
     // Step 1: Compute Shader - Downsample the depth buffer for Occlusion Culling.
     void GenerateHiZ(GLuint depthTexture, int width, int height);
 
-    // Step 2: Compute Shader - Determine which chunks are visible.
+    // Step 1b (settings.boxOccluders): Rasterises solid occluder boxes with THIS frame's matrix into a
+    // small depth target and builds its pyramid. The next Cull tests against it instead of the
+    // reprojected depth. At most MAX_OCCLUDER_BOXES are drawn, pass them sorted by priority.
+    void RenderOccluders(const std::vector<OccluderBox>& boxes, const glm::mat4& viewProj);
+
+    // Step 2: Compute Shader - Determine which chunks (and opaque meshlets) are visible.
     // Populates the Indirect Buffers and Atomic Counters.
-    void Cull(const glm::mat4& viewProj, 
-              const glm::mat4& prevViewProj, 
-              const glm::mat4& proj, 
-              GLuint depthTexture);
+    // frame must already hold the camera part (FrameConstantsBuffer::SetCamera). The cull part is
+    // filled in here and the block uploaded, so it is ready for the draws that follow.
+    void Cull(FrameConstantsBuffer& frame, GLuint depthTexture);
 
     // --------------------------------------------------------------------------------------------
     // GETTERS
     // --------------------------------------------------------------------------------------------
     
     uint32_t GetDrawCount() const { return m_drawnCount; }
+    uint32_t GetOpaqueCommandCount() const { return m_opaqueCommandCount; } // Opaque draws (meshlets + whole ranges)
+    uint32_t GetClusterOverflow() const { // Meshlet commands asked for past the split budget (merged back into whole ranges)
+        uint32_t budget = (uint32_t)(m_maxOpaqueCommands - m_maxChunks);
+        return m_splitCommandCount > budget ? m_splitCommandCount - budget : 0;
+    }
+    size_t GetMaxOpaqueCommands() const { return m_maxOpaqueCommands; }
+    uint32_t GetOccluderCount() const { return m_occluderCount; }       // Boxes drawn in the last occluder pass
+    const uint32_t* GetBucketCounts() const { return m_bucketCounts; }  // Opaque draws per distance bucket (last readback)
     CullerSettings& GetSettings() { return m_settings; }
     size_t GetMaxChunks() const { return m_maxChunks; }
 
@@ -94,13 +149,20 @@ public:
     GLuint GetIndirectOpaque() const { return m_indirectBufferOpaque; }
     GLuint GetIndirectTrans() const { return m_indirectBufferTrans; }
     GLuint GetVisibleChunkBuffer() const { return m_visibleChunkBuffer; }
-    GLuint GetAtomicCounter() const { return m_atomicCounterBuffer; }
+    GLuint GetAtomicCounter() const { return m_atomicCounterBuffer; } // [0] visible chunks, [4] opaque commands, [8] split commands
+    static constexpr GLintptr OPAQUE_COUNT_OFFSET = sizeof(GLuint);
+
+    static constexpr size_t MAX_OCCLUDER_BOXES = 1024;
+    static constexpr int OCCLUDER_TARGET_WIDTH = 512;   // The pyramid is addressed in NDC, so the aspect doesn't have to match
+    static constexpr int OCCLUDER_TARGET_HEIGHT = 256;
 
 private:
     // --------------------------------------------------------------------------------------------
     // INTERNAL HELPERS
     // --------------------------------------------------------------------------------------------
     void InitBuffers();
+    void InitOccluderTarget();
+    void DownsampleDepthPyramid(GLuint texture, int width, int height);
 
     // --------------------------------------------------------------------------------------------
     // STATE & SETTINGS
@@ -108,16 +170,27 @@ private:
     size_t m_maxChunks;
     CullerSettings m_settings;
     uint32_t m_drawnCount = 0;
+    uint32_t m_opaqueCommandCount = 0;
+    uint32_t m_splitCommandCount = 0;
+    uint32_t m_bucketCounts[DRAW_DISTANCE_BUCKETS] = {};
+    size_t m_maxOpaqueCommands;
 
     // Slot Management (allocating indices in the GPU array)
     std::unordered_map<int64_t, uint32_t> m_chunkSlots;
     std::stack<uint32_t> m_freeSlots;
 
+    // Potentially Visible Set (1 bit per slot)
+    std::vector<uint32_t> m_lodZeroSlotBits; // Slots currently holding a LOD 0 chunk
+    std::vector<uint32_t> m_pvsBits;         // Per-frame visibility bits uploaded to the GPU
+    bool m_pvsActive = false;
+
     // --------------------------------------------------------------------------------------------
     // RENDER RESOURCES
     // --------------------------------------------------------------------------------------------
     std::unique_ptr<Shader> m_cullShader;
     std::unique_ptr<Shader> m_hizShader;
+    std::unique_ptr<Shader> m_occluderShader;
+    std::unique_ptr<Shader> m_bucketCompactShader;
 
     // GPU Buffers (SSBOs)
     GLuint m_globalChunkBuffer = 0;   // Input: All chunk data
@@ -126,12 +199,28 @@ private:
     GLuint m_visibleChunkBuffer = 0;  // Output: IDs of visible chunks
     GLuint m_atomicCounterBuffer = 0; // Output: Count of visible chunks
     GLuint m_resultBuffer = 0;        // CPU-side copy of count (for UI)
+    GLuint m_pvsBuffer = 0;           // Input: Potentially visible set bits
+    GLuint m_meshletBuffer = 0;       // Input: ChunkMeshlet records (not owned)
+
+    // Distance Bucket Resources (settings.distanceBuckets)
+    GLuint m_scratchOpaque = 0;       // Cull output: opaque commands in emission order
+    GLuint m_bucketKeyBuffer = 0;     // Cull output: bucket << 28 | local index, per scratch command
+    GLuint m_bucketCountBuffer = 0;   // Cull output: commands per bucket
 
     // Hi-Z Resources
     int m_depthPyramidWidth = 0;
     int m_depthPyramidHeight = 0;
     GLuint m_depthSampler = 0; 
 
+    // Occluder Box Resources
+    GLuint m_occluderBoxBuffer = 0;   // Input: OccluderBox[MAX_OCCLUDER_BOXES]
+    GLuint m_occluderFbo = 0;
+    GLuint m_occluderDepthTex = 0;    // R32F with mips: depth written by the boxes, then the pyramid
+    GLuint m_occluderDepthRbo = 0;    // Depth test for the box pass
+    GLuint m_occluderVao = 0;         // Empty VAO for the attribute-less draw
+    uint32_t m_occluderCount = 0;
+    bool m_occludersReady = false;    // Set by RenderOccluders, consumed by the next Cull
+
     // Sync Object to prevent CPU stalls
     GLsync m_fence = nullptr;
 };
\ No newline at end of file
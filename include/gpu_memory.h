@@ -2,18 +2,42 @@
 #include <glad/glad.h>
 #include <vector>
 #include <map>
+#include <deque>
+#include <mutex>
+#include <utility>
 #include <iostream>
 #include <algorithm>
 #include <limits>
 #include <cstring> // Required for memcpy
+#include "logger.h"
+
+// ================================================================================================
+// Freed ranges are not reusable right away: the GPU may still be drawing commands queued in earlier
+// frames from them, and the next Upload() writes straight through the persistent map. Free() only
+// retires a range. The render thread closes the retired set behind a fence once per frame, after
+// that frame's draws (FenceRetired), and hands a bucket back to the free list after its fence has
+// signalled (ReclaimCompleted). Allocate() picks those up.
+// Threads: Allocate runs in the streaming step. Free, Upload, FenceRetired and ReclaimCompleted run
+// on the render thread (the step hands its frees over through the render snapshot, so a range is
+// only retired once the culler no longer draws it). The lists between them are guarded by m_retireMutex.
+// ================================================================================================
 
 class GpuMemoryManager {
+    struct Range { size_t offset, size; };
+    struct FencedBucket { GLsync fence; std::vector<Range> ranges; };
+
     GLuint m_bufferId;
     void* m_mappedPtr = nullptr; // Persistent CPU pointer to GPU memory
     size_t m_capacity;
     size_t m_used = 0;
     std::map<size_t, size_t> m_freeBlocks;
 
+    std::mutex m_retireMutex;
+    std::vector<Range> m_retiring;           // Freed since the last fence (guarded)
+    std::vector<Range> m_reclaimed;          // Fence signalled, waiting for Allocate() (guarded)
+    std::deque<FencedBucket> m_fenced;       // Render thread only, oldest first
+    size_t m_retiredBytes = 0;               // Retired but not back in the free list yet (guarded)
+
     static size_t AlignTo(size_t value, size_t alignment) {
         if (alignment == 0) return value;
         size_t remainder = value % alignment;
@@ -27,17 +51,20 @@ public:
         
         // PERSISTENT MAPPING SETUP
         // We ask for a buffer that we can write to (WRITE) while the GPU is using it (PERSISTENT).
-        // COHERENT means the GPU sees our writes automatically (no manual flush needed).
-        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        // Not COHERENT: Upload() flushes exactly the bytes it wrote (FLUSH_EXPLICIT), which lets the driver
+        // keep the mapping in write-combined memory without tracking every CPU write.
+        GLbitfield storageFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT;
+        GLbitfield mapFlags = storageFlags | GL_MAP_FLUSH_EXPLICIT_BIT;
         
-        glNamedBufferStorage(m_bufferId, m_capacity, nullptr, flags);
-        m_mappedPtr = glMapNamedBufferRange(m_bufferId, 0, m_capacity, flags);
+        glNamedBufferStorage(m_bufferId, m_capacity, nullptr, storageFlags);
+        m_mappedPtr = glMapNamedBufferRange(m_bufferId, 0, m_capacity, mapFlags);
         
         m_freeBlocks[0] = m_capacity;
-        std::cout << "[GpuMem] Allocated " << (sizeBytes / 1024 / 1024) << "MB Persistent VRAM" << std::endl;
+        GOOSE_LOG_INFO("GpuMem", "Allocated " << (sizeBytes / 1024 / 1024) << "MB Persistent VRAM");
     }
 
     ~GpuMemoryManager() {
+        for (FencedBucket& bucket : m_fenced) glDeleteSync(bucket.fence);
         if (m_mappedPtr) {
             glUnmapNamedBuffer(m_bufferId);
         }
@@ -46,6 +73,7 @@ public:
 
     // Best Fit Allocation Strategy
     long long Allocate(size_t rawSize, size_t alignment = 256) {
+        ReleaseReclaimed();
         size_t size = AlignTo(rawSize, 4); 
 
         auto bestIt = m_freeBlocks.end();
@@ -109,36 +137,54 @@ public:
         return -1; // VRAM Full
     }
 
+    /**
+     * @brief Render thread: retires a range nothing draws anymore. It becomes allocatable again once
+     * the fence of the frame it was retired in has signalled.
+     */
     void Free(size_t offset, size_t rawSize) {
-        size_t size = AlignTo(rawSize, 4); 
-        m_used -= size; 
-        
-        auto ret = m_freeBlocks.insert({offset, size});
-        auto it = ret.first;
+        size_t size = AlignTo(rawSize, 4);
+        std::lock_guard<std::mutex> lock(m_retireMutex);
+        m_retiring.push_back({ offset, size });
+        m_retiredBytes += size;
+    }
 
-        // Coalesce Right
-        auto nextIt = std::next(it);
-        if (nextIt != m_freeBlocks.end()) {
-            if (offset + size == nextIt->first) {
-                it->second += nextIt->second;
-                m_freeBlocks.erase(nextIt);
-            }
+    /**
+     * @brief Render thread, once per frame after its last draw from the heap: puts everything retired so far
+     * behind a fence that signals when all previously submitted GL commands (that frame's included) have finished.
+     */
+    void FenceRetired() {
+        std::vector<Range> ranges;
+        {
+            std::lock_guard<std::mutex> lock(m_retireMutex);
+            if (m_retiring.empty()) return;
+            ranges.swap(m_retiring);
         }
+        m_fenced.push_back({ glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), std::move(ranges) });
+    }
 
-        // Coalesce Left
-        if (it != m_freeBlocks.begin()) {
-            auto prevIt = std::prev(it);
-            if (prevIt->first + prevIt->second == it->first) {
-                prevIt->second += it->second;
-                m_freeBlocks.erase(it);
+    /**
+     * @brief Render thread: hands every bucket whose fence has signalled to Allocate(). Never blocks.
+     */
+    void ReclaimCompleted() {
+        while (!m_fenced.empty()) {
+            FencedBucket& bucket = m_fenced.front();
+            GLenum waitReturn = glClientWaitSync(bucket.fence, 0, 0);
+            if (waitReturn != GL_ALREADY_SIGNALED && waitReturn != GL_CONDITION_SATISFIED) break; // Later ones can't be done either
+            glDeleteSync(bucket.fence);
+            {
+                std::lock_guard<std::mutex> lock(m_retireMutex);
+                m_reclaimed.insert(m_reclaimed.end(), bucket.ranges.begin(), bucket.ranges.end());
             }
+            m_fenced.pop_front();
         }
     }
 
     // Calculates fragmentation as: 1.0 - (LargestFreeBlock / TotalFreeBytes)
     // 0.0 = Perfectly Defrogmented (One large block)
     // 1.0 = Highly Fragmented (Many small blocks)
-    float GetFragmentationRatio() const {
+    // Retired ranges don't count as free until they are reclaimed.
+    float GetFragmentationRatio() {
+        ReleaseReclaimed();
         if (m_freeBlocks.empty()) return 0.0f; // Either full or empty, but effectively 0 fragmentation
         
         size_t totalFree = m_capacity - m_used;
@@ -154,11 +200,12 @@ public:
         return 1.0f - (static_cast<float>(largestBlock) / static_cast<float>(totalFree));
     }
 
-    // NON-BLOCKING UPLOAD
+    // NON-BLOCKING UPLOAD (render thread)
     void Upload(size_t offset, const void* data, size_t rawSize) {
         if (m_mappedPtr) {
-            // Direct memory copy. No driver interaction. No stall.
+            // Direct memory copy, then publish exactly those bytes to the GPU. No stall.
             std::memcpy((uint8_t*)m_mappedPtr + offset, data, rawSize);
+            glFlushMappedNamedBufferRange(m_bufferId, (GLintptr)offset, (GLsizeiptr)rawSize);
         }
     }
 
@@ -166,4 +213,45 @@ public:
     size_t GetUsedMemory() const { return m_used; }
     size_t GetTotalMemory() const { return m_capacity; }
     size_t GetFreeBlockCount() const { return m_freeBlocks.size(); }
+    size_t GetRetiredBytes() { std::lock_guard<std::mutex> lock(m_retireMutex); return m_retiredBytes; }
+
+private:
+    /**
+     * @brief Moves reclaimed ranges into the free list (allocating side).
+     */
+    void ReleaseReclaimed() {
+        std::vector<Range> ranges;
+        {
+            std::lock_guard<std::mutex> lock(m_retireMutex);
+            if (m_reclaimed.empty()) return;
+            ranges.swap(m_reclaimed);
+            for (const Range& range : ranges) m_retiredBytes -= range.size;
+        }
+        for (const Range& range : ranges) InsertFreeBlock(range.offset, range.size);
+    }
+
+    void InsertFreeBlock(size_t offset, size_t size) {
+        m_used -= size; 
+        
+        auto ret = m_freeBlocks.insert({offset, size});
+        auto it = ret.first;
+
+        // Coalesce Right
+        auto nextIt = std::next(it);
+        if (nextIt != m_freeBlocks.end()) {
+            if (offset + size == nextIt->first) {
+                it->second += nextIt->second;
+                m_freeBlocks.erase(nextIt);
+            }
+        }
+
+        // Coalesce Left
+        if (it != m_freeBlocks.begin()) {
+            auto prevIt = std::prev(it);
+            if (prevIt->first + prevIt->second == it->first) {
+                prevIt->second += it->second;
+                m_freeBlocks.erase(it);
+            }
+        }
+    }
 };
\ No newline at end of file
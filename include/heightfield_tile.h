@@ -0,0 +1,183 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <climits>
+#include <algorithm>
+
+#include "chunk.h"
+#include "mesher.h"
+#include "block_registry.h"
+
+// ================================================================================================
+//                                  FAR-FIELD HEIGHTFIELD TILES
+// From RuntimeConfig::farFieldStartLod on, a chunk column is one 2.5D tile instead of a stack of
+// voxel chunks. The generator only fills the CHUNK_SIZE_PADDED^2 surface columns from its 2D maps
+// (no 34^3 voxel array, no uniform air/stone chunks above and below the surface), and the tile is
+// meshed as the same blocky surface a voxel chunk of that LOD shows: a top quad per column (merged
+// along rows), walls where neighbouring columns differ, and at the tile border a skirt that drops
+// HEIGHTFIELD_SKIRT_UNITS below the lower side so seams against other tiles/LODs never open up.
+// Heights are in LOD units (scale blocks) relative to the tile's base unit, so a tile fits the
+// PackedVertex coordinate range. Columns taller than that are clamped (only the rarest peaks, at
+// the first far-field LOD).
+// Pure CPU code, runs on the worker threads.
+// ================================================================================================
+
+/**
+ * @brief Surface of one terrain column, filled by ITerrainGenerator::GenerateSurfaceColumns.
+ */
+struct TerrainColumn {
+    int surfaceHeight = 0;                  // World Y of the highest opaque block
+    uint8_t surfaceBlock = Block::STONE;    // That block (top faces, top unit of walls)
+    uint8_t fillerBlock = Block::STONE;     // What's right under it (the rest of the walls)
+    uint8_t fluidBlock = Block::AIR;        // See-through fluid above the surface (water), AIR if dry
+    int fluidHeight = 0;                    // World Y of the highest fluid block
+};
+
+constexpr int HEIGHTFIELD_COLUMNS = CHUNK_SIZE_PADDED * CHUNK_SIZE_PADDED;
+constexpr int HEIGHTFIELD_SKIRT_UNITS = 2;
+
+inline int FloorDivide(int value, int divisor) {
+    return (value >= 0) ? value / divisor : -((-value + divisor - 1) / divisor);
+}
+
+/**
+ * @brief Top face of a column in LOD units. A voxel chunk samples y = k * scale and is solid while
+ * y <= height, so its top face sits one unit above the last sample.
+ */
+inline int ColumnTopUnits(int height, int scale) { return FloorDivide(height, scale) + 1; }
+
+/**
+ * @brief Lowest unit the tile's mesh reaches (skirts included). The tile's origin is base * scale.
+ */
+inline int ComputeHeightfieldBase(const TerrainColumn* columns, int scale) {
+    int minTop = INT_MAX;
+    for (int i = 0; i < HEIGHTFIELD_COLUMNS; i++) minTop = std::min(minTop, ColumnTopUnits(columns[i].surfaceHeight, scale));
+    return minTop - HEIGHTFIELD_SKIRT_UNITS;
+}
+
+/**
+ * @brief One quad in the mesher's face conventions (see PushFaceVertex / GreedyPassFace).
+ */
+template <int Axis, int Dir>
+inline void PushHeightfieldQuad(LinearAllocator<PackedVertex>& allocator, int u, int v, int w, int h, int slice, uint32_t texID) {
+    constexpr bool STANDARD_WINDING = (Dir == 1) != (Axis == 0);
+    auto PushVert = [&](int du, int dv) {
+        PushFaceVertex<Axis, Dir>(allocator, u + du, v + dv, slice, texID);
+    };
+    if constexpr (STANDARD_WINDING) {
+        PushVert(0, 0); PushVert(w, 0); PushVert(w, h);
+        PushVert(0, 0); PushVert(w, h); PushVert(0, h);
+    } else {
+        PushVert(0, 0); PushVert(w, h); PushVert(w, 0);
+        PushVert(0, 0); PushVert(0, h); PushVert(w, h);
+    }
+}
+
+/**
+ * @brief Side walls of one face direction (+X, -X, +Z or -Z), merged along the wall.
+ * A wall spans the column's own top down to the neighbour's, or down to the skirt at the tile border.
+ */
+template <int Axis, int Dir>
+inline void MeshHeightfieldWalls(const TerrainColumn* columns, const int* tops, LinearAllocator<PackedVertex>& allocator) {
+    static_assert(Axis == 0 || Axis == 2, "Heightfield walls are X or Z faces");
+    constexpr int FACE = Axis * 2 + (Dir == 1 ? 0 : 1);
+    constexpr int BORDER = (Dir == 1) ? CHUNK_SIZE - 1 : 0;
+
+    for (int slice = 0; slice < CHUNK_SIZE; slice++) {
+        // u runs along the wall: Z for X faces, X for Z faces (same remap as FaceVoxelIndex)
+        int runStart = 0, runBottom = 0, runTop = 0;
+        uint8_t runSurface = 0, runFiller = 0;
+        bool inRun = false;
+
+        auto Flush = [&](int runEnd) {
+            if (!inRun) return;
+            int width = runEnd - runStart;
+            // Top unit shows the surface block's side, everything below the filler
+            PushHeightfieldQuad<Axis, Dir>(allocator, runStart, runTop - 1, width, 1, slice, GetBlockTexture(runSurface, FACE));
+            if (runTop - 1 > runBottom) {
+                PushHeightfieldQuad<Axis, Dir>(allocator, runStart, runBottom, width, runTop - 1 - runBottom, slice, GetBlockTexture(runFiller, FACE));
+            }
+            inRun = false;
+        };
+
+        for (int u = 0; u < CHUNK_SIZE; u++) {
+            int x = (Axis == 0) ? slice : u;
+            int z = (Axis == 0) ? u : slice;
+            int self = (x + PADDING) + (z + PADDING) * CHUNK_SIZE_PADDED;
+            int other = (Axis == 0) ? self + Dir : self + Dir * CHUNK_SIZE_PADDED;
+
+            int top = tops[self];
+            int bottom = (slice == BORDER) ? std::max(0, std::min(top, tops[other]) - HEIGHTFIELD_SKIRT_UNITS) : tops[other];
+            if (bottom >= top) { Flush(u); continue; }
+
+            uint8_t surface = columns[self].surfaceBlock;
+            uint8_t filler = columns[self].fillerBlock;
+            if (inRun && top == runTop && bottom == runBottom && surface == runSurface && filler == runFiller) continue;
+
+            Flush(u);
+            inRun = true;
+            runStart = u; runBottom = bottom; runTop = top;
+            runSurface = surface; runFiller = filler;
+        }
+        Flush(CHUNK_SIZE);
+    }
+}
+
+/**
+ * @brief Top faces (+Y) of the inner columns at the given heights, merged along X rows.
+ * Columns whose height is <= floor (per column) emit nothing.
+ */
+inline void MeshHeightfieldTops(const int* tops, const int* floors, const uint8_t* blocks, LinearAllocator<PackedVertex>& allocator) {
+    for (int z = 0; z < CHUNK_SIZE; z++) {
+        int x = 0;
+        while (x < CHUNK_SIZE) {
+            int i = (x + PADDING) + (z + PADDING) * CHUNK_SIZE_PADDED;
+            if (tops[i] <= floors[i]) { x++; continue; }
+
+            int runEnd = x + 1;
+            while (runEnd < CHUNK_SIZE) {
+                int j = i + (runEnd - x);
+                if (tops[j] != tops[i] || tops[j] <= floors[j] || blocks[j] != blocks[i]) break;
+                runEnd++;
+            }
+            // Y faces map u -> Z, v -> X
+            PushHeightfieldQuad<1, 1>(allocator, z, x, 1, runEnd - x, tops[i] - 1, GetBlockTexture(blocks[i], 2));
+            x = runEnd;
+        }
+    }
+}
+
+/**
+ * @brief Meshes a tile of CHUNK_SIZE_PADDED^2 columns (padding ring = neighbour columns).
+ * Vertex Y is relative to baseUnits (see ComputeHeightfieldBase). Emitted face by face like MeshChunk,
+ * so BuildMeshlets sees the same runs of equal normals.
+ */
+inline void MeshHeightfieldTile(const TerrainColumn* columns, int scale, int baseUnits,
+                                LinearAllocator<PackedVertex>& allocatorOpaque,
+                                LinearAllocator<PackedVertex>& allocatorTrans) {
+    int tops[HEIGHTFIELD_COLUMNS];
+    int fluidTops[HEIGHTFIELD_COLUMNS];
+    uint8_t surfaceBlocks[HEIGHTFIELD_COLUMNS];
+    uint8_t fluidBlocks[HEIGHTFIELD_COLUMNS];
+
+    const int maxUnits = (int)PACKED_COORD_MASK;
+    for (int i = 0; i < HEIGHTFIELD_COLUMNS; i++) {
+        const TerrainColumn& column = columns[i];
+        tops[i] = std::clamp(ColumnTopUnits(column.surfaceHeight, scale) - baseUnits, 0, maxUnits);
+        surfaceBlocks[i] = column.surfaceBlock;
+        fluidBlocks[i] = column.fluidBlock;
+        fluidTops[i] = (column.fluidBlock != Block::AIR) ? std::clamp(ColumnTopUnits(column.fluidHeight, scale) - baseUnits, 0, maxUnits) : 0;
+    }
+
+    // Opaque: +X, -X, +Y, +Z, -Z (nothing ever looks at the underside of a far-field tile)
+    MeshHeightfieldWalls<0,  1>(columns, tops, allocatorOpaque);
+    MeshHeightfieldWalls<0, -1>(columns, tops, allocatorOpaque);
+    int noFloor[HEIGHTFIELD_COLUMNS] = {};
+    MeshHeightfieldTops(tops, noFloor, surfaceBlocks, allocatorOpaque);
+    MeshHeightfieldWalls<2,  1>(columns, tops, allocatorOpaque);
+    MeshHeightfieldWalls<2, -1>(columns, tops, allocatorOpaque);
+
+    // Transparent: the fluid's surface wherever it sits above the ground
+    MeshHeightfieldTops(fluidTops, tops, fluidBlocks, allocatorTrans);
+}
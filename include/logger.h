@@ -0,0 +1,312 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+// ================================================================================================
+//                                      ASYNC LOGGER
+// GOOSE_LOG_INFO("World", "Loaded " << count << " chunks") formats into a fixed buffer and pushes a
+// record into the calling thread's own ring: no lock, no allocation, no flush on the logging thread.
+// A background thread drains every ring every few ms, orders the records by time and writes
+// "[Tag] message" lines (INFO and below to stdout, WARN / ERROR to stderr) plus, after OpenFile(),
+// structured lines "<seconds> <LEVEL> T<thread> [Tag] message" to a log file.
+// - Compile-time filtering: levels below GOOSE_LOG_LEVEL (CMake option, default DEBUG) compile out.
+// - Rate limiting: each call site passes at most RATE_LIMIT_PER_SECOND lines per second, the
+//   rest are counted and reported on the next line the site gets through ("(+N suppressed)").
+// - A full ring drops the record and counts it, the writer reports the total.
+// Flush() drains on the calling thread (fatal paths); after Shutdown() lines are written directly.
+// ================================================================================================
+
+#define GOOSE_LOG_LEVEL_TRACE 0
+#define GOOSE_LOG_LEVEL_DEBUG 1
+#define GOOSE_LOG_LEVEL_INFO  2
+#define GOOSE_LOG_LEVEL_WARN  3
+#define GOOSE_LOG_LEVEL_ERROR 4
+
+#ifndef GOOSE_LOG_LEVEL
+#define GOOSE_LOG_LEVEL GOOSE_LOG_LEVEL_DEBUG
+#endif
+
+namespace Engine {
+
+enum class LogLevel : uint8_t { LEVEL_TRACE, LEVEL_DEBUG, LEVEL_INFO, LEVEL_WARN, LEVEL_ERROR };
+
+inline const char* LogLevelName(LogLevel level) {
+    static const char* names[] = { "TRACE", "DEBUG", "INFO ", "WARN ", "ERROR" };
+    return names[(size_t)level];
+}
+
+/**
+ * @brief Per call site rate limit state (a static inside the GOOSE_LOG macros).
+ */
+class LogSite {
+public:
+    static constexpr uint32_t RATE_LIMIT_PER_SECOND = 20;
+
+    bool Allow() {
+        int64_t second = std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        int64_t window = m_window.load(std::memory_order_relaxed);
+        if (second != window && m_window.compare_exchange_strong(window, second, std::memory_order_relaxed)) {
+            m_count.store(0, std::memory_order_relaxed);
+        }
+        if (m_count.fetch_add(1, std::memory_order_relaxed) < RATE_LIMIT_PER_SECOND) return true;
+        m_suppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    uint32_t TakeSuppressed() { return m_suppressed.exchange(0, std::memory_order_relaxed); }
+
+private:
+    std::atomic<int64_t> m_window{ -1 };
+    std::atomic<uint32_t> m_count{ 0 };
+    std::atomic<uint32_t> m_suppressed{ 0 };
+};
+
+class Logger {
+public:
+    static constexpr size_t MESSAGE_SIZE = 240;     // Longer messages are cut
+    static constexpr size_t RING_SIZE = 256;        // Records per thread, power of two
+    static constexpr int DRAIN_INTERVAL_MS = 5;
+
+    // Never destroyed: threads may still log during static destruction
+    static Logger& Get() {
+        static Logger* instance = new Logger();
+        return *instance;
+    }
+
+    // --- Used by the GOOSE_LOG macros ---
+    /**
+     * @brief Stream over the calling thread's message buffer, reset for a new message.
+     */
+    std::ostream& BeginMessage() {
+        ThreadState& state = GetThreadState();
+        state.buffer.Reset();
+        state.stream.clear();
+        state.stream.flags(std::ios_base::dec | std::ios_base::skipws);
+        state.stream.precision(6);
+        return state.stream;
+    }
+
+    void EndMessage(LogLevel level, const char* tag, LogSite& site) {
+        ThreadState& state = GetThreadState();
+        Record record;
+        record.timeNs = NowNs();
+        record.level = level;
+        record.thread = state.index;
+        record.tag = tag;
+        record.suppressed = site.TakeSuppressed();
+        record.length = (uint16_t)state.buffer.Length();
+        std::memcpy(record.text, state.buffer.Data(), record.length);
+
+        // Counted before looking at m_shutdown: Shutdown either sees this push in flight and waits for
+        // it before its last drain, or we see the shutdown and write directly (both seq_cst)
+        m_producers.fetch_add(1);
+        if (m_shutdown.load()) {
+            m_producers.fetch_sub(1, std::memory_order_release);
+            std::lock_guard<std::mutex> lock(m_drainMutex);
+            WriteRecord(record);
+            std::fflush(stdout);
+            return;
+        }
+
+        Ring& ring = *state.ring;
+        uint64_t head = ring.head.load(std::memory_order_relaxed);
+        if (head - ring.tail.load(std::memory_order_acquire) >= RING_SIZE) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            ring.records[head & (RING_SIZE - 1)] = record;
+            ring.head.store(head + 1, std::memory_order_release);
+        }
+        m_producers.fetch_sub(1, std::memory_order_release);
+    }
+
+    // --- Control ---
+    /**
+     * @brief Structured copy of every line to path (appends). Call early, from the main thread.
+     */
+    bool OpenFile(const std::string& path) {
+        std::lock_guard<std::mutex> lock(m_drainMutex);
+        if (m_file) std::fclose(m_file);
+        m_file = std::fopen(path.c_str(), "a");
+        return m_file != nullptr;
+    }
+
+    /**
+     * @brief Writes everything logged so far, on the calling thread.
+     */
+    void Flush() { Drain(); }
+
+    /**
+     * @brief Drains, stops the writer thread and closes the file. Later lines are written synchronously.
+     */
+    void Shutdown() {
+        if (m_shutdown.exchange(true)) return;
+        {
+            std::lock_guard<std::mutex> lock(m_wakeMutex);
+            m_exit = true;
+        }
+        m_wake.notify_all();
+        if (m_writer.joinable()) m_writer.join();
+        // Pushes that started before the flag was set land in the rings, the last drain must see them
+        while (m_producers.load() != 0) std::this_thread::yield();
+        Drain();
+        std::lock_guard<std::mutex> lock(m_drainMutex);
+        if (m_file) std::fclose(m_file);
+        m_file = nullptr;
+    }
+
+private:
+    struct Record {
+        int64_t timeNs;
+        LogLevel level;
+        uint32_t thread;
+        const char* tag;
+        uint32_t suppressed;
+        uint16_t length;
+        char text[MESSAGE_SIZE];
+    };
+
+    // Single producer (its thread), single consumer (whoever holds m_drainMutex)
+    struct Ring {
+        std::atomic<uint64_t> head{ 0 };
+        std::atomic<uint64_t> tail{ 0 };
+        Record records[RING_SIZE];
+    };
+
+    // Fixed buffer the per-thread stream formats into, excess is cut
+    class MessageBuffer : public std::streambuf {
+    public:
+        MessageBuffer() { Reset(); }
+        void Reset() { setp(m_data, m_data + MESSAGE_SIZE); }
+        size_t Length() const { return (size_t)(pptr() - pbase()); }
+        const char* Data() const { return m_data; }
+    protected:
+        int_type overflow(int_type) override { return traits_type::eof(); }
+    private:
+        char m_data[MESSAGE_SIZE];
+    };
+
+    struct ThreadState {
+        MessageBuffer buffer;
+        std::ostream stream{ &buffer };
+        Ring* ring = nullptr;
+        uint32_t index = 0;
+    };
+
+    Logger() : m_epoch(std::chrono::steady_clock::now()) {
+        m_writer = std::thread([this]() { WriterLoop(); });
+    }
+
+    int64_t NowNs() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_epoch).count();
+    }
+
+    // First message of a thread registers its ring (the only lock on the logging side)
+    ThreadState& GetThreadState() {
+        thread_local ThreadState state;
+        if (!state.ring) {
+            std::lock_guard<std::mutex> lock(m_ringsMutex);
+            m_rings.push_back(std::make_unique<Ring>());
+            state.ring = m_rings.back().get();
+            state.index = (uint32_t)m_rings.size();
+        }
+        return state;
+    }
+
+    void WriterLoop() {
+        std::unique_lock<std::mutex> lock(m_wakeMutex);
+        while (!m_exit) {
+            m_wake.wait_for(lock, std::chrono::milliseconds(DRAIN_INTERVAL_MS));
+            lock.unlock();
+            Drain();
+            lock.lock();
+        }
+    }
+
+    void Drain() {
+        std::lock_guard<std::mutex> lock(m_drainMutex);
+        m_pending.clear();
+        {
+            std::lock_guard<std::mutex> ringsLock(m_ringsMutex);
+            for (auto& ring : m_rings) {
+                uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+                uint64_t head = ring->head.load(std::memory_order_acquire);
+                for (; tail < head; tail++) m_pending.push_back(ring->records[tail & (RING_SIZE - 1)]);
+                ring->tail.store(tail, std::memory_order_release);
+            }
+        }
+        if (m_pending.empty() && m_dropped.load(std::memory_order_relaxed) == 0) return;
+
+        std::stable_sort(m_pending.begin(), m_pending.end(), [](const Record& a, const Record& b) { return a.timeNs < b.timeNs; });
+        for (const Record& record : m_pending) WriteRecord(record);
+
+        uint64_t dropped = m_dropped.exchange(0, std::memory_order_relaxed);
+        if (dropped > 0) std::fprintf(stderr, "[Log] %llu messages dropped (ring full)\n", (unsigned long long)dropped);
+        std::fflush(stdout);
+        if (m_file) std::fflush(m_file);
+    }
+
+    // Caller holds m_drainMutex
+    void WriteRecord(const Record& r) {
+        FILE* console = (r.level >= LogLevel::LEVEL_WARN) ? stderr : stdout;
+        int length = (int)r.length;
+        if (r.suppressed > 0) std::fprintf(console, "[%s] %.*s (+%u suppressed)\n", r.tag, length, r.text, r.suppressed);
+        else std::fprintf(console, "[%s] %.*s\n", r.tag, length, r.text);
+
+        if (!m_file) return;
+        std::fprintf(m_file, "%.6f %s T%u [%s] %.*s", r.timeNs / 1e9, LogLevelName(r.level), r.thread, r.tag, length, r.text);
+        if (r.suppressed > 0) std::fprintf(m_file, " (+%u suppressed)", r.suppressed);
+        std::fputc('\n', m_file);
+    }
+
+    const std::chrono::steady_clock::time_point m_epoch;
+    std::mutex m_ringsMutex;
+    std::vector<std::unique_ptr<Ring>> m_rings;
+    std::atomic<uint64_t> m_dropped{ 0 };
+    std::atomic<bool> m_shutdown{ false };
+    std::atomic<uint32_t> m_producers{ 0 };  // EndMessage calls that may still push into a ring
+
+    std::mutex m_drainMutex;                // One consumer at a time (writer thread or Flush)
+    std::vector<Record> m_pending;
+    FILE* m_file = nullptr;
+
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wake;
+    bool m_exit = false;
+    std::thread m_writer;
+};
+
+} // namespace Engine
+
+// ------------------------------------------------------------------------------------------------
+// Macros: message is a stream expression, tag a string literal (printed as "[tag]").
+// ------------------------------------------------------------------------------------------------
+#define GOOSE_LOG(levelValue, level, tag, message)                                              \
+    do {                                                                                        \
+        if constexpr ((levelValue) >= GOOSE_LOG_LEVEL) {                                        \
+            static ::Engine::LogSite gooseLogSite;                                              \
+            if (gooseLogSite.Allow()) {                                                         \
+                ::Engine::Logger::Get().BeginMessage() << message;                              \
+                ::Engine::Logger::Get().EndMessage(::Engine::LogLevel::LEVEL_##level, tag, gooseLogSite); \
+            }                                                                                   \
+        }                                                                                       \
+    } while (0)
+
+#define GOOSE_LOG_TRACE(tag, message) GOOSE_LOG(GOOSE_LOG_LEVEL_TRACE, TRACE, tag, message)
+#define GOOSE_LOG_DEBUG(tag, message) GOOSE_LOG(GOOSE_LOG_LEVEL_DEBUG, DEBUG, tag, message)
+#define GOOSE_LOG_INFO(tag, message)  GOOSE_LOG(GOOSE_LOG_LEVEL_INFO, INFO, tag, message)
+#define GOOSE_LOG_WARN(tag, message)  GOOSE_LOG(GOOSE_LOG_LEVEL_WARN, WARN, tag, message)
+#define GOOSE_LOG_ERROR(tag, message) GOOSE_LOG(GOOSE_LOG_LEVEL_ERROR, ERROR, tag, message)
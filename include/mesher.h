@@ -4,13 +4,17 @@
 #include <cstdint>
 #include <cmath>
 #include <cstring>
+#include <type_traits>
 
 #include "chunk.h"
 #include "packedVertex.h"
 #include "linearAllocator.h"
+#include "block_registry.h"
 
 // --- CONFIGURATION ---
-constexpr int PADDING = 1; 
+// One bit per column of a slice: 64^3 chunks need 64-bit masks, 16/32 fit in 32 bits
+using ChunkMask = std::conditional_t<(CHUNK_SIZE > 32), uint64_t, uint32_t>;
+constexpr int CHUNK_MASK_BITS = (int)(sizeof(ChunkMask) * 8);
 
 inline uint32_t ctz(uint32_t x) {
 #if defined(_MSC_VER)
@@ -20,206 +24,174 @@ inline uint32_t ctz(uint32_t x) {
 #endif
 }
 
-inline bool IsTransparent(uint8_t id) {
-    // SHOULD add leaves (14=Oak, 16=Pine) to transparent list.
-    // but i need to work on how its handled for occlusion, i really need to fix AABB tighening system because right now system sees entire tree as a 32x32x32 occluder which creates many false positive
-    return id == 6 || id == 7;
+inline uint32_t ctz(uint64_t x) {
+#if defined(_MSC_VER)
+    return (uint32_t)_tzcnt_u64(x);
+#else
+    return (uint32_t)__builtin_ctzll(x);
+#endif
 }
 
-inline bool IsOpaque(uint8_t id) {
-    return id != 0 && !IsTransparent(id);
+// ================================================================================================
+//                                    FACE KERNELS
+// Each of the 6 faces is its own template instance, so axis/direction are compile-time constants:
+// the coordinate remap, the neighbor offset and the winding choice all fold away. Voxel reads go
+// through the chunk layout's Index(), which for the linear layout reduces to plain stride arithmetic.
+// Face Order: 0=+X (Right), 1=-X (Left), 2=+Y (Top), 3=-Y (Bottom), 4=+Z (Front), 5=-Z (Back)
+// ================================================================================================
+
+// Maps face-local padded coords (U = column/horizontal, V = row/vertical, W = slice/normal) to a voxel index.
+// Axis 0 Fix: u maps to Z, v maps to Y so vertical textures (logs) stand up correctly on X-faces.
+template <int Axis>
+constexpr int FaceVoxelIndex(int u, int v, int w) {
+    using Layout = Chunk::LayoutType;
+    if constexpr (Axis == 0)      return Layout::Index(w, v, u);
+    else if constexpr (Axis == 1) return Layout::Index(v, w, u);
+    else                          return Layout::Index(u, v, w);
 }
 
-inline void MeshChunk(const Chunk& chunk, 
-                      LinearAllocator<PackedVertex>& allocatorOpaque, 
-                      LinearAllocator<PackedVertex>& allocatorTrans,
-                      bool debug = false) 
-{
-    // Helper to safely get block from chunk including padding.
-    // Returns 0 (Air) if the padding index is out of valid bounds or uninitialized assumption.
-    auto GetBlock = [&](int x, int y, int z) -> uint8_t {
-        if (x < 0 || x >= CHUNK_SIZE_PADDED || 
-            y < 0 || y >= CHUNK_SIZE_PADDED || 
-            z < 0 || z >= CHUNK_SIZE_PADDED) return 0;
-        return chunk.Get(x, y, z);
-    };
+template <int Axis, int Dir>
+inline void PushFaceVertex(LinearAllocator<PackedVertex>& allocator, int u, int v, int slice, uint32_t texID) {
+    constexpr int FACE = Axis * 2 + (Dir == 1 ? 0 : 1);
+    constexpr int W_OFFSET = (Dir == 1) ? 1 : 0; // Positive faces sit on the far side of the voxel
 
-    // --- TEXTURE MAPPING LOGIC ---
-    // Maps (Block ID + Face Direction) -> Texture Layer ID
-    // Face Order: 0=+X (Right), 1=-X (Left), 2=+Y (Top), 3=-Y (Bottom), 4=+Z (Front), 5=-Z (Back)
-    auto GetTextureID = [&](uint8_t blockID, int face) -> uint32_t {
-        
-        // Example: Grass Block (ID 1)
-        if (blockID == 1) {
-            if (face == 2) return 1;      // Top: Green Grass (Texture ID 1)
-            if (face == 3) return 2;      // Bottom: Dirt (Texture ID 2)
-            return 3;                     // Sides: Grass Side (Texture ID 3)
-        }
+    float vx, vy, vz;
+    if constexpr (Axis == 0)      { vx = (float)(slice + W_OFFSET); vy = (float)v; vz = (float)u; }
+    else if constexpr (Axis == 1) { vx = (float)v; vy = (float)(slice + W_OFFSET); vz = (float)u; }
+    else                          { vx = (float)u; vy = (float)v; vz = (float)(slice + W_OFFSET); }
 
-        // Example: Oak Log (ID 13)
-        if (blockID == 13) {
-            if (face == 2 || face == 3) return 25; // Top/Bottom: Log Rings (Example ID)
-            return 13;                             // Sides: Log Bark (Example ID)
-        }
+    allocator.Push(PackedVertex(vx, vy, vz, (float)FACE, 1.0f, texID));
+}
+
+/**
+ * @brief Greedy merges the visible-face bitmasks of one slice into quads.
+ * @param colMasks One ChunkMask per row (bit = column has a visible face). Consumed in place.
+ */
+template <int Axis, int Dir>
+inline void GreedyPassFace(ChunkMask* colMasks, const Chunk& chunk, LinearAllocator<PackedVertex>& targetAllocator, int slice) {
+    constexpr int FACE = Axis * 2 + (Dir == 1 ? 0 : 1);
+
+    // Axis 0 requires winding flip because we swapped U/V mapping (Right-Hand Rule)
+    constexpr bool STANDARD_WINDING = (Dir == 1) != (Axis == 0);
 
-        // Default: If no special case, the Texture ID is the same as the Block ID
-        return blockID;
+    // Works in local 0..CHUNK_SIZE-1 space, PADDING shifts into the padded array
+    auto GetBlockID = [&chunk, slice](int u, int v) -> uint8_t {
+        return chunk.voxels[FaceVoxelIndex<Axis>(u + PADDING, v + PADDING, slice + PADDING)];
     };
 
-    auto GreedyPass = [&](uint32_t* colMasks, LinearAllocator<PackedVertex>& targetAllocator, int face, int axis, int direction, int slice) {
-        // 2D -> 3D Coordinate Mapping Helper
-        auto GetBlockID = [&](int u_chk, int v_chk) {
-            int bx, by, bz;
-            // Axis 0 Fix: Map u->Z, v->Y to prevent 90 degree rotation
-            if (axis == 0)      { bx = slice; by = v_chk; bz = u_chk; } 
-            else if (axis == 1) { bx = v_chk; by = slice; bz = u_chk; } 
-            else                { bx = u_chk; by = v_chk; bz = slice; } 
-            // Note: passing PADDING here because GetBlockID is working in local 0..31 space
-            return GetBlock(bx + PADDING, by + PADDING, bz + PADDING);
-        };
-
-        // i iterates the 'row' (Vertical axis of the 2D plane)
-        for (int i = 0; i < CHUNK_SIZE; i++) {
-            uint32_t mask = colMasks[i];
-            
-            while (mask != 0) {
-                int widthStart = ctz(mask); 
-                int widthEnd = widthStart;
-                int u = widthStart; 
-                int v = i;
-                
-                uint32_t currentBlock = GetBlockID(u, v);
-
-                // 1. Compute Width
-                while (widthEnd < CHUNK_SIZE && (mask & (1ULL << widthEnd))) {
-                    if (GetBlockID(widthEnd, v) != currentBlock) break;
-                    widthEnd++;
-                }
-                int width = widthEnd - widthStart;
-                
-                uint32_t runMask = (width >= 32) ? 0xFFFFFFFFu : (uint32_t)(((1ULL << width) - 1ULL) << widthStart);
-
-                // 2. Compute Height
-                int height = 1;
-                for (int j = i + 1; j < CHUNK_SIZE; j++) {
-                    uint32_t nextRow = colMasks[j];
-                    if ((nextRow & runMask) == runMask) {
-                        bool textureMatch = true;
-                        for (int k = 0; k < width; k++) {
-                            if (GetBlockID(widthStart + k, j) != currentBlock) {
-                                textureMatch = false;
-                                break;
-                            }
-                        }
-                        if (textureMatch) {
-                            height++;
-                            colMasks[j] &= ~runMask;
-                        } else {
-                            break;
-                        }
-                    } else {
+    // i iterates the 'row' (Vertical axis of the 2D plane)
+    for (int i = 0; i < CHUNK_SIZE; i++) {
+        ChunkMask mask = colMasks[i];
+
+        while (mask != 0) {
+            int widthStart = ctz(mask);
+            int widthEnd = widthStart;
+            int u = widthStart;
+            int v = i;
+
+            uint8_t currentBlock = GetBlockID(u, v);
+
+            // 1. Compute Width
+            while (widthEnd < CHUNK_SIZE && (mask & ((ChunkMask)1 << widthEnd))) {
+                if (GetBlockID(widthEnd, v) != currentBlock) break;
+                widthEnd++;
+            }
+            int width = widthEnd - widthStart;
+
+            ChunkMask runMask = (width >= CHUNK_MASK_BITS) ? ~(ChunkMask)0 : (ChunkMask)(((1ULL << width) - 1ULL) << widthStart);
+
+            // 2. Compute Height
+            int height = 1;
+            for (int j = i + 1; j < CHUNK_SIZE; j++) {
+                if ((colMasks[j] & runMask) != runMask) break;
+
+                bool textureMatch = true;
+                for (int k = 0; k < width; k++) {
+                    if (GetBlockID(widthStart + k, j) != currentBlock) {
+                        textureMatch = false;
                         break;
                     }
                 }
-                mask &= ~runMask;
-
-                // 3. Generate Quad Vertices
-                int w = width;
-                int h = height;
-
-                // Determine the correct visual Texture ID for this face
-                uint32_t visualTexID = GetTextureID(currentBlock, face);
-
-                auto PushVert = [&](int du, int dv) {
-                    float vx, vy, vz;
-                    int r_u = u + du; 
-                    int r_v = v + dv; 
-
-                    // Axis 0 Fix: u maps to Z (horizontal), v maps to Y (vertical)
-                    // This ensures vertical textures (logs) stand up correctly on X-faces.
-                    if (axis == 0)      { vx = slice; vy = r_v; vz = r_u; } 
-                    else if (axis == 1) { vx = r_v; vy = slice; vz = r_u; } 
-                    else                { vx = r_u; vy = r_v; vz = slice; } 
-                    
-                    if (direction == 1) {
-                        if (axis == 0) vx += 1.0f;
-                        if (axis == 1) vy += 1.0f;
-                        if (axis == 2) vz += 1.0f;
-                    }
+                if (!textureMatch) break;
 
-                    // Use the resolved visual Texture ID here
-                    targetAllocator.Push(PackedVertex(vx, vy, vz, (float)face, 1.0f, visualTexID));
-                };
-
-                // Axis 0 requires winding flip because we swapped U/V mapping (Right-Hand Rule)
-                bool flipWinding = (axis == 0); 
-                bool positiveDir = (direction == 1);
-
-                if (positiveDir != flipWinding) { 
-                    // Standard Winding (CCW relative to face)
-                    PushVert(0, 0); PushVert(w, 0); PushVert(w, h);
-                    PushVert(0, 0); PushVert(w, h); PushVert(0, h);
-                } else {
-                    // Inverted Winding
-                    PushVert(0, 0); PushVert(w, h); PushVert(w, 0);
-                    PushVert(0, 0); PushVert(0, h); PushVert(w, h);
-                }
+                height++;
+                colMasks[j] &= ~runMask;
+            }
+            mask &= ~runMask;
+
+            // 3. Generate Quad Vertices
+            int w = width;
+            int h = height;
+
+            // Determine the correct visual Texture ID for this face (see block_registry.h)
+            uint32_t visualTexID = GetBlockTexture(currentBlock, FACE);
+
+            auto PushVert = [&](int du, int dv) {
+                PushFaceVertex<Axis, Dir>(targetAllocator, u + du, v + dv, slice, visualTexID);
+            };
+
+            if constexpr (STANDARD_WINDING) {
+                // Standard Winding (CCW relative to face)
+                PushVert(0, 0); PushVert(w, 0); PushVert(w, h);
+                PushVert(0, 0); PushVert(w, h); PushVert(0, h);
+            } else {
+                // Inverted Winding
+                PushVert(0, 0); PushVert(w, h); PushVert(w, 0);
+                PushVert(0, 0); PushVert(0, h); PushVert(w, h);
             }
         }
-    };
+    }
+}
 
-    uint32_t colMasksOpaque[CHUNK_SIZE]; 
-    uint32_t colMasksTrans[CHUNK_SIZE];
-
-    for (int face = 0; face < 6; face++) {
-        int axis = face / 2;
-        int direction = (face % 2) == 0 ? 1 : -1;
-
-        for (int slice = 0; slice < CHUNK_SIZE; slice++) {
-            
-            std::memset(colMasksOpaque, 0, sizeof(colMasksOpaque));
-            std::memset(colMasksTrans, 0, sizeof(colMasksTrans));
-
-            for (int row = 0; row < CHUNK_SIZE; row++) {
-                uint32_t maskOp = 0;
-                uint32_t maskTr = 0;
-                
-                for (int col = 0; col < CHUNK_SIZE; col++) {
-                    int x, y, z;
-                    
-                    // Axis 0 Fix: x=slice, y=row (V/Vertical), z=col (U/Horizontal)
-                    if (axis == 0)      { x = slice; y = row; z = col; } 
-                    else if (axis == 1) { x = row;   y = slice; z = col; } 
-                    else                { x = col;   y = row;   z = slice; } 
-                    
-                    // Use PADDING here for lookups
-                    uint8_t current = GetBlock(x + PADDING, y + PADDING, z + PADDING);
-                    if (current == 0) continue; 
-
-                    int nx = x + (axis == 0 ? direction : 0);
-                    int ny = y + (axis == 1 ? direction : 0);
-                    int nz = z + (axis == 2 ? direction : 0);
-                    
-                    // Safer neighbor check that doesn't trust uninitialized padding memory
-                    uint8_t neighbor = GetBlock(nx + PADDING, ny + PADDING, nz + PADDING);
-
-                    if (IsOpaque(current)) {
-                        if (neighbor == 0 || IsTransparent(neighbor)) {
-                            maskOp |= (1u << col);
-                        }
-                    } 
-                    else if (IsTransparent(current)) {
-                        if (neighbor == 0) {
-                            maskTr |= (1u << col);
-                        }
-                    }
-                }
-                colMasksOpaque[row] = maskOp;
-                colMasksTrans[row]  = maskTr;
+/**
+ * @brief Builds the visible-face masks for every slice of one face direction and greedy meshes them.
+ * Neighbor lookups land in the padding ring at the chunk border, so no bounds checks are needed.
+ */
+template <int Axis, int Dir>
+inline void MeshFace(const Chunk& chunk,
+                     LinearAllocator<PackedVertex>& allocatorOpaque,
+                     LinearAllocator<PackedVertex>& allocatorTrans)
+{
+    ChunkMask colMasksOpaque[CHUNK_SIZE];
+    ChunkMask colMasksTrans[CHUNK_SIZE];
+
+    for (int slice = 0; slice < CHUNK_SIZE; slice++) {
+        const int w = slice + PADDING;
+
+        for (int row = 0; row < CHUNK_SIZE; row++) {
+            const int v = row + PADDING;
+            ChunkMask maskOp = 0;
+            ChunkMask maskTr = 0;
+
+            for (int col = 0; col < CHUNK_SIZE; col++) {
+                const int u = col + PADDING;
+
+                // Branch-free face test from the block flags:
+                // Opaque faces show against anything non-opaque, transparent faces only against air.
+                uint8_t currentFlags = GetBlockFlags(chunk.voxels[FaceVoxelIndex<Axis>(u, v, w)]);
+                uint8_t neighborFlags = GetBlockFlags(chunk.voxels[FaceVoxelIndex<Axis>(u, v, w + Dir)]);
+                maskOp |= (ChunkMask)((currentFlags & BLOCK_FLAG_OPAQUE) && !(neighborFlags & BLOCK_FLAG_OPAQUE)) << col;
+                maskTr |= (ChunkMask)((currentFlags & BLOCK_FLAG_TRANSPARENT) && neighborFlags == 0) << col;
             }
-
-            GreedyPass(colMasksOpaque, allocatorOpaque, face, axis, direction, slice);
-            GreedyPass(colMasksTrans, allocatorTrans, face, axis, direction, slice);
+            colMasksOpaque[row] = maskOp;
+            colMasksTrans[row]  = maskTr;
         }
+
+        GreedyPassFace<Axis, Dir>(colMasksOpaque, chunk, allocatorOpaque, slice);
+        GreedyPassFace<Axis, Dir>(colMasksTrans, chunk, allocatorTrans, slice);
     }
-}
\ No newline at end of file
+}
+
+inline void MeshChunk(const Chunk& chunk, 
+                      LinearAllocator<PackedVertex>& allocatorOpaque, 
+                      LinearAllocator<PackedVertex>& allocatorTrans,
+                      bool debug = false) 
+{
+    // Same face order as before: +X, -X, +Y, -Y, +Z, -Z
+    MeshFace<0,  1>(chunk, allocatorOpaque, allocatorTrans);
+    MeshFace<0, -1>(chunk, allocatorOpaque, allocatorTrans);
+    MeshFace<1,  1>(chunk, allocatorOpaque, allocatorTrans);
+    MeshFace<1, -1>(chunk, allocatorOpaque, allocatorTrans);
+    MeshFace<2,  1>(chunk, allocatorOpaque, allocatorTrans);
+    MeshFace<2, -1>(chunk, allocatorOpaque, allocatorTrans);
+}
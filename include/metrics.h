@@ -0,0 +1,215 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <deque>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <initializer_list>
+#include "logger.h"
+
+// ================================================================================================
+//                                      METRICS REGISTRY
+// Always-on counters, gauges and fixed-bucket histograms, independent of the profiler toggle.
+// Look a metric up once (registration locks, lookups by name are not meant for hot paths) and keep
+// the reference: recording is one relaxed atomic op (a few for histograms), from any thread.
+// EnableSnapshots() + Tick() once per frame write every metric as one JSON line per interval, e.g.
+//   {"t":12.00,"seq":3,"counters":{"vram.upload_bytes":123},"gauges":{...},
+//    "histograms":{"streaming.step_ms":{"bounds":[1,2],"counts":[5,1,0],"count":6,"sum":4.2}}}
+// Counters and histograms are cumulative since start, take deltas between lines for rates.
+// ================================================================================================
+
+namespace Engine {
+
+class MetricCounter {
+public:
+    void Add(uint64_t n = 1) { m_value.fetch_add(n, std::memory_order_relaxed); }
+    uint64_t Get() const { return m_value.load(std::memory_order_relaxed); }
+private:
+    std::atomic<uint64_t> m_value{ 0 };
+};
+
+class MetricGauge {
+public:
+    void Set(double value) { m_value.store(value, std::memory_order_relaxed); }
+    double Get() const { return m_value.load(std::memory_order_relaxed); }
+private:
+    std::atomic<double> m_value{ 0.0 };
+};
+
+/**
+ * @brief Counts per bucket: bucket i holds values <= bounds[i] (and > bounds[i - 1]), the last one everything above.
+ */
+class MetricHistogram {
+public:
+    static constexpr size_t MAX_BOUNDS = 15;
+
+    explicit MetricHistogram(std::initializer_list<double> bounds) {
+        m_boundCount = std::min(bounds.size(), MAX_BOUNDS);
+        std::copy(bounds.begin(), bounds.begin() + m_boundCount, m_bounds);
+    }
+
+    void Record(double value) {
+        size_t bucket = 0;
+        while (bucket < m_boundCount && value > m_bounds[bucket]) bucket++;
+        m_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+
+        double sum = m_sum.load(std::memory_order_relaxed);
+        while (!m_sum.compare_exchange_weak(sum, sum + value, std::memory_order_relaxed)) {}
+    }
+
+    size_t GetBoundCount() const { return m_boundCount; }
+    double GetBound(size_t i) const { return m_bounds[i]; }
+    uint64_t GetBucket(size_t i) const { return m_buckets[i].load(std::memory_order_relaxed); } // i <= GetBoundCount()
+    double GetSum() const { return m_sum.load(std::memory_order_relaxed); }
+
+private:
+    double m_bounds[MAX_BOUNDS] = {};
+    size_t m_boundCount = 0;
+    std::atomic<uint64_t> m_buckets[MAX_BOUNDS + 1] = {};
+    std::atomic<double> m_sum{ 0.0 };
+};
+
+class MetricsRegistry {
+public:
+    static MetricsRegistry& Get() {
+        static MetricsRegistry instance;
+        return instance;
+    }
+
+    // --- Registration (returns the existing metric for a known name) ---
+    MetricCounter& Counter(const std::string& name) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& entry : m_counters) if (entry.first == name) return entry.second;
+        m_counters.emplace_back(std::piecewise_construct, std::forward_as_tuple(name), std::forward_as_tuple());
+        return m_counters.back().second;
+    }
+
+    MetricGauge& Gauge(const std::string& name) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& entry : m_gauges) if (entry.first == name) return entry.second;
+        m_gauges.emplace_back(std::piecewise_construct, std::forward_as_tuple(name), std::forward_as_tuple());
+        return m_gauges.back().second;
+    }
+
+    /**
+     * @param bounds Ascending bucket upper bounds, only used the first time the name is registered.
+     */
+    MetricHistogram& Histogram(const std::string& name, std::initializer_list<double> bounds) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& entry : m_histograms) if (entry.first == name) return entry.second;
+        m_histograms.emplace_back(std::piecewise_construct, std::forward_as_tuple(name), std::forward_as_tuple(bounds));
+        return m_histograms.back().second;
+    }
+
+    // --- Gauge sampling (flight recorder) ---
+    /**
+     * @brief Current gauge values in registration order, at most maxCount. Doesn't allocate.
+     * @return Number written.
+     */
+    size_t SampleGauges(double* out, size_t maxCount) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        size_t count = std::min(maxCount, m_gauges.size());
+        for (size_t i = 0; i < count; i++) out[i] = m_gauges[i].second.Get();
+        return count;
+    }
+
+    std::vector<std::string> GetGaugeNames() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::vector<std::string> names;
+        for (const auto& entry : m_gauges) names.push_back(entry.first);
+        return names;
+    }
+
+    // --- Snapshots ---
+    /**
+     * @brief Starts appending JSON lines to path every intervalSeconds (<= 0 turns snapshots off).
+     */
+    void EnableSnapshots(const std::string& path, double intervalSeconds) {
+        m_snapshotFile.close();
+        m_interval = intervalSeconds;
+        if (intervalSeconds <= 0.0) return;
+
+        m_snapshotFile.open(path, std::ios::app);
+        if (!m_snapshotFile) {
+            GOOSE_LOG_WARN("Metrics", "Could not open " << path << ", snapshots off");
+            m_interval = 0.0;
+            return;
+        }
+        m_nextSnapshot = Seconds() + intervalSeconds;
+        GOOSE_LOG_INFO("Metrics", "Snapshots every " << intervalSeconds << " s to " << path);
+    }
+
+    /**
+     * @brief Once per frame (main thread). Writes a snapshot when the interval has passed.
+     */
+    void Tick() {
+        if (m_interval <= 0.0) return;
+        double now = Seconds();
+        if (now < m_nextSnapshot) return;
+        m_nextSnapshot = now + m_interval;
+        WriteSnapshot(m_snapshotFile, now);
+        m_snapshotFile.flush();
+    }
+
+    /**
+     * @brief One JSON line with every metric.
+     */
+    void WriteSnapshot(std::ostream& out, double timeSeconds) {
+        std::ostringstream line;
+        line.precision(10);
+        line << "{\"t\":" << timeSeconds << ",\"seq\":" << m_sequence++;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        line << ",\"counters\":{";
+        for (size_t i = 0; i < m_counters.size(); i++) {
+            line << (i ? "," : "") << '"' << m_counters[i].first << "\":" << m_counters[i].second.Get();
+        }
+        line << "},\"gauges\":{";
+        for (size_t i = 0; i < m_gauges.size(); i++) {
+            line << (i ? "," : "") << '"' << m_gauges[i].first << "\":" << m_gauges[i].second.Get();
+        }
+        line << "},\"histograms\":{";
+        for (size_t i = 0; i < m_histograms.size(); i++) {
+            const MetricHistogram& h = m_histograms[i].second;
+            uint64_t count = 0;
+            line << (i ? "," : "") << '"' << m_histograms[i].first << "\":{\"bounds\":[";
+            for (size_t b = 0; b < h.GetBoundCount(); b++) line << (b ? "," : "") << h.GetBound(b);
+            line << "],\"counts\":[";
+            for (size_t b = 0; b <= h.GetBoundCount(); b++) {
+                line << (b ? "," : "") << h.GetBucket(b);
+                count += h.GetBucket(b);
+            }
+            line << "],\"count\":" << count << ",\"sum\":" << h.GetSum() << "}";
+        }
+        line << "}}\n";
+        out << line.str();
+    }
+
+private:
+    MetricsRegistry() : m_start(std::chrono::steady_clock::now()) {}
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    double Seconds() const {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count();
+    }
+
+    // Deques: references stay valid as metrics are added
+    std::mutex m_mutex;
+    std::deque<std::pair<std::string, MetricCounter>> m_counters;
+    std::deque<std::pair<std::string, MetricGauge>> m_gauges;
+    std::deque<std::pair<std::string, MetricHistogram>> m_histograms;
+
+    std::chrono::steady_clock::time_point m_start;
+    std::ofstream m_snapshotFile;
+    double m_interval = 0.0;
+    double m_nextSnapshot = 0.0;
+    uint64_t m_sequence = 0;
+};
+
+} // namespace Engine
@@ -4,6 +4,8 @@
 #include <iostream>
 #include <algorithm>
 #include <iomanip> // Added for std::fixed/std::setprecision
+#include "flight_recorder.h"
+#include "logger.h"
 
 // A Dynamic Object Pool that grows in "pages" (blocks) rather than one massive allocation.
 // Reduces initial RAM usage significantly.
@@ -33,7 +35,7 @@ public:
         m_growthSize = std::max((size_t)1, growthSize);
         m_maxCapacity = maxCapacity;
 
-        std::cout << "[System] ObjectPool [" << (int)m_uniqueID << "] Initialized. Item Size: " << sizeof(T) << " bytes." << std::endl;
+        GOOSE_LOG_INFO("System", "ObjectPool [" << (int)m_uniqueID << "] Initialized. Item Size: " << sizeof(T) << " bytes.");
 
         if (initialSize > 0) {
             Expand(initialSize);
@@ -105,11 +107,12 @@ public:
 
 private:
     void Expand(size_t count) {
+        Engine::FlightRecorder::Scope scope("ObjectPool::Expand"); // Runs under the pool lock, a known hitch source
         // Check limits
         if (m_maxCapacity > 0 && m_totalAllocated + count > m_maxCapacity) {
             if (m_totalAllocated >= m_maxCapacity) {
                 // Hard limit reached
-                std::cerr << "[ObjectPool " << (int)m_uniqueID << "] HARD LIMIT REACHED. Cannot expand." << std::endl;
+                GOOSE_LOG_ERROR("ObjectPool", "Pool " << (int)m_uniqueID << ": HARD LIMIT REACHED. Cannot expand.");
                 return;
             }
             // Allocate whatever remains up to the limit
@@ -134,13 +137,13 @@ private:
             double sizeMB = (double)(count * sizeof(T)) / (1024.0 * 1024.0);
             double totalMB = (double)(m_totalAllocated * sizeof(T)) / (1024.0 * 1024.0);
 
-            std::cout << "[ObjectPool " << (int)m_uniqueID << "]" 
-                      << " Expanded by " << count << " items "
-                      << "(" << std::fixed << std::setprecision(6) << sizeMB << " MB). "
-                      << "Total: " << totalMB << " MB" << std::endl;
+            // Logged after the fact without flushing: Expand runs under the pool lock
+            GOOSE_LOG_INFO("ObjectPool", "Pool " << (int)m_uniqueID << ": Expanded by " << count << " items "
+                                         << "(" << std::fixed << std::setprecision(6) << sizeMB << " MB). "
+                                         << "Total: " << totalMB << " MB");
 
         } catch (const std::bad_alloc& e) {
-            std::cerr << "[ObjectPool " << (int)m_uniqueID << "]" << " CRITICAL: Memory allocation failed during expansion: " << e.what() << std::endl;
+            GOOSE_LOG_ERROR("ObjectPool", "Pool " << (int)m_uniqueID << ": CRITICAL: Memory allocation failed during expansion: " << e.what());
         }
     }
 };
\ No newline at end of file
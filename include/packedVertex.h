@@ -3,6 +3,22 @@
 #include <cmath>
 #include <algorithm>
 
+#include "chunk.h"
+
+// --- BIT LAYOUT ---
+// [coord bits: X] [coord bits: Y] [coord bits: Z] [3: Normal] [2: AO] [rest: Texture]
+// Quad corners reach CHUNK_SIZE (one past the last voxel), so 64^3 chunks need 7 bits per axis
+// and give up 3 texture bits for it (64 texture layers instead of 512).
+// The vertex shader gets the same numbers through Shader::AddGlobalDefine (see main.cpp).
+constexpr uint32_t PACKED_COORD_BITS = (CHUNK_SIZE > 32) ? 7 : 6;
+constexpr uint32_t PACKED_COORD_MASK = (1u << PACKED_COORD_BITS) - 1u;
+constexpr uint32_t PACKED_NORM_SHIFT = PACKED_COORD_BITS * 3;
+constexpr uint32_t PACKED_AO_SHIFT   = PACKED_NORM_SHIFT + 3;
+constexpr uint32_t PACKED_TEX_SHIFT  = PACKED_AO_SHIFT + 2;
+constexpr uint32_t PACKED_TEX_BITS   = 32 - PACKED_TEX_SHIFT;
+constexpr uint32_t PACKED_TEX_MASK   = (1u << PACKED_TEX_BITS) - 1u;
+static_assert(CHUNK_SIZE <= (int)PACKED_COORD_MASK, "PackedVertex coordinates can't hold CHUNK_SIZE");
+
 struct PackedVertex {
     uint32_t data; 
 
@@ -10,22 +26,20 @@ struct PackedVertex {
 
     PackedVertex(float x, float y, float z, float face, float ao, uint32_t textureId) {
         // Bias of 0.5f prevents float truncation errors (9.99 -> 9)
-        // Mask 0x3F = 6 bits = values 0-63 (Enough for CHUNK_SIZE_PADDED = 34)
-        
-        uint32_t ix = (uint32_t)(x + 0.5f) & 0x3F;
-        uint32_t iy = (uint32_t)(y + 0.5f) & 0x3F;
-        uint32_t iz = (uint32_t)(z + 0.5f) & 0x3F;
+        uint32_t ix = (uint32_t)(x + 0.5f) & PACKED_COORD_MASK;
+        uint32_t iy = (uint32_t)(y + 0.5f) & PACKED_COORD_MASK;
+        uint32_t iz = (uint32_t)(z + 0.5f) & PACKED_COORD_MASK;
         
         uint32_t iNorm = (uint32_t)(face + 0.5f) & 0x7;  // 3 bits
         uint32_t iAo   = (uint32_t)(ao + 0.5f)   & 0x3;  // 2 bits
-        uint32_t iTex  = textureId      & 0x1FF; // 9 bits (512 texture IDs)
+        uint32_t iTex  = textureId & PACKED_TEX_MASK;     // 9 bits (512 texture IDs) at 32^3
 
         // Packing Order: X, Y, Z, Norm, AO, Tex
         data = ix | 
-              (iy << 6)  | 
-              (iz << 12) | 
-              (iNorm << 18) | 
-              (iAo   << 21) | 
-              (iTex  << 23);
+              (iy << PACKED_COORD_BITS) | 
+              (iz << (PACKED_COORD_BITS * 2)) | 
+              (iNorm << PACKED_NORM_SHIFT) | 
+              (iAo   << PACKED_AO_SHIFT) | 
+              (iTex  << PACKED_TEX_SHIFT);
     }
 };
\ No newline at end of file
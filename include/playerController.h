@@ -8,6 +8,7 @@
 #include <iomanip>
 #include <string>
 #include "world.h"
+#include "logger.h"
 #include "block_outliner.h"
 
 #ifdef IMGUI_VERSION
@@ -316,7 +317,7 @@ private:
             if (now - lastSpaceTime < 0.25f) {
                 isCreativeMode = !isCreativeMode;
                 velocity = glm::vec3(0);
-                std::cout << "[Player] Creative Mode: " << (isCreativeMode ? "ON" : "OFF") << std::endl;
+                GOOSE_LOG_INFO("Player", "Creative Mode: " << (isCreativeMode ? "ON" : "OFF"));
                 lastSpaceTime = -1.0f; 
             } else {
                 lastSpaceTime = now;
@@ -479,17 +480,16 @@ private:
         int maxZ = static_cast<int>(std::floor(max.z));
 
         // Iterate through all blocks intersecting the player's bounding box
+        ChunkNode* chunkHint = nullptr; // The box spans at most a couple of neighbouring chunks
         for (int x = minX; x <= maxX; x++) {
             for (int y = minY; y <= maxY; y++) {
                 for (int z = minZ; z <= maxZ; z++) {
                     
                     // Use the fast world lookup
-                    uint8_t blockID = world.GetBlockAt(x, y, z);
+                    uint8_t blockID = world.GetBlockAt(x, y, z, chunkHint);
                     
-                    // Collision Logic:
-                    // 0 = Air (no collision)
-                    // 6 = Water/Liquid (no collision) - Adjust this ID as needed
-                    if (blockID != 0 && blockID != 6) {
+                    // Collision Logic: solid flag from the block registry (air and liquids pass through)
+                    if (IsSolid(blockID)) {
                         return true;
                     }
                 }
@@ -10,6 +10,9 @@
 #include <sstream>
 #include <glad/glad.h>
 #include <imgui.h>
+#include "gl_call_counter.h"
+#include "alloc_tracker.h"
+#include "flight_recorder.h"
 //#include "gui_utils.h"
 
 // Configuration
@@ -69,6 +72,14 @@ public:
         float nodeRamUsed = 0;
     } m_pipeline;
 
+    struct StreamingStats {
+        size_t holes = 0;           // LOD 0 ring chunks with nothing drawn this frame
+        float holesPerSecond = 0;   // Hole-frames per second (sum of per-frame holes over 1 s)
+        float latencyMs = 0;        // Measured request -> ACTIVE time (LOD 0, smoothed)
+        float horizonMs = 0;        // Look-ahead the predictor is using
+        float leadDistance = 0;     // How far ahead of the last LOD centre the prediction is (units)
+    } m_streaming;
+
 
     static Profiler& Get() {
         static Profiler instance;
@@ -79,6 +90,10 @@ public:
     m_pipeline = { pGen, wMesh, wUpload, threads, active, limit, voxRamAlloc, voxRamUsed, nRamAlloc, nRamUsed };
 }
 
+    void SetStreamingStats(size_t holes, float holesPerSecond, float latencyMs, float horizonMs, float leadDistance) {
+        m_streaming = { holes, holesPerSecond, latencyMs, horizonMs, leadDistance };
+    }
+
     // Master Toggle: If false, timers return immediately for zero overhead
     bool m_Enabled = false; 
     
@@ -93,17 +108,26 @@ public:
     // --- CPU Profiling (RAII) ---
     struct ScopedTimer {
         const char* name;
-        std::chrono::high_resolution_clock::time_point start;
+        std::chrono::steady_clock::time_point start; // Same clock as the flight recorder
         bool active;
+        bool recorded; // Flight recorder keeps the event whether the profiler is on or not
+        bool glScope; // Render-thread timers also scope the GL call counts
 
         ScopedTimer(const char* name) : name(name) {
             active = Profiler::Get().m_Enabled;
-            if (active) start = std::chrono::high_resolution_clock::now();
+            recorded = FlightRecorder::Get().IsRecording();
+            if (active || recorded) start = std::chrono::steady_clock::now();
+            glScope = GlCallCounter::Get().BeginScope(name);
+            AllocTracker::PushScope(name);
         }
 
         ~ScopedTimer() {
-            if (active) {
-                auto end = std::chrono::high_resolution_clock::now();
+            AllocTracker::PopScope();
+            if (glScope) GlCallCounter::Get().EndScope();
+            if (active || recorded) {
+                auto end = std::chrono::steady_clock::now();
+                if (recorded) FlightRecorder::Get().RecordScope(name, start, end);
+                if (!active) return;
                 float duration = std::chrono::duration<float, std::milli>(end - start).count();
                 // Capture the current thread ID upon completion
                 Profiler::Get().StoreCPU(name, duration, std::this_thread::get_id());
@@ -124,7 +148,8 @@ public:
 
         // Note: Map access/insertion here assumes BeginGPU is always called from 
         // the Main Render Thread (Context constraint).
-        GPUTimer& timer = m_GpuTimers[name]; 
+        auto entry = m_GpuTimers.try_emplace(name).first;
+        GPUTimer& timer = entry->second; 
         timer.data.name = name;
 
         // Initialize queries lazily
@@ -136,15 +161,29 @@ public:
         GLuint query = timer.queries[m_FrameIndex % PROFILER_GPU_QUERY_BUFFERS];
         glBeginQuery(GL_TIME_ELAPSED, query);
         timer.queryPending[m_FrameIndex % PROFILER_GPU_QUERY_BUFFERS] = true;
+        m_GlScopeOpen = GlCallCounter::Get().BeginScope(name.c_str());
+        AllocTracker::PushScope(entry->first.c_str()); // Map key: stable for the scope table
+        m_AllocScopeOpen = true;
     }
 
     void EndGPU() {
+        if (m_GlScopeOpen) {
+            GlCallCounter::Get().EndScope();
+            m_GlScopeOpen = false;
+        }
+        if (m_AllocScopeOpen) {
+            AllocTracker::PopScope();
+            m_AllocScopeOpen = false;
+        }
         if (!m_Enabled) return;
         glEndQuery(GL_TIME_ELAPSED);
     }
 
     // --- System Loop ---
     void Update() {
+        GlCallCounter::Get().EndFrame(); // No-op unless the counter is installed
+        AllocTracker::EndFrame();        // No-op unless built with GOOSE_ALLOC_TRACKING
+        FlightRecorder::Get().EndFrame(); // No-op until Start()
         if (!m_Enabled) return;
 
         // Capture Main Thread ID (Update is always called from Main)
@@ -179,6 +218,7 @@ public:
     // Must be called BEFORE glfwTerminate/OpenGL context destruction
     void Shutdown() {
         m_Enabled = false; // Prevent new timers from registering
+        GlCallCounter::Get().Uninstall();
         std::lock_guard<std::mutex> lock(m_Mutex);
 
         for (auto& [name, timer] : m_GpuTimers) {
@@ -332,12 +372,131 @@ public:
                 
             }
 
+            // Streaming (predictive prefetch)
+            if (ImGui::CollapsingHeader("Streaming", ImGuiTreeNodeFlags_DefaultOpen)) {
+                ImVec4 holeColor = (m_streaming.holes > 0) ? ImVec4(1, 0.4f, 0.4f, 1) : ImVec4(0.4f, 1, 0.4f, 1);
+                ImGui::TextColored(holeColor, "Holes: %zu  (%.0f hole-frames/s)", m_streaming.holes, m_streaming.holesPerSecond);
+                ImGui::Text("Load Latency: %.0f ms  Horizon: %.0f ms", m_streaming.latencyMs, m_streaming.horizonMs);
+                ImGui::Text("Prediction Lead: %.1f units", m_streaming.leadDistance);
+            }
+
+            DrawGlCallCounts();
+            DrawAllocationCounts();
+            DrawFlightRecorder();
+
 
         }
         ImGui::End();
     }
 
 private:
+    // Driver calls of the last frame, per kind and per scope (GPU passes, render-thread CPU timers)
+    void DrawGlCallCounts() {
+        if (!ImGui::CollapsingHeader("GL Calls (Last Frame)")) return;
+
+        GlCallCounter& counter = GlCallCounter::Get();
+        bool installed = counter.IsInstalled();
+        if (ImGui::Checkbox("Count GL Calls", &installed)) {
+            if (installed) counter.Install();
+            else counter.Uninstall();
+        }
+        if (!counter.IsInstalled()) return;
+
+        const GlCallStats& frame = counter.GetLastFrame();
+        ImGui::Text("Hooked Functions: %zu", counter.GetHookCount());
+        ImGui::Text("Calls: %u  Uploaded: %.2f KB  Copied: %.2f KB", frame.calls,
+                    frame.uploadBytes / 1024.0f, frame.copyBytes / 1024.0f);
+
+        const int kinds = (int)GlCallKind::COUNT;
+        if (ImGui::BeginTable("GlCallKinds", kinds, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingStretchSame)) {
+            for (int k = 0; k < kinds; k++) ImGui::TableSetupColumn(GlCallKindName((GlCallKind)k));
+            ImGui::TableHeadersRow();
+            ImGui::TableNextRow();
+            for (int k = 0; k < kinds; k++) {
+                ImGui::TableSetColumnIndex(k);
+                ImGui::Text("%u", frame.Count((GlCallKind)k));
+            }
+            ImGui::EndTable();
+        }
+
+        if (ImGui::BeginTable("GlCallScopes", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit)) {
+            ImGui::TableSetupColumn("Scope", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableSetupColumn("Calls");
+            ImGui::TableSetupColumn("Draws");
+            ImGui::TableSetupColumn("Dispatches");
+            ImGui::TableSetupColumn("Uniforms");
+            ImGui::TableSetupColumn("Upload KB");
+            ImGui::TableHeadersRow();
+            for (const auto& [name, stats] : counter.GetLastScopes()) {
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0); ImGui::Text("%s", name.c_str());
+                ImGui::TableSetColumnIndex(1); ImGui::Text("%u", stats.calls);
+                ImGui::TableSetColumnIndex(2); ImGui::Text("%u", stats.Count(GlCallKind::DRAW));
+                ImGui::TableSetColumnIndex(3); ImGui::Text("%u", stats.Count(GlCallKind::DISPATCH));
+                ImGui::TableSetColumnIndex(4); ImGui::Text("%u", stats.Count(GlCallKind::UNIFORM));
+                ImGui::TableSetColumnIndex(5); ImGui::Text("%.2f", stats.uploadBytes / 1024.0f);
+            }
+            ImGui::EndTable();
+        }
+    }
+
+    // Heap allocations of the last frame per scope and thread (GOOSE_ALLOC_TRACKING builds only)
+    void DrawAllocationCounts() {
+        if (!ImGui::CollapsingHeader("Heap Allocations (Last Frame)")) return;
+        if (!AllocTracker::COMPILED_IN) {
+            ImGui::TextDisabled("Build with -DGOOSE_ALLOC_TRACKING=ON to count allocations.");
+            return;
+        }
+
+        uint64_t allocs = AllocTracker::GetLastFrameAllocs();
+        ImVec4 color = (allocs == 0) ? ImVec4(0.4f, 1.0f, 0.4f, 1.0f) : ImVec4(1.0f, 0.8f, 0.4f, 1.0f);
+        ImGui::TextColored(color, "Allocations: %llu  (%.2f KB)", (unsigned long long)allocs, AllocTracker::GetLastFrameBytes() / 1024.0f);
+        if (AllocTracker::IsTableFull()) ImGui::TextColored(ImVec4(1, 0.4f, 0.4f, 1), "Scope table full, extra scopes merged");
+
+        if (ImGui::BeginTable("AllocScopes", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit)) {
+            ImGui::TableSetupColumn("Scope", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableSetupColumn("Thread");
+            ImGui::TableSetupColumn("Allocs");
+            ImGui::TableSetupColumn("KB");
+            ImGui::TableSetupColumn("Frees");
+            ImGui::TableHeadersRow();
+            uint32_t mainThread = AllocTracker::GetMainThreadIndex();
+            for (const AllocScopeStats& stats : AllocTracker::GetLastFrame()) {
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0); ImGui::Text("%s", stats.scope);
+                ImGui::TableSetColumnIndex(1);
+                if (stats.thread == mainThread) ImGui::Text("MAIN");
+                else ImGui::Text("#%u", stats.thread);
+                ImGui::TableSetColumnIndex(2); ImGui::Text("%llu", (unsigned long long)stats.allocs);
+                ImGui::TableSetColumnIndex(3); ImGui::Text("%.2f", stats.bytes / 1024.0f);
+                ImGui::TableSetColumnIndex(4); ImGui::Text("%llu", (unsigned long long)stats.frees);
+            }
+            ImGui::EndTable();
+        }
+    }
+
+    // Spike threshold and manual dumps of the always-running recorder
+    void DrawFlightRecorder() {
+        if (!ImGui::CollapsingHeader("Flight Recorder")) return;
+
+        FlightRecorder& recorder = FlightRecorder::Get();
+        if (!recorder.IsRecording()) {
+            ImGui::TextDisabled("Not recording (FlightRecorder::Start).");
+            return;
+        }
+
+        float threshold = recorder.GetSpikeThresholdMs();
+        if (ImGui::SliderFloat("Spike Threshold (ms)", &threshold, 20.0f, 500.0f, "%.0f")) {
+            recorder.SetSpikeThresholdMs(threshold);
+        }
+        if (recorder.IsDumpPending()) ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.4f, 1.0f), "Recording the window after a spike...");
+        else if (recorder.IsWriting()) ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.4f, 1.0f), "Writing the last dump...");
+        else if (ImGui::Button("Dump Now")) recorder.RequestDump();
+
+        ImGui::Text("Dumps: %u / %u", recorder.GetDumpCount(), FlightRecorder::MAX_DUMPS);
+        if (!recorder.GetLastDumpPath().empty()) ImGui::Text("Last: %s", recorder.GetLastDumpPath().c_str());
+    }
+
     Profiler() = default;
     
     ~Profiler() {
@@ -352,6 +511,8 @@ private:
     std::unordered_map<std::string, GPUTimer> m_GpuTimers;
     
     uint64_t m_FrameIndex = 0;
+    bool m_GlScopeOpen = false; // BeginGPU opened a GL call scope (GPU timers don't nest)
+    bool m_AllocScopeOpen = false;
 };
 
 } // namespace Engine
\ No newline at end of file
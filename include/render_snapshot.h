@@ -0,0 +1,200 @@
+#pragma once
+
+#include <vector>
+#include <mutex>
+#include <cstdint>
+#include <utility>
+#include <glm/glm.hpp>
+
+#include "packedVertex.h"
+#include "chunk_meshlets.h"
+
+// ================================================================================================
+//                                      RENDER SNAPSHOTS
+// The streaming step (World::Update: queue draining, LOD application, VRAM allocation) runs on its
+// own thread and never touches GL. Everything the render thread has to do because of it is
+// recorded as an ordered list of ops:
+//   UPLOAD   - copy a mesh / meshlet array into the vertex heap at an offset the step allocated
+//   REGISTER - add or update a chunk's culler record (drawable from now on)
+//   REMOVE   - drop a chunk's culler record
+// plus the VRAM ranges the step freed. Those are retired only after all of the snapshot's ops, so
+// the render thread stops drawing a range before the heap starts waiting out its fence.
+// Each step's ops are one RenderSnapshot. They are deltas, so none may be skipped: the exchange is
+// double buffered, and if the render thread hasn't picked up the previous step yet the new one is
+// appended to it instead of replacing it. Order inside a snapshot is the order the step produced,
+// so a range freed by a REMOVE is never overwritten by an UPLOAD before that REMOVE is applied.
+// Pure CPU code, no GL.
+// ================================================================================================
+
+/**
+ * @brief Arguments of GpuCuller::AddOrUpdateChunk.
+ */
+struct ChunkDrawRecord {
+    int64_t chunkID = 0;
+    glm::vec3 origin = glm::vec3(0.0f);
+    glm::vec3 aabbMin = glm::vec3(0.0f);
+    glm::vec3 aabbMax = glm::vec3(0.0f);
+    float scale = 1.0f;
+    size_t firstVertexOpaque = 0, vertexCountOpaque = 0;
+    size_t firstVertexTrans = 0, vertexCountTrans = 0;
+    size_t firstMeshlet = 0, meshletCount = 0;
+};
+
+/**
+ * @brief Data for one UPLOAD, moved out of the node's mesh cache (no copy). One of the two is set.
+ */
+struct VramUpload {
+    long long offset = -1;
+    std::vector<PackedVertex> vertices;
+    std::vector<ChunkMeshlet> meshlets;
+
+    const void* Data() const { return vertices.empty() ? (const void*)meshlets.data() : (const void*)vertices.data(); }
+    size_t Bytes() const { return vertices.size() * sizeof(PackedVertex) + meshlets.size() * sizeof(ChunkMeshlet); }
+};
+
+enum class RenderOpType : uint8_t { UPLOAD, REGISTER, REMOVE };
+
+struct RenderOp {
+    RenderOpType type;
+    uint32_t index;     // Into uploads (UPLOAD) or records (REGISTER)
+    int64_t chunkID;    // REMOVE
+};
+
+/**
+ * @brief Vertex heap range freed by the step (GpuMemoryManager::Free arguments).
+ */
+struct VramRetire {
+    long long offset = -1;
+    size_t bytes = 0;
+};
+
+struct RenderSnapshot {
+    uint64_t firstStep = 0;     // Streaming steps folded into this snapshot (inclusive), 0 = none yet
+    uint64_t lastStep = 0;
+    std::vector<RenderOp> ops;
+    std::vector<VramUpload> uploads;
+    std::vector<ChunkDrawRecord> records;
+    std::vector<VramRetire> retired;    // Applied after ops
+
+    void Upload(long long offset, std::vector<PackedVertex>&& vertices) {
+        ops.push_back({ RenderOpType::UPLOAD, (uint32_t)uploads.size(), 0 });
+        uploads.emplace_back();
+        uploads.back().offset = offset;
+        uploads.back().vertices = std::move(vertices);
+    }
+
+    void Upload(long long offset, std::vector<ChunkMeshlet>&& meshlets) {
+        ops.push_back({ RenderOpType::UPLOAD, (uint32_t)uploads.size(), 0 });
+        uploads.emplace_back();
+        uploads.back().offset = offset;
+        uploads.back().meshlets = std::move(meshlets);
+    }
+
+    void Register(const ChunkDrawRecord& record) {
+        ops.push_back({ RenderOpType::REGISTER, (uint32_t)records.size(), record.chunkID });
+        records.push_back(record);
+    }
+
+    void Remove(int64_t chunkID) {
+        ops.push_back({ RenderOpType::REMOVE, 0, chunkID });
+    }
+
+    void Retire(long long offset, size_t bytes) {
+        retired.push_back({ offset, bytes });
+    }
+
+    bool Empty() const { return ops.empty() && retired.empty(); }
+
+    /**
+     * @brief Empties the lists but keeps their capacity (buffers are recycled through the exchange).
+     */
+    void Clear() {
+        firstStep = lastStep = 0;
+        ops.clear();
+        uploads.clear();
+        records.clear();
+        retired.clear();
+    }
+
+    /**
+     * @brief Appends a later snapshot (its ops run after ours). Indices are rebased.
+     * Its retired ranges join ours, still after every op: none of them is drawn by the combined ops.
+     */
+    void Append(RenderSnapshot&& later) {
+        uint32_t uploadBase = (uint32_t)uploads.size();
+        uint32_t recordBase = (uint32_t)records.size();
+        for (RenderOp op : later.ops) {
+            if (op.type == RenderOpType::UPLOAD) op.index += uploadBase;
+            else if (op.type == RenderOpType::REGISTER) op.index += recordBase;
+            ops.push_back(op);
+        }
+        for (VramUpload& upload : later.uploads) uploads.push_back(std::move(upload));
+        records.insert(records.end(), later.records.begin(), later.records.end());
+        retired.insert(retired.end(), later.retired.begin(), later.retired.end());
+        if (firstStep == 0) firstStep = later.firstStep;
+        lastStep = later.lastStep;
+        later.Clear();
+    }
+
+    /**
+     * @brief Every op points at existing data and the step range is sane.
+     */
+    bool IsConsistent() const {
+        if ((firstStep == 0) != (lastStep == 0) || firstStep > lastStep) return false;
+        for (const RenderOp& op : ops) {
+            if (op.type == RenderOpType::UPLOAD && op.index >= uploads.size()) return false;
+            if (op.type == RenderOpType::REGISTER && (op.index >= records.size() || records[op.index].chunkID != op.chunkID)) return false;
+        }
+        for (const VramRetire& range : retired) {
+            if (range.offset < 0) return false;
+        }
+        return true;
+    }
+};
+
+/**
+ * @brief Single producer (streaming step) / single consumer (render thread) handoff.
+ */
+class RenderSnapshotExchange {
+public:
+    /**
+     * @brief Hands over one step's ops. back comes out empty (holding a recycled buffer).
+     */
+    void Publish(RenderSnapshot& back) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        back.firstStep = back.lastStep = m_nextStep++;
+        if (m_pending.lastStep == 0) {
+            std::swap(m_pending, back);
+            back.Clear();
+        } else {
+            m_pending.Append(std::move(back)); // Render thread is behind, keep the deltas
+        }
+    }
+
+    /**
+     * @brief Takes everything published since the last call. front must be empty (Clear() it after applying).
+     * @return false if nothing new was published.
+     */
+    bool Acquire(RenderSnapshot& front) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_pending.lastStep == 0) return false;
+        std::swap(m_pending, front);
+        m_pending.Clear();
+
+        // Steps are consumed back to back, a gap would mean lost deltas
+        if (front.firstStep != m_lastConsumedStep + 1) m_gapCount++;
+        m_lastConsumedStep = front.lastStep;
+        return true;
+    }
+
+    uint64_t GetPublishedSteps() const { std::lock_guard<std::mutex> lock(m_mutex); return m_nextStep - 1; }
+    uint64_t GetConsumedSteps() const { std::lock_guard<std::mutex> lock(m_mutex); return m_lastConsumedStep; }
+    uint64_t GetGapCount() const { std::lock_guard<std::mutex> lock(m_mutex); return m_gapCount; }
+
+private:
+    mutable std::mutex m_mutex;
+    RenderSnapshot m_pending;
+    uint64_t m_nextStep = 1;
+    uint64_t m_lastConsumedStep = 0;
+    uint64_t m_gapCount = 0;
+};
@@ -7,6 +7,7 @@
 #include <iostream>
 #include <algorithm> // Required for std::max
 #include <cmath>     // Required for floor, log2
+#include "logger.h"
 
 // --- FRAMEBUFFER RESOURCES ---
 struct FramebufferResources {
@@ -20,13 +21,13 @@ struct FramebufferResources {
     void Resize(int w, int h) {
         // 1. Safety Check: Prevent 0 or negative dimensions
         if (w <= 0 || h <= 0) {
-            std::cerr << "[FBO] Warning: Attempted to resize to invalid dimensions (" << w << "x" << h << "). Skipping." << std::endl;
+            GOOSE_LOG_WARN("FBO", "Attempted to resize to invalid dimensions (" << w << "x" << h << "). Skipping.");
             return; 
         }
 
         if (width == w && height == h) return;
         
-        std::cout << "[FBO] Resizing buffer to: " << w << "x" << h << std::endl;
+        GOOSE_LOG_INFO("FBO", "Resizing buffer to: " << w << "x" << h);
         width = w; height = h;
 
         if (fbo) glDeleteFramebuffers(1, &fbo);
@@ -68,12 +69,11 @@ struct FramebufferResources {
 
         GLenum status = glCheckNamedFramebufferStatus(fbo, GL_FRAMEBUFFER);
         if (status != GL_FRAMEBUFFER_COMPLETE) {
-            std::cerr << "Framebuffer Incomplete! Status: " << status 
-                      << " (0x" << std::hex << status << std::dec << ")" << std::endl;
+            GOOSE_LOG_ERROR("FBO", "Framebuffer Incomplete! Status: " << status << " (0x" << std::hex << status << ")");
             
             // Helpful debug for common error codes
             if (status == GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT) 
-                std::cerr << " -> GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT (Usually invalid texture size or format)" << std::endl;
+                GOOSE_LOG_ERROR("FBO", " -> GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT (Usually invalid texture size or format)");
         }
     }
 } g_fbo;
\ No newline at end of file
@@ -6,9 +6,13 @@
 #include <glm/gtc/type_ptr.hpp> // Required for glm::value_ptr
 
 #include <string>
+#include <vector>
+#include <string_view>
+#include <unordered_map>
 #include <fstream>
 #include <sstream>
 #include <iostream>
+#include "logger.h"
 
 class Shader {
 public:
@@ -32,8 +36,10 @@ public:
             fShaderStream << fShaderFile.rdbuf();
             vertexCode = vShaderStream.str();
             fragmentCode = fShaderStream.str();
+            InjectGlobalDefines(vertexCode);
+            InjectGlobalDefines(fragmentCode);
         } catch (std::ifstream::failure& e) {
-            std::cout << "[ERROR] SHADER FILE NOT READ: " << e.what() << std::endl;
+            GOOSE_LOG_ERROR("Shader", "SHADER FILE NOT READ: " << e.what());
         }
 
         const char* vShaderCode = vertexCode.c_str();
@@ -55,6 +61,7 @@ public:
         glAttachShader(ID, fragment);
         glLinkProgram(ID);
         checkCompileErrors(ID, "PROGRAM");
+        CacheUniformLocations();
         
         glDeleteShader(vertex);
         glDeleteShader(fragment);
@@ -74,8 +81,9 @@ public:
             std::stringstream cShaderStream;
             cShaderStream << cShaderFile.rdbuf();
             computeCode = cShaderStream.str();
+            InjectGlobalDefines(computeCode);
         } catch (std::ifstream::failure& e) {
-            std::cout << "[ERROR] COMPUTE SHADER FILE NOT READ (" << computePath << "): " << e.what() << std::endl;
+            GOOSE_LOG_ERROR("Shader", "COMPUTE SHADER FILE NOT READ (" << computePath << "): " << e.what());
         }
 
         const char* cShaderCode = computeCode.c_str();
@@ -90,10 +98,24 @@ public:
         glAttachShader(ID, compute);
         glLinkProgram(ID);
         checkCompileErrors(ID, "PROGRAM");
+        CacheUniformLocations();
         
         glDeleteShader(compute);
     }
 
+    // Owns a GL program and a location table that points into its own names
+    Shader(const Shader&) = delete;
+    Shader& operator=(const Shader&) = delete;
+
+    // ------------------------------------------------------------------------
+    // Global Defines
+    // Compile-time engine constants (chunk size, vertex packing) that GLSL needs too.
+    // Added right after the #version line of every shader constructed afterwards.
+    // ------------------------------------------------------------------------
+    static void AddGlobalDefine(const std::string &name, int value) {
+        GlobalDefines() += "#define " + name + " " + std::to_string(value) + "\n";
+    }
+
     // ------------------------------------------------------------------------
     // State Management
     // ------------------------------------------------------------------------
@@ -101,68 +123,125 @@ public:
         glUseProgram(ID); 
     }
     
+    // ------------------------------------------------------------------------
+    // Uniform Locations
+    // Reflected once after linking. Setters hash the name into this table instead of asking the
+    // driver (glGetUniformLocation) on every call. Unknown names give -1, which glUniform* ignores.
+    // ------------------------------------------------------------------------
+    GLint getUniformLocation(const char* name) const {
+        auto it = m_uniformLocations.find(std::string_view(name));
+        return it != m_uniformLocations.end() ? it->second : -1;
+    }
+
     // ------------------------------------------------------------------------
     // Uniform Setters
     // ------------------------------------------------------------------------
-    void setBool(const std::string &name, bool value) const {
-        glUniform1i(glGetUniformLocation(ID, name.c_str()), (int)value);
+    void setBool(const char* name, bool value) const {
+        glUniform1i(getUniformLocation(name), (int)value);
     }
 
-    void setInt(const std::string &name, int value) const {
-        glUniform1i(glGetUniformLocation(ID, name.c_str()), value);
+    void setInt(const char* name, int value) const {
+        glUniform1i(getUniformLocation(name), value);
     }
 
-    void setUInt(const std::string &name, unsigned int value) const {
-        glUniform1ui(glGetUniformLocation(ID, name.c_str()), value);
+    void setUInt(const char* name, unsigned int value) const {
+        glUniform1ui(getUniformLocation(name), value);
     }
 
-    void setFloat(const std::string &name, float value) const {
-        glUniform1f(glGetUniformLocation(ID, name.c_str()), value);
+    void setFloat(const char* name, float value) const {
+        glUniform1f(getUniformLocation(name), value);
     }
 
     // --- Vec2 ---
-    void setVec2(const std::string &name, const glm::vec2 &value) const {
-        glUniform2fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]);
+    void setVec2(const char* name, const glm::vec2 &value) const {
+        glUniform2fv(getUniformLocation(name), 1, &value[0]);
     }
-    void setVec2(const std::string &name, float x, float y) const {
-        glUniform2f(glGetUniformLocation(ID, name.c_str()), x, y);
+    void setVec2(const char* name, float x, float y) const {
+        glUniform2f(getUniformLocation(name), x, y);
     }
 
     // --- Vec3 ---
-    void setVec3(const std::string &name, const glm::vec3 &value) const {
-        glUniform3fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]);
+    void setVec3(const char* name, const glm::vec3 &value) const {
+        glUniform3fv(getUniformLocation(name), 1, &value[0]);
     }
-    void setVec3(const std::string &name, float x, float y, float z) const {
-        glUniform3f(glGetUniformLocation(ID, name.c_str()), x, y, z);
+    void setVec3(const char* name, float x, float y, float z) const {
+        glUniform3f(getUniformLocation(name), x, y, z);
     }
 
     // --- Vec4 ---
-    void setVec4(const std::string &name, const glm::vec4 &value) const {
-        glUniform4fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]);
+    void setVec4(const char* name, const glm::vec4 &value) const {
+        glUniform4fv(getUniformLocation(name), 1, &value[0]);
     }
-    void setVec4(const std::string &name, float x, float y, float z, float w) const {
-        glUniform4f(glGetUniformLocation(ID, name.c_str()), x, y, z, w);
+    void setVec4(const char* name, float x, float y, float z, float w) const {
+        glUniform4f(getUniformLocation(name), x, y, z, w);
     }
 
     // --- Matrices ---
-    void setMat2(const std::string &name, const glm::mat2 &mat) const {
-        glUniformMatrix2fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+    void setMat2(const char* name, const glm::mat2 &mat) const {
+        glUniformMatrix2fv(getUniformLocation(name), 1, GL_FALSE, &mat[0][0]);
     }
 
-    void setMat3(const std::string &name, const glm::mat3 &mat) const {
-        glUniformMatrix3fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+    void setMat3(const char* name, const glm::mat3 &mat) const {
+        glUniformMatrix3fv(getUniformLocation(name), 1, GL_FALSE, &mat[0][0]);
     }
 
-    void setMat4(const std::string &name, const glm::mat4 &mat) const {
-        glUniformMatrix4fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+    void setMat4(const char* name, const glm::mat4 &mat) const {
+        glUniformMatrix4fv(getUniformLocation(name), 1, GL_FALSE, &mat[0][0]);
     }
     
     // Keep the raw pointer version just in case
-    void setMat4(const std::string &name, const float* value) const {
-        glUniformMatrix4fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, value);
+    void setMat4(const char* name, const float* value) const {
+        glUniformMatrix4fv(getUniformLocation(name), 1, GL_FALSE, value);
     }
 
 private:
+    std::vector<std::string> m_uniformNames;                          // Arrays are stored without the "[0]" suffix
+    std::unordered_map<std::string_view, GLint> m_uniformLocations;  // Keys view m_uniformNames
+
+    static std::string& GlobalDefines() {
+        static std::string defines;
+        return defines;
+    }
+
+    static void InjectGlobalDefines(std::string &code) {
+        if (GlobalDefines().empty()) return;
+        size_t versionPos = code.find("#version");
+        size_t insertPos = (versionPos == std::string::npos) ? 0 : code.find('\n', versionPos);
+        insertPos = (insertPos == std::string::npos) ? code.size() : insertPos + 1;
+        code.insert(insertPos, GlobalDefines());
+    }
+
+    // Default-block uniforms only. Block members and atomic counters have no location and are skipped.
+    void CacheUniformLocations() {
+        m_uniformNames.clear();
+        m_uniformLocations.clear();
+        GLint count = 0, maxLength = 0;
+        glGetProgramiv(ID, GL_ACTIVE_UNIFORMS, &count);
+        glGetProgramiv(ID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+        if (count <= 0 || maxLength <= 0) return;
+
+        std::vector<char> name((size_t)maxLength);
+        std::vector<GLint> locations;
+        for (GLint i = 0; i < count; i++) {
+            GLsizei length = 0;
+            GLint size = 0;
+            GLenum type = 0;
+            glGetActiveUniform(ID, (GLuint)i, maxLength, &length, &size, &type, name.data());
+            GLint location = glGetUniformLocation(ID, name.data());
+            if (location < 0) continue;
+
+            std::string key(name.data(), (size_t)length);
+            if (key.size() > 3 && key.compare(key.size() - 3, 3, "[0]") == 0) key.resize(key.size() - 3);
+            m_uniformNames.push_back(std::move(key));
+            locations.push_back(location);
+        }
+
+        // Names are final now, the views stay valid
+        m_uniformLocations.reserve(m_uniformNames.size());
+        for (size_t i = 0; i < m_uniformNames.size(); i++) m_uniformLocations.emplace(m_uniformNames[i], locations[i]);
+    }
+
+    // Driver info logs go straight to the console (longer than a log record), after whatever is queued
     void checkCompileErrors(unsigned int shader, std::string type) {
         int success;
         char infoLog[1024];
@@ -170,12 +249,14 @@ private:
             glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
             if (!success) {
                 glGetShaderInfoLog(shader, 1024, NULL, infoLog);
+                Engine::Logger::Get().Flush();
                 std::cout << "[ERROR] SHADER_COMPILATION (" << type << "):\n" << infoLog << std::endl;
             }
         } else {
             glGetProgramiv(shader, GL_LINK_STATUS, &success);
             if (!success) {
                 glGetProgramInfoLog(shader, 1024, NULL, infoLog);
+                Engine::Logger::Get().Flush();
                 std::cout << "[ERROR] PROGRAM_LINKING:\n" << infoLog << std::endl;
             }
         }
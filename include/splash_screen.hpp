@@ -7,6 +7,7 @@
 #include <imgui_impl_opengl3.h>
 #include <iostream>
 #include "ImGuiManager.hpp"
+#include "logger.h"
 
 // a quick one off "splash screen" so the player doesnt think the computer just froze (although it is kind of, its allocating vram)
 void RenderLoadingScreen(GLFWwindow* window, ImGuiManager &gui, float HEAP_SIZE_FOR_DISPLAYING) {
@@ -66,4 +67,48 @@ void RenderLoadingScreen(GLFWwindow* window, ImGuiManager &gui, float HEAP_SIZE_
     // Force synchronization before hanging the CPU
     glFinish(); 
     std::this_thread::sleep_for(std::chrono::milliseconds(100));
-}
\ No newline at end of file
+}
+// Holds the splash until the spawn area is streamed in (or we give up), so the player doesn't watch terrain pop in.
+// Keeps pumping World::Update and applies its render snapshots, which is what uploads finished meshes on this thread.
+// Returns true if the area became ready before the timeout.
+bool RenderWarmStartScreen(GLFWwindow* window, ImGuiManager &gui, World& world, glm::vec3 spawnPos, int radiusChunks, float timeoutSeconds) {
+    double start = glfwGetTime();
+    size_t active = 0, tracked = 0;
+
+    while (!glfwWindowShouldClose(window)) {
+        world.Update(spawnPos);
+        world.SyncStreaming();
+        world.ApplyRenderSnapshot();
+        if (world.IsAreaReady(spawnPos, radiusChunks, active, tracked)) return true;
+        if (glfwGetTime() - start > timeoutSeconds) {
+            GOOSE_LOG_WARN("Main", "Warm start timed out after " << timeoutSeconds << "s (" << active << "/" << tracked << " spawn chunks active)");
+            return false;
+        }
+
+        int display_w, display_h;
+        glfwGetFramebufferSize(window, &display_w, &display_h);
+        glViewport(0, 0, display_w, display_h);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        gui.BeginFrame();
+        ImVec2 center = ImGui::GetMainViewport()->GetCenter();
+        ImGui::SetNextWindowPos(center, ImGuiCond_Always, ImVec2(0.5f, 0.5f));
+        ImGui::Begin("Loading", nullptr, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoInputs);
+        ImGui::SetWindowFontScale(3.0f);
+        ImGui::TextColored(ImVec4(1, 1, 0, 1), "Goose Cube Engine");
+        ImGui::SetWindowFontScale(2.0f);
+        ImGui::Separator();
+        ImGui::Text("Generating Spawn Area...");
+        float progress = (tracked > 0) ? (float)active / (float)tracked : 0.0f;
+        ImGui::ProgressBar(progress, ImVec2(400.0f, 0.0f));
+        ImGui::Text("%zu / %zu chunks", active, tracked);
+        ImGui::End();
+        gui.EndFrame();
+
+        glfwSwapBuffers(window);
+        glfwPollEvents();
+    }
+    return false;
+}
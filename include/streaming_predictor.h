@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cmath>
+#include <algorithm>
+#include <glm/glm.hpp>
+
+// ================================================================================================
+//                                    STREAMING PREDICTOR
+// The LOD rings are centred on where the camera IS, but a chunk requested now only shows up after
+// generation + meshing + upload. At sprint / flight speeds the leading edge of the ring is always
+// behind. This extrapolates the camera over that latency so the LOD job can also request the rings
+// around where the camera WILL be.
+//   predicted = p + v*T + 1/2*a*T^2, with T = measured request->ACTIVE latency (clamped)
+// Pure math, no GL / world access.
+// ================================================================================================
+
+class StreamingPredictor {
+public:
+    static constexpr float MIN_HORIZON_SECONDS = 0.25f;
+    static constexpr float MAX_HORIZON_SECONDS = 2.0f;
+    static constexpr float MIN_PREDICT_SPEED = 2.0f; // Below this (units/s) we just stream around the camera
+
+    /**
+     * @brief Feeds one frame of camera motion. Acceleration is a smoothed finite difference.
+     */
+    void Update(glm::vec3 velocity, float dt) {
+        if (dt <= 0.0f) return;
+        if (m_hasPrevious) {
+            glm::vec3 rawAccel = (velocity - m_prevVelocity) / dt;
+            float blend = std::min(1.0f, dt * ACCEL_SMOOTHING);
+            m_acceleration = glm::mix(m_acceleration, rawAccel, blend);
+        }
+        m_prevVelocity = velocity;
+        m_hasPrevious = true;
+    }
+
+    /**
+     * @brief Records how long a chunk took from request to ACTIVE (exponential moving average).
+     */
+    void RecordLoadLatency(float seconds) {
+        if (seconds <= 0.0f) return;
+        m_latency = m_hasLatency ? glm::mix(m_latency, seconds, LATENCY_SMOOTHING) : seconds;
+        m_hasLatency = true;
+    }
+
+    /**
+     * @brief Look-ahead time: the streaming latency we actually measured, clamped to something sane.
+     */
+    float GetHorizon() const {
+        float horizon = m_hasLatency ? m_latency : MIN_HORIZON_SECONDS;
+        return std::clamp(horizon, MIN_HORIZON_SECONDS, MAX_HORIZON_SECONDS);
+    }
+
+    /**
+     * @brief Extrapolates the camera position over the streaming horizon.
+     * @param maxDistance Cap on how far ahead we predict (world units), usually the LOD 0 ring size.
+     */
+    glm::vec3 Predict(glm::vec3 position, glm::vec3 velocity, float maxDistance) const {
+        if (glm::length(velocity) < MIN_PREDICT_SPEED) return position;
+
+        float t = GetHorizon();
+        glm::vec3 offset = velocity * t + m_acceleration * (0.5f * t * t);
+
+        // Braking hard can flip the parabola behind us; never predict backwards
+        if (glm::dot(offset, velocity) < 0.0f) return position;
+
+        float dist = glm::length(offset);
+        if (dist > maxDistance && dist > 0.0f) offset = offset * (maxDistance / dist);
+        return position + offset;
+    }
+
+    float GetLatency() const { return m_hasLatency ? m_latency : 0.0f; }
+    glm::vec3 GetAcceleration() const { return m_acceleration; }
+
+private:
+    static constexpr float ACCEL_SMOOTHING = 8.0f;      // ~1/8 s time constant
+    static constexpr float LATENCY_SMOOTHING = 0.05f;   // Per sample
+
+    glm::vec3 m_prevVelocity = glm::vec3(0.0f);
+    glm::vec3 m_acceleration = glm::vec3(0.0f);
+    bool m_hasPrevious = false;
+
+    float m_latency = 0.0f;
+    bool m_hasLatency = false;
+};
@@ -109,6 +109,8 @@ public:
     // --------------------------------------------------------------------------------------------
     // ASSET MANAGEMENT
     // --------------------------------------------------------------------------------------------
+    const char* GetName() const override { return "Advanced"; }
+
     // Returns list of textures required by this generator for the texture atlas.
     std::vector<std::string> GetTexturePaths() const override {
         //std::vector<std::string> textures(30, "resources/textures/dirt1.jpg");
@@ -207,6 +209,104 @@ public:
         maxH = m_settings.maxWorldHeight;
     }
 
+    // --------------------------------------------------------------------------------------------
+    // GENERATE SURFACE COLUMNS (Far-Field Tiles)
+    // --------------------------------------------------------------------------------------------
+    // Same height/biome maps as GenerateChunk (Phase 1 + 2), but only the top block of each column
+    // is resolved. No 3D noise: caves and trees don't exist at far-field scales anyway.
+    void GenerateSurfaceColumns(TerrainColumn* columns, int cx, int cz, int lodScale) override {
+        static thread_local std::vector<float> bufferHeightMap;
+        static thread_local std::vector<float> bufferMountain;
+        static thread_local std::vector<float> bufferMegaPeak;
+        static thread_local std::vector<float> bufferCrater;
+        static thread_local std::vector<float> bufferTemperature;
+        static thread_local std::vector<float> bufferMoisture;
+
+        const int PADDED_CHUNK_SIZE = CHUNK_SIZE_PADDED;
+        const int size2D = PADDED_CHUNK_SIZE * PADDED_CHUNK_SIZE;
+        if (bufferHeightMap.size() != size2D) {
+            bufferHeightMap.resize(size2D); bufferMountain.resize(size2D); bufferMegaPeak.resize(size2D); bufferCrater.resize(size2D);
+            bufferTemperature.resize(size2D); bufferMoisture.resize(size2D);
+        }
+
+        float genScale = m_settings.coordinateScale;
+        float worldStartX = (float)((cx * CHUNK_SIZE - 1) * lodScale);
+        float worldStartZ = (float)((cz * CHUNK_SIZE - 1) * lodScale);
+        float worldStep   = (float)lodScale;
+
+        // --- PHASE 1: Noise Maps (identical to GenerateChunk so tiles line up with the voxel LODs) ---
+        m_baseTerrainNoise->GenUniformGrid2D(bufferHeightMap.data(), worldStartX * genScale * m_settings.hillFrequency, worldStartZ * genScale * m_settings.hillFrequency, PADDED_CHUNK_SIZE, PADDED_CHUNK_SIZE, worldStep * genScale * m_settings.hillFrequency, worldStep * genScale * m_settings.hillFrequency, m_settings.seed);
+        m_mountainNoise->GenUniformGrid2D(bufferMountain.data(), worldStartX * genScale * 0.5f * m_settings.mountainFrequency, worldStartZ * genScale * 0.5f * m_settings.mountainFrequency, PADDED_CHUNK_SIZE, PADDED_CHUNK_SIZE, worldStep * genScale * 0.5f * m_settings.mountainFrequency, worldStep * genScale * 0.5f * m_settings.mountainFrequency, m_settings.seed + 1);
+        m_megaPeakNoise->GenUniformGrid2D(bufferMegaPeak.data(), worldStartX * genScale * m_settings.megaPeakRarity * 0.1f, worldStartZ * genScale * m_settings.megaPeakRarity * 0.1f, PADDED_CHUNK_SIZE, PADDED_CHUNK_SIZE, worldStep * genScale * m_settings.megaPeakRarity * 0.1f, worldStep * genScale * m_settings.megaPeakRarity * 0.1f, m_settings.seed + 99);
+        m_craterNoise->GenUniformGrid2D(bufferCrater.data(), worldStartX * genScale * m_settings.craterScale * 0.1f, worldStartZ * genScale * m_settings.craterScale * 0.1f, PADDED_CHUNK_SIZE, PADDED_CHUNK_SIZE, worldStep * genScale * m_settings.craterScale * 0.1f, worldStep * genScale * m_settings.craterScale * 0.1f, m_settings.seed + 55);
+        m_temperatureNoise->GenUniformGrid2D(bufferTemperature.data(), worldStartX * genScale * m_settings.biomeMapScale, worldStartZ * genScale * m_settings.biomeMapScale, PADDED_CHUNK_SIZE, PADDED_CHUNK_SIZE, worldStep * genScale * m_settings.biomeMapScale, worldStep * genScale * m_settings.biomeMapScale, m_settings.seed + 2);
+        m_moistureNoise->GenUniformGrid2D(bufferMoisture.data(), worldStartX * genScale * m_settings.biomeMapScale, worldStartZ * genScale * m_settings.biomeMapScale, PADDED_CHUNK_SIZE, PADDED_CHUNK_SIZE, worldStep * genScale * m_settings.biomeMapScale, worldStep * genScale * m_settings.biomeMapScale, m_settings.seed + 3);
+
+        // --- PHASE 2: Heights, Biomes, Top Block ---
+        for (int i = 0; i < size2D; i++) {
+            float megaVal = bufferMegaPeak[i];
+            float megaBoost = 0.0f;
+            if (megaVal > m_settings.megaPeakThreshold) {
+                float factor = (megaVal - m_settings.megaPeakThreshold) / (1.0f - m_settings.megaPeakThreshold);
+                megaBoost = (factor * factor) * m_settings.megaPeakHeight;
+            }
+
+            float craterVal = bufferCrater[i];
+            float craterMod = 0.0f;
+            bool inCrater = craterVal > m_settings.craterTriggerThreshold;
+            if (inCrater) {
+                float factor = (craterVal - m_settings.craterTriggerThreshold) / (1.0f - m_settings.craterTriggerThreshold);
+                float shape = std::sin(factor * 3.14159f);
+                float lift = shape * m_settings.craterFloorLift;
+                float rim = shape * (m_settings.craterDepth * m_settings.craterRimWidth);
+                float dig = (factor * factor) * m_settings.craterDepth;
+                craterMod = lift + rim - dig;
+            }
+
+            float mntPower = std::pow(std::abs(bufferMountain[i]), 3);
+            float finalH = m_settings.minimumHeight + (bufferHeightMap[i] * m_settings.hillAmplitude) + (mntPower * m_settings.mountainAmplitude) + megaBoost + craterMod;
+            int h = (int)std::clamp(finalH, 0.0f, (float)m_settings.maxWorldHeight);
+
+            float temp = bufferTemperature[i] - (h - m_settings.seaLevel) * 0.005f;
+            float moist = bufferMoisture[i];
+            uint8_t biome = 0;
+            if (temp > 0.4f && moist < -0.2f) biome = 2; // Desert
+            else if (temp < -0.3f || h > 220) biome = 3; // Snow/Peak
+            else if (moist > 0.2f) biome = 1;            // Forest
+
+            // The voxel LODs sample y = k * lodScale, so the visible top block is the last sample <= h
+            TerrainColumn column;
+            int topY = FloorDivide(h, lodScale) * lodScale;
+            column.surfaceHeight = h;
+            if (topY <= m_settings.bedrockDepth) {
+                column.surfaceBlock = Block::OBSIDIAN;
+                column.fillerBlock = Block::OBSIDIAN;
+            } else if (inCrater) {
+                column.surfaceBlock = Block::OBSIDIAN;
+                column.fillerBlock = Block::OBSIDIAN;
+            } else if (topY > 220) {
+                column.surfaceBlock = Block::SNOW;
+                column.fillerBlock = Block::ICE;
+            } else {
+                column.surfaceBlock = (biome == 2) ? Block::SAND : (biome == 3 ? Block::SNOW : Block::GRASS);
+                column.fillerBlock = (biome == 2) ? Block::SANDSTONE : (biome == 3 ? Block::SNOW : Block::DIRT);
+            }
+
+            // Sea: ice is opaque and becomes the surface, water is drawn over the sea floor
+            if (h < m_settings.seaLevel) {
+                if (biome == 3) {
+                    column.surfaceHeight = m_settings.seaLevel;
+                    column.surfaceBlock = Block::ICE;
+                    column.fillerBlock = Block::ICE;
+                } else {
+                    column.fluidBlock = Block::WATER;
+                    column.fluidHeight = m_settings.seaLevel;
+                }
+            }
+            columns[i] = column;
+        }
+    }
+
     // --------------------------------------------------------------------------------------------
     // GET BLOCK (Single Voxel)
     // --------------------------------------------------------------------------------------------
@@ -222,7 +322,7 @@ public:
         int surfaceHeight = GetHeight(x, z);
 
         // 2. Bedrock Layer (Bottom of world)
-        if (worldY <= m_settings.bedrockDepth) return 19; // ID 19: Adminium/Bedrock
+        if (worldY <= m_settings.bedrockDepth) return Block::OBSIDIAN; // Adminium/Bedrock
 
         // 3. Biome Calculation
         float normalizedX = x * m_settings.coordinateScale;
@@ -263,13 +363,13 @@ public:
                                 
                                 // Trunk Logic
                                 if (distSq == 0) {
-                                    if ((treeType == 1 || treeType == 2) && relativeY > 0 && relativeY < 6) return (treeType == 2) ? 15 : 13; // Log IDs
-                                    if (treeType == 3 && relativeY > 0 && relativeY < 4) return 14; // Cactus Green
+                                    if ((treeType == 1 || treeType == 2) && relativeY > 0 && relativeY < 6) return (treeType == 2) ? Block::SPRUCE_LOG : Block::OAK_LOG; // Log IDs
+                                    if (treeType == 3 && relativeY > 0 && relativeY < 4) return Block::OAK_LEAVES; // Cactus Green
                                 } 
                                 // Leaves Logic
                                 else {
-                                    if (treeType == 1 && relativeY >= 4 && relativeY <= 6 && distSq <= 2) return 14; // Oak Leaves
-                                    if (treeType == 2 && relativeY >= 3 && relativeY <= 6 && distSq <= 2) return 16; // Pine Leaves
+                                    if (treeType == 1 && relativeY >= 4 && relativeY <= 6 && distSq <= 2) return Block::OAK_LEAVES; // Oak Leaves
+                                    if (treeType == 2 && relativeY >= 3 && relativeY <= 6 && distSq <= 2) return Block::SPRUCE_LEAVES; // Pine Leaves
                                 }
                             }
                          }
@@ -280,36 +380,36 @@ public:
 
         // 5. Standard Terrain Fill (Air/Water)
         if (worldY > surfaceHeight) {
-            if (worldY <= m_settings.seaLevel) return (biomeID == 3) ? 12 : 6; // Ice or Water
-            return 0; // Air
+            if (worldY <= m_settings.seaLevel) return (biomeID == 3) ? Block::ICE : Block::WATER; // Ice or Water
+            return Block::AIR; // Air
         }
 
         // 6. Underground vs Surface Blocks
         int depth = surfaceHeight - worldY;
-        uint8_t blockID = 3; // Default Stone
+        uint8_t blockID = Block::STONE; // Default Stone
         
         // Topsoil layers
         if (depth < lodScale) {
-            blockID = (biomeID == 2) ? 5 : (biomeID == 3 ? 4 : 1); // Sand, Snow, or Grass
+            blockID = (biomeID == 2) ? Block::SAND : (biomeID == 3 ? Block::SNOW : Block::GRASS); // Sand, Snow, or Grass
         } else if (depth < (4 * lodScale)) {
-            blockID = (biomeID == 2) ? 11 : (biomeID == 3 ? 4 : 2); // Sandstone, Snow, or Dirt
+            blockID = (biomeID == 2) ? Block::SANDSTONE : (biomeID == 3 ? Block::SNOW : Block::DIRT); // Sandstone, Snow, or Dirt
         }
         
         // High altitude override (Bare stone/snow on peaks)
         if (worldY > 220) {
-            if (depth < lodScale) blockID = 4; // Snow block
-            else if (depth < (10 * lodScale)) blockID = 12; // Ice
-            else blockID = 19; // Stone/Rock
+            if (depth < lodScale) blockID = Block::SNOW; // Snow block
+            else if (depth < (10 * lodScale)) blockID = Block::ICE; // Ice
+            else blockID = Block::OBSIDIAN; // Stone/Rock
         }
 
         // --- VOLCANIC OVERRIDE (Physics Check) ---
         // If we are in a crater, replace surface blocks with obsidian/lava rock
         float craterZone = m_craterNoise->GenSingle2D(normalizedX * m_settings.craterScale * 0.1f, normalizedZ * m_settings.craterScale * 0.1f, m_settings.seed + 55);
         if (craterZone > m_settings.craterTriggerThreshold && worldY <= surfaceHeight) {
-             if (blockID != 0 && blockID != 6 && blockID != 19) {
+             if (blockID != Block::AIR && blockID != Block::WATER && blockID != Block::OBSIDIAN) {
                  float factor = (craterZone - m_settings.craterTriggerThreshold) / (1.0f - m_settings.craterTriggerThreshold);
-                 if (factor > 0.2f) blockID = 19; // Center = Obsidian
-                 else blockID = 19;               // Rim = Red Stone Mix
+                 if (factor > 0.2f) blockID = Block::OBSIDIAN; // Center = Obsidian
+                 else blockID = Block::OBSIDIAN;               // Rim = Red Stone Mix
              }
         }
 
@@ -324,7 +424,7 @@ public:
              if (depthFromSurface < 8) surfaceBias = (8 - depthFromSurface) * 0.08f; 
              
              // If noise is high enough, cut air
-             if ((caveVal - surfaceBias) > 0.4f) return 0;
+             if ((caveVal - surfaceBias) > 0.4f) return Block::AIR;
         }
 
         return blockID; 
@@ -464,40 +564,41 @@ public:
             for (int z = 0; z < PADDED_CHUNK_SIZE; z++) {
                 for (int x = 0; x < PADDED_CHUNK_SIZE; x++) {
                     int idx2D = x + (z * PADDED_CHUNK_SIZE);
-                    int idx3D = x + (z * PADDED_CHUNK_SIZE) + (y * PADDED_CHUNK_SIZE * PADDED_CHUNK_SIZE); 
+                    int idx3D = x + (z * PADDED_CHUNK_SIZE) + (y * PADDED_CHUNK_SIZE * PADDED_CHUNK_SIZE); // Noise buffer (always linear)
+                    int idxVoxel = chunk->GetIndex(x, y, z);                                               // Chunk storage (layout dependent)
                     
                     int h = mapFinalHeight[idx2D];
                     uint8_t biome = mapBiomeID[idx2D];
-                    uint8_t block = 0;
+                    uint8_t block = Block::AIR;
 
                     // A. Solid Ground Logic
                     if (currentWorldY <= m_settings.bedrockDepth && currentWorldY >= 0) {
-                        block = 19; // Bedrock
+                        block = Block::OBSIDIAN; // Bedrock
                     } else if (currentWorldY <= h) {
-                        block = 3; // Stone Base
+                        block = Block::STONE; // Stone Base
                         int depth = h - currentWorldY;
                         
                         // Topsoil logic
                         if (depth < lodScale) {
-                            block = (biome == 2) ? 5 : (biome == 3 ? 4 : 1);
+                            block = (biome == 2) ? Block::SAND : (biome == 3 ? Block::SNOW : Block::GRASS);
                         } else if (depth < (4 * lodScale)) {
-                            block = (biome == 2) ? 11 : (biome == 3 ? 4 : 2);
+                            block = (biome == 2) ? Block::SANDSTONE : (biome == 3 ? Block::SNOW : Block::DIRT);
                         }
                         
                         // Mountain caps
                         if (currentWorldY > 220) {
-                            if (depth < lodScale) block = 4;
-                            else if (depth < (10 * lodScale)) block = 12;
-                            else block = 19;
+                            if (depth < lodScale) block = Block::SNOW;
+                            else if (depth < (10 * lodScale)) block = Block::ICE;
+                            else block = Block::OBSIDIAN;
                         }
 
                         // Volcanic/Crater Surface Replacement
                         float craterVal = bufferCrater[idx2D];
                         if (craterVal > m_settings.craterTriggerThreshold && currentWorldY > m_settings.bedrockDepth) {
-                             if (block != 0 && block != 6 && block != 19) {
+                             if (block != Block::AIR && block != Block::WATER && block != Block::OBSIDIAN) {
                                  float factor = (craterVal - m_settings.craterTriggerThreshold) / (1.0f - m_settings.craterTriggerThreshold);
-                                 if (factor > 0.2f) block = 19; // Obsidian
-                                 else block = 19; // Rim Rock
+                                 if (factor > 0.2f) block = Block::OBSIDIAN; // Obsidian
+                                 else block = Block::OBSIDIAN; // Rim Rock
                              }
                         }
 
@@ -507,14 +608,14 @@ public:
                              float surfaceBias = 0.0f;
                              if (depthFromSurface < 8) surfaceBias = (8 - depthFromSurface) * 0.08f; 
                              
-                             if ((bufferCave3D[idx3D] - surfaceBias) > 0.4f) block = 0;
+                             if ((bufferCave3D[idx3D] - surfaceBias) > 0.4f) block = Block::AIR;
                         }
                     } else if (currentWorldY <= m_settings.seaLevel) {
                         block = (biome == 3) ? 12 : 6; // Water or Ice
                     }
 
                     // B. Tree & Decoration Logic
-                    if (lodScale == 1 && block == 0) {
+                    if (lodScale == 1 && block == Block::AIR) {
                         // Check if THIS block is a tree trunk source
                         int treeTypeHere = mapTreeData[idx2D];
                         int relY = currentWorldY - h;
@@ -535,13 +636,13 @@ public:
                             
                             // Place Trunk
                             if (treeTypeHere > 0) {
-                                if ((treeTypeHere == 1 || treeTypeHere == 2) && relY > 0 && relY < 6) block = (treeTypeHere == 2) ? 15 : 13;
-                                else if (treeTypeHere == 3 && relY > 0 && relY < 4) block = 14;
+                                if ((treeTypeHere == 1 || treeTypeHere == 2) && relY > 0 && relY < 6) block = (treeTypeHere == 2) ? Block::SPRUCE_LOG : Block::OAK_LOG;
+                                else if (treeTypeHere == 3 && relY > 0 && relY < 4) block = Block::OAK_LEAVES;
                             }
                         }
                         
                         // Check Neighbors for Leaves (if not a trunk)
-                        if (block == 0) {
+                        if (block == Block::AIR) {
                             for (int nz = -1; nz <= 1; nz++) {
                                 for (int nx = -1; nx <= 1; nx++) {
                                     if (nx == 0 && nz == 0) continue; // Skip self
@@ -553,9 +654,9 @@ public:
                                         int nRelY = currentWorldY - mapFinalHeight[ni];
                                         
                                         // Oak Leaves
-                                        if (nTree == 1 && nRelY >= 4 && nRelY <= 6) block = 14;
+                                        if (nTree == 1 && nRelY >= 4 && nRelY <= 6) block = Block::OAK_LEAVES;
                                         // Pine Leaves
-                                        else if (nTree == 2 && nRelY >= 3 && nRelY <= 6) block = 16;
+                                        else if (nTree == 2 && nRelY >= 3 && nRelY <= 6) block = Block::SPRUCE_LEAVES;
                                     }
                                 }
                             }
@@ -563,7 +664,7 @@ public:
                     }
                     
                     // Final Write
-                    voxels[idx3D] = block;
+                    voxels[idxVoxel] = block;
                 }
             }
         }
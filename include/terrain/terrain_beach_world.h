@@ -52,6 +52,7 @@ public:
         // 2. Optional: A warper or secondary noise for variation could go here
     }
 
+    const char* GetName() const override { return "Beach"; }
     std::vector<std::string> GetTexturePaths() const override {
         // Mapping typical to standard engine slots
         // 1=Grass, 2=Dirt, 3=Stone, 4=Snow, 5=Sand, 6=Water
@@ -138,14 +139,10 @@ public:
                 
                 // Indexing for Noise Buffer (X -> Y -> Z)
                 int noiseColBase = x + (z * sizeX * sizeY);
-                // Indexing for Chunk Voxel Array (X -> Z -> Y typically, or Z->X->Y)
-                // Assuming standard: x + (z * P) + (y * P * P)
-                int voxelColBase = x + (z * P);
-                int voxelStrideY = P * P;
 
                 for (int y = 0; y < P; y++) {
                     int wy = worldYBase + (y * lodScale);
-                    int idxVoxel = voxelColBase + (y * voxelStrideY);
+                    int idxVoxel = chunk->GetIndex(x, y, z);
                     
                     // -- Calculate Density --
                     int bufIdx = noiseColBase + (y * sizeX);
@@ -171,26 +168,26 @@ public:
 
                         if (isSurface) {
                             if (wy <= sandCap && wy >= seaLevel - 5) {
-                                voxels[idxVoxel] = 5; // Sand (Beach)
+                                voxels[idxVoxel] = Block::SAND; // Sand (Beach)
                             } else if (wy < seaLevel - 5) {
-                                voxels[idxVoxel] = 2; // Dirt/Gravel underwater
+                                voxels[idxVoxel] = Block::DIRT; // Dirt/Gravel underwater
                             } else {
-                                voxels[idxVoxel] = 1; // Grass (Cliff top)
+                                voxels[idxVoxel] = Block::GRASS; // Grass (Cliff top)
                             }
                         } else {
                             // Subsurface
                             if (wy <= sandCap && wy >= seaLevel - 2) {
-                                voxels[idxVoxel] = 5; // Deep Sand
+                                voxels[idxVoxel] = Block::SAND; // Deep Sand
                             } else {
-                                voxels[idxVoxel] = 3; // Stone
+                                voxels[idxVoxel] = Block::STONE; // Stone
                             }
                         }
                     } else {
                         // IT IS AIR (or Water)
                         if (wy <= seaLevel) {
-                            voxels[idxVoxel] = 6; // Water
+                            voxels[idxVoxel] = Block::WATER; // Water
                         } else {
-                            voxels[idxVoxel] = 0; // Air
+                            voxels[idxVoxel] = Block::AIR; // Air
                         }
                     }
                 }
@@ -212,15 +209,15 @@ public:
             bool isSurface = (densityAbove <= m_settings.surfaceThreshold);
 
             if (isSurface) {
-                if (y <= m_settings.seaLevel + m_settings.sandHeight && y >= m_settings.seaLevel - 5) return 5; // Sand
-                if (y < m_settings.seaLevel) return 2; // Underwater dirt
-                return 1; // Grass
+                if (y <= m_settings.seaLevel + m_settings.sandHeight && y >= m_settings.seaLevel - 5) return Block::SAND; // Sand
+                if (y < m_settings.seaLevel) return Block::DIRT; // Underwater dirt
+                return Block::GRASS; // Grass
             }
-            return 3; // Stone
+            return Block::STONE; // Stone
         }
 
-        if (y <= m_settings.seaLevel) return 6; // Water
-        return 0; // Air
+        if (y <= m_settings.seaLevel) return Block::WATER; // Water
+        return Block::AIR; // Air
     }
 
     void GetHeightBounds(int cx, int cz, int scale, int& minH, int& maxH) override {
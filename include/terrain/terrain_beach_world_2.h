@@ -93,6 +93,7 @@ public:
         m_noise3D = fn3D;
     }
 
+    const char* GetName() const override { return "ComplexBiome"; }
     std::vector<std::string> GetTexturePaths() const override {
         // Matches fallback_texture_id_table.txt
         return {
@@ -245,8 +246,6 @@ public:
                 }
 
                 // --- 4. Vertical Loop (Voxels) ---
-                int colBase = x + (z * P);
-                int strideY = P * P;
                 float temp = bufTemp[idx2D];
                 float humid = bufHumid[idx2D];
                 
@@ -257,51 +256,51 @@ public:
 
                 for (int y = 0; y < P; y++) {
                     int wy = worldYBase + (y * lodScale);
-                    int idx = colBase + (y * strideY);
+                    int idx = chunk->GetIndex(x, y, z);
                     
-                    uint8_t block = 0;
+                    uint8_t block = Block::AIR;
 
                     // A. Heightmap Logic
                     if (wy <= finalH) {
-                        block = 3; // Default Stone
+                        block = Block::STONE; // Default Stone
                         
                         bool isSurface = (wy >= finalH - (2 * lodScale));
                         
                         // Biome Blocks
                         if (feature == FeatureType::Volcano) {
-                            if (isSurface) block = 19; // Obsidian
-                            else block = 3; 
+                            if (isSurface) block = Block::OBSIDIAN; // Obsidian
+                            else block = Block::STONE; 
                         } 
                         else if (feature == FeatureType::Crater) {
-                            if (isSurface) block = 9; // Gravel
-                            else block = 3;
+                            if (isSurface) block = Block::GRAVEL; // Gravel
+                            else block = Block::STONE;
                         }
                         else {
                             if (isSurface) {
-                                if (biomeId == 1) block = 5; // Sand
-                                else if (biomeId == 2) block = 4; // Snow
-                                else block = 1; // Grass
+                                if (biomeId == 1) block = Block::SAND; // Sand
+                                else if (biomeId == 2) block = Block::SNOW; // Snow
+                                else block = Block::GRASS; // Grass
                                 
                                 // Peak Logic
-                                if (wy > 180) block = 4; // Snow caps
-                                if (wy > 220) block = 12; // Ice peaks
+                                if (wy > 180) block = Block::SNOW; // Snow caps
+                                if (wy > 220) block = Block::ICE; // Ice peaks
                             } else {
                                 // Subsurface
-                                if (biomeId == 1) block = 11; // Sandstone
-                                else block = 2; // Dirt
+                                if (biomeId == 1) block = Block::SANDSTONE; // Sandstone
+                                else block = Block::DIRT; // Dirt
                             }
                         }
                     }
 
                     // B. Water / Lava
-                    if (block == 0) {
+                    if (block == Block::AIR) {
                         if (wy <= m_settings.seaLevel) {
-                             if (biomeId == 2) block = 12; // Ice
-                             else block = 6; // Water
+                             if (biomeId == 2) block = Block::ICE; // Ice
+                             else block = Block::WATER; // Water
                         }
                         // Lava in volcano center
                         if (feature == FeatureType::Volcano && distNorm < 0.1f && wy < (finalH + 20) && wy > 10) {
-                            block = 20; // Lava
+                            block = Block::LAVA; // Lava
                         }
                     }
 
@@ -311,16 +310,16 @@ public:
                             float n3 = m_noise3D->GenSingle3D(wx * m_settings.noise3DScale, (float)wy * m_settings.noise3DScale, wz * m_settings.noise3DScale, m_settings.seed);
                             
                             // Cave Carver
-                            if (block != 0 && block != 6 && block != 20) { // Don't carve water/lava
-                                if (n3 < -0.4f) block = 0; 
+                            if (block != Block::AIR && block != Block::WATER && block != Block::LAVA) { // Don't carve water/lava
+                                if (n3 < -0.4f) block = Block::AIR; 
                             }
 
                             // Overhang Adder
-                            if (block == 0 && wy > m_settings.seaLevel) {
+                            if (block == Block::AIR && wy > m_settings.seaLevel) {
                                 if (n3 > m_settings.noise3DThreshold) {
                                     float n3Above = m_noise3D->GenSingle3D(wx * m_settings.noise3DScale, (float)(wy + 1) * m_settings.noise3DScale, wz * m_settings.noise3DScale, m_settings.seed);
-                                    if (n3Above <= m_settings.noise3DThreshold) block = 1; // Top (Grass)
-                                    else block = 3; // Body (Stone)
+                                    if (n3Above <= m_settings.noise3DThreshold) block = Block::GRASS; // Top (Grass)
+                                    else block = Block::STONE; // Body (Stone)
                                 }
                             }
                         }
@@ -387,15 +386,15 @@ public:
              }
         }
 
-        if (y <= finalH) return 3; // Stone
-        if (y <= m_settings.seaLevel) return 6; // Water
+        if (y <= finalH) return Block::STONE; // Stone
+        if (y <= m_settings.seaLevel) return Block::WATER; // Water
         
         if (m_settings.enable3D) {
              float n3 = m_noise3D->GenSingle3D(x * m_settings.noise3DScale, y * m_settings.noise3DScale, z * m_settings.noise3DScale, m_settings.seed);
-             if (n3 > m_settings.noise3DThreshold) return 3; 
+             if (n3 > m_settings.noise3DThreshold) return Block::STONE; 
         }
 
-        return 0;
+        return Block::AIR;
     }
 
     void GetHeightBounds(int cx, int cz, int scale, int& minH, int& maxH) override {
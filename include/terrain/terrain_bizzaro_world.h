@@ -53,6 +53,7 @@ public:
     
     // Bounds & Textures
     void GetHeightBounds(int cx, int cz, int scale, int& minH, int& maxH) override;
+    const char* GetName() const override { return "Bizzaro"; }
     std::vector<std::string> GetTexturePaths() const override;
     
     // UI
@@ -128,7 +129,7 @@ uint8_t BizzaroGenerator::GetBlock(float x, float y, float z, int lodScale) cons
         finalH += m_settings.obeliskHeight;
     }
 
-    if (y > finalH) return 0; // Air
+    if (y > finalH) return Block::AIR; // Air
 
     if (isObelisk && y > terrainH) {
         return (uint8_t)m_settings.matObelisk;
@@ -226,21 +227,18 @@ void BizzaroGenerator::GenerateChunk(Chunk* chunk, int cx, int cy, int cz, int l
 
     for (int y = 0; y < P; y++) {
         int worldY = worldYBase + (y * lodScale);
-        int chunkStrideY = P * P;
-        int voxelIdxBase = y * chunkStrideY; 
 
         for (int z = 0; z < P; z++) {
             int mapRowOffset = z * P; 
-            int chunkRowOffset = z * P; 
 
             for (int x = 0; x < P; x++) {
                 int i2D = x + mapRowOffset;
-                int idxVoxel = voxelIdxBase + chunkRowOffset + x;
+                int idxVoxel = chunk->GetIndex(x, y, z);
 
                 int h = mapHeight[i2D];
                 
                 if (worldY > h) {
-                    voxels[idxVoxel] = 0; // Air
+                    voxels[idxVoxel] = Block::AIR; // Air
                 } else {
                     uint8_t mat = mapMat[i2D]; 
                     int depth = h - worldY;
@@ -252,7 +250,7 @@ void BizzaroGenerator::GenerateChunk(Chunk* chunk, int cx, int cy, int cz, int l
                     else {
                         if (depth == 0) voxels[idxVoxel] = mat; 
                         else if (depth < 4) voxels[idxVoxel] = (uint8_t)matSub; 
-                        else voxels[idxVoxel] = 3; 
+                        else voxels[idxVoxel] = Block::STONE; 
                     }
                 }
             }
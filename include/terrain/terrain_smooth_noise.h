@@ -68,6 +68,7 @@ public:
     uint8_t GetBlock(float x, float y, float z, int lodScale) const override;
     void GetHeightBounds(int cx, int cz, int scale, int& minH, int& maxH) override;
     
+    const char* GetName() const override { return "Overhang"; }
     std::vector<std::string> GetTexturePaths() const override;
     void OnImGui() override;
 
@@ -178,8 +179,6 @@ void OverhangGenerator::GenerateChunk(Chunk* chunk, int cx, int cy, int cz, int
     for (int z = 0; z < P; z++) {
         for (int x = 0; x < P; x++) {
             
-            int colBaseIdx = x + (z * P); 
-            int strideY = P * P; // Voxel array stride
 
             // Buffer Indexing: FastNoise X, Y, Z order
             // Base offset for this X,Z column in the noise buffer
@@ -188,15 +187,15 @@ void OverhangGenerator::GenerateChunk(Chunk* chunk, int cx, int cy, int cz, int
 
             for (int y = 0; y < P; y++) {
                 int wy = worldYBase + (y * lodScale);
-                int idxVoxel = colBaseIdx + (y * strideY);
+                int idxVoxel = chunk->GetIndex(x, y, z);
                 
                 // Hard Limits
                 if (wy < hardFloor) {
-                    voxels[idxVoxel] = 3; // Bedrock/Stone
+                    voxels[idxVoxel] = Block::STONE; // Bedrock/Stone
                     continue;
                 }
                 if (wy > maxH) {
-                    voxels[idxVoxel] = 0; // Air
+                    voxels[idxVoxel] = Block::AIR; // Air
                     continue;
                 }
 
@@ -220,14 +219,14 @@ void OverhangGenerator::GenerateChunk(Chunk* chunk, int cx, int cy, int cz, int
                     float densityAbove = nAbove + gradAbove;
 
                     if (densityAbove <= threshold) {
-                        voxels[idxVoxel] = 1; // Grass
+                        voxels[idxVoxel] = Block::GRASS; // Grass
                     } else if (densityAbove < threshold + 0.2f) {
-                        voxels[idxVoxel] = 2; // Dirt
+                        voxels[idxVoxel] = Block::DIRT; // Dirt
                     } else {
-                        voxels[idxVoxel] = 3; // Stone
+                        voxels[idxVoxel] = Block::STONE; // Stone
                     }
                 } else {
-                    voxels[idxVoxel] = 0; // Air
+                    voxels[idxVoxel] = Block::AIR; // Air
                 }
             }
         }
@@ -236,8 +235,8 @@ void OverhangGenerator::GenerateChunk(Chunk* chunk, int cx, int cy, int cz, int
 
 uint8_t OverhangGenerator::GetBlock(float x, float y, float z, int lodScale) const {
     //Engine::Profiler::ScopedTimer timer("3D Noise World:: Get BLOCK");
-    if (y < m_settings.hardFloor) return 3; // Bedrock/Stone floor
-    if (y > m_settings.maxTerrainHeight) return 0; // Hard cap
+    if (y < m_settings.hardFloor) return Block::STONE; // Bedrock/Stone floor
+    if (y > m_settings.maxTerrainHeight) return Block::AIR; // Hard cap
 
     float density = GetDensity(x, y, z);
 
@@ -248,15 +247,15 @@ uint8_t OverhangGenerator::GetBlock(float x, float y, float z, int lodScale) con
         float densityAbove = GetDensity(x, y + 1.0f, z);
 
         if (densityAbove <= m_settings.threshold) {
-            return 1; // Grass (Surface)
+            return Block::GRASS; // Grass (Surface)
         } else if (densityAbove < m_settings.threshold + 0.2f) {
-            return 2; // Dirt (Just below surface)
+            return Block::DIRT; // Dirt (Just below surface)
         } else {
-            return 3; // Stone (Deep)
+            return Block::STONE; // Stone (Deep)
         }
     }
 
-    return 0; // Air
+    return Block::AIR; // Air
 }
 
 
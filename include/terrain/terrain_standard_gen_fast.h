@@ -50,6 +50,7 @@ public:
         m_caveNoise = FastNoise::New<FastNoise::Perlin>();
     }
 
+    const char* GetName() const override { return "Standard2"; }
     std::vector<std::string> GetTexturePaths() const override {
         return {
             "resources/textures/dirt1.jpg",    
@@ -85,22 +86,22 @@ public:
         if (wy < heightAtXZ && lodScale == 1) { 
             // Matches .cpp: y uses 0.04 (2x stretch), others 0.02
             float val = m_caveNoise->GenSingle3D(x * 0.02f, y * 0.04f, z * 0.02f, m_settings.seed);
-            if (val > m_settings.caveThreshold) return 0; // Air
+            if (val > m_settings.caveThreshold) return Block::AIR; // Air
         }
 
-        if (wy > heightAtXZ) return 0; 
+        if (wy > heightAtXZ) return Block::AIR; 
 
         if (wy == heightAtXZ) {
-            if (wy > 180) return 4; 
-            return 1; // Grass
+            if (wy > 180) return Block::SNOW; 
+            return Block::GRASS; // Grass
         } 
         else if (wy > heightAtXZ - (4 * lodScale)) {
-            return 2; // Dirt
+            return Block::DIRT; // Dirt
         }
         
-        if (wy == 0) return 4; // Bedrock
+        if (wy == 0) return Block::SNOW; // Bedrock (shares the snow slot)
 
-        return 3; // Stone
+        return Block::STONE; // Stone
     }
 
     // --------------------------------------------------------------------------------------------
@@ -182,10 +183,7 @@ public:
         uint8_t* voxels = chunk->voxels;
         float caveThresh = m_settings.caveThreshold;
         int worldYBase = (cy * CHUNK_SIZE * lodScale) - (1 * lodScale);
-        
-        // Pointers for stride optimization
-        int strideY = CHUNK_SIZE_PADDED * CHUNK_SIZE_PADDED; // New Chunk Layout Y-stride
-        int strideZ = CHUNK_SIZE_PADDED;                     // New Chunk Layout Z-stride
+
 
         for (int z = 0; z < CHUNK_SIZE_PADDED; z++) {
             for (int x = 0; x < CHUNK_SIZE_PADDED; x++) {
@@ -194,28 +192,24 @@ public:
                 int idxHeight = x + (z * CHUNK_SIZE_PADDED);
                 int height = heightMap[idxHeight];
 
-                // Chunk Index Base for this Column (x, z)
-                // New Chunk Layout: x + z*P + y*P*P
-                int colBaseIdx = x + (z * strideZ);
-
                 for (int y = 0; y < CHUNK_SIZE_PADDED; y++) {
                     int wy = worldYBase + (y * lodScale);
-                    int idxVoxel = colBaseIdx + (y * strideY);
+                    int idxVoxel = chunk->GetIndex(x, y, z);
                     
-                    uint8_t blockID = 0;
+                    uint8_t blockID = Block::AIR;
 
                     if (wy <= height) {
-                        blockID = 3; // Stone
-                        if (wy == height) blockID = (wy > 180) ? 4 : 1; // Grass/Snow
-                        else if (wy > height - (4 * lodScale)) blockID = 2; // Dirt
-                        else if (wy == 0) blockID = 4; // Bedrock
+                        blockID = Block::STONE; // Stone
+                        if (wy == height) blockID = (wy > 180) ? Block::SNOW : Block::GRASS; // Grass/Snow
+                        else if (wy > height - (4 * lodScale)) blockID = Block::DIRT; // Dirt
+                        else if (wy == 0) blockID = Block::SNOW; // Bedrock (shares the snow slot)
 
                         if (doCaves) {
                             // Cave Index: x + (y * P) + (z * P * P) ??
                             // NO. FastNoise GenUniformGrid3D produces: x + (y * P) + (z * P * P)
                             // We must match that exactly.
                             int idxCave = x + (y * CHUNK_SIZE_PADDED) + (z * CHUNK_SIZE_PADDED * CHUNK_SIZE_PADDED);
-                            if (bufCaves[idxCave] > caveThresh) blockID = 0;
+                            if (bufCaves[idxCave] > caveThresh) blockID = Block::AIR;
                         }
                     }
                     
@@ -23,6 +23,7 @@ public:
 
     void Init() override {}
 
+    const char* GetName() const override { return "Superflat"; }
     std::vector<std::string> GetTexturePaths() const override {
         std::vector<std::string> textures(30, "resources/textures/dirt1.jpg");
         return textures;
@@ -37,6 +38,15 @@ public:
         outMaxHeight = m_settings.floorLevel + (m_settings.enableStaircase ? 15 : 0); 
     }
 
+    // Far-field tiles: flat floor everywhere (the staircase only exists at LOD 0)
+    void GenerateSurfaceColumns(TerrainColumn* columns, int chunkX, int chunkZ, int lodScale) override {
+        TerrainColumn column;
+        column.surfaceHeight = m_settings.floorLevel;
+        column.surfaceBlock = (uint8_t)m_settings.floorBlockID;
+        column.fillerBlock = (uint8_t)m_settings.floorBlockID;
+        std::fill(columns, columns + HEIGHTFIELD_COLUMNS, column);
+    }
+
     // --------------------------------------------------------------------------------------------
     // GET BLOCK (Single Voxel Physics)
     // --------------------------------------------------------------------------------------------
@@ -66,7 +76,7 @@ public:
         // // 3. Flat Ground
         // if (integerWorldY <= m_settings.floorLevel && integerWorldY > 0) return (uint8_t)m_settings.floorBlockID;
 
-        return 0;
+        return Block::AIR;
     }
 
     // --------------------------------------------------------------------------------------------
@@ -77,7 +87,7 @@ public:
         const int PADDED_SIZE = CHUNK_SIZE_PADDED; 
         
         // we must ensure the buffer is clean. Otherwise, we see "ghost" structures from recycled chunks.
-        std::memset(chunk->voxels, 0, PADDED_SIZE * PADDED_SIZE * PADDED_SIZE * sizeof(uint8_t));
+        std::memset(chunk->voxels, 0, sizeof(chunk->voxels));
 
         // Calculate the world coordinate of the chunk's true origin
         int chunkOriginY = chunkY * CHUNK_SIZE * lodScale;
@@ -87,8 +97,6 @@ public:
         // We must account for this offset, otherwise visuals shift by 1 block!
         int arrayPaddingOffset = 1;
 
-        uint8_t* voxelData = chunk->voxels;
-
         // --- STEP 1: TERRAIN PASS ---
         for (int arrayY = 0; arrayY < PADDED_SIZE; arrayY++) {
             // Convert Array Index -> World Coordinate
@@ -98,7 +106,7 @@ public:
             uint8_t layerBlockID = 0;
 
             if (m_settings.enableBedrock && currentWorldY == 0) {
-                layerBlockID = 19; 
+                layerBlockID = Block::OBSIDIAN; 
             }
             else if (currentWorldY <= m_settings.floorLevel && currentWorldY > 0) {
                 layerBlockID = (uint8_t)m_settings.floorBlockID;
@@ -106,9 +114,10 @@ public:
 
             // Fill this entire Y-layer with the block
             if (layerBlockID != 0) {
-                for (int i = 0; i < PADDED_SIZE * PADDED_SIZE; i++) {
-                    int voxelIndex = i + (arrayY * PADDED_SIZE * PADDED_SIZE);
-                    voxelData[voxelIndex] = layerBlockID;
+                for (int arrayZ = 0; arrayZ < PADDED_SIZE; arrayZ++) {
+                    for (int arrayX = 0; arrayX < PADDED_SIZE; arrayX++) {
+                        chunk->Set(arrayX, arrayY, arrayZ, layerBlockID);
+                    }
                 }
             } else {
                 // (Optional) Explicitly clear air, though usually pre-zeroed
@@ -140,8 +149,7 @@ public:
                         arrayZ >= 0 && arrayZ < PADDED_SIZE && 
                         arrayY >= 0 && arrayY < PADDED_SIZE) {
                         
-                        int voxelIndex = arrayX + (arrayZ * PADDED_SIZE) + (arrayY * PADDED_SIZE * PADDED_SIZE);
-                        voxelData[voxelIndex] = 4; // Cobblestone
+                        chunk->Set(arrayX, arrayY, arrayZ, Block::SNOW); // Steps are snow blocks
                     }
                 }
             }
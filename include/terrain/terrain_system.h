@@ -7,6 +7,8 @@
 #include <cstdint>
 #include <FastNoise/FastNoise.h>
 #include "chunk.h" // Include chunk definition so we can write to it directly
+#include "block_registry.h"
+#include "heightfield_tile.h" // TerrainColumn (far-field tiles)
 
 // ================================================================================================
 // 2. TERRAIN GENERATOR INTERFACE
@@ -25,7 +27,46 @@ public:
     // We pass the chunk pointer to write directly to the voxel array
     virtual void GenerateChunk(Chunk* chunk, int cx, int cy, int cz, int scale) = 0;
 
+    // Far-field tiles: the surface of the CHUNK_SIZE_PADDED^2 columns of chunk column (cx, cz), same
+    // sample positions as GenerateChunk. The default walks GetBlock down from the height bounds,
+    // generators with 2D height maps override it with a batched version.
+    virtual void GenerateSurfaceColumns(TerrainColumn* columns, int cx, int cz, int scale) {
+        int minH, maxH;
+        GetHeightBounds(cx, cz, scale, minH, maxH);
+
+        // Start at the top of the highest voxel chunk the LOD job would have requested for these bounds
+        int chunkHeight = CHUNK_SIZE * scale;
+        int startY = (FloorDivide(maxH, chunkHeight) + 1) * chunkHeight;
+        int worldX = (cx * CHUNK_SIZE - 1) * scale;
+        int worldZ = (cz * CHUNK_SIZE - 1) * scale;
+
+        for (int z = 0; z < CHUNK_SIZE_PADDED; z++) {
+            float wz = (float)(worldZ + z * scale);
+            for (int x = 0; x < CHUNK_SIZE_PADDED; x++) {
+                float wx = (float)(worldX + x * scale);
+                TerrainColumn column;
+                column.surfaceHeight = minH;
+
+                for (int y = startY; y >= minH; y -= scale) {
+                    uint8_t id = GetBlock(wx, (float)y, wz, scale);
+                    if (id == Block::AIR) continue;
+                    if (!IsOpaque(id)) {
+                        if (column.fluidBlock == Block::AIR) { column.fluidBlock = id; column.fluidHeight = y; }
+                        continue;
+                    }
+                    uint8_t below = GetBlock(wx, (float)(y - scale), wz, scale);
+                    column.surfaceHeight = y;
+                    column.surfaceBlock = id;
+                    column.fillerBlock = IsOpaque(below) ? below : id;
+                    break;
+                }
+                columns[x + z * CHUNK_SIZE_PADDED] = column;
+            }
+        }
+    }
+
     virtual std::vector<std::string> GetTexturePaths() const = 0;
+    virtual const char* GetName() const { return "Unnamed"; } // For logs / stats
     virtual void OnImGui() {} 
     virtual bool HasChanged() { return m_dirty; }
     virtual void ClearDirtyFlag() { m_dirty = false; }
@@ -79,6 +120,7 @@ public:
     }
 
     void GetHeightBounds(int cx, int cz, int scale, int& minH, int& maxH) override;
+    const char* GetName() const override { return "Standard"; }
     std::vector<std::string> GetTexturePaths() const override;
     void OnImGui() override;
 
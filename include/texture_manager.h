@@ -5,6 +5,7 @@
 #include <vector>
 #include <iostream>
 #include <algorithm>
+#include "logger.h"
 
 // Define this ONLY in one .cpp file (e.g., main.cpp) if not already defined
 // #define STB_IMAGE_IMPLEMENTATION 
@@ -22,7 +23,7 @@ public:
         // 1. Load the first image to determine dimensions
         unsigned char* data = stbi_load(filePaths[0].c_str(), &width, &height, &nrChannels, 0);
         if (!data) {
-            std::cout << "[TextureManager] Failed to load first texture: " << filePaths[0] << std::endl;
+            GOOSE_LOG_ERROR("TextureManager", "Failed to load first texture: " << filePaths[0]);
             return 0;
         }
 
@@ -68,16 +69,16 @@ public:
             
             if (imgData) {
                 if (w != width || h != height) {
-                    std::cout << "[TextureManager] Mismatch dimension for " << filePaths[i] 
-                              << ". Expected " << width << "x" << height 
-                              << ", got " << w << "x" << h << ". Skipping upload." << std::endl;
+                    GOOSE_LOG_WARN("TextureManager", "Mismatch dimension for " << filePaths[i]
+                                     << ". Expected " << width << "x" << height
+                                     << ", got " << w << "x" << h << ". Skipping upload.");
                 } else {
                     // Upload to Layer 'i'
                     glTextureSubImage3D(textureID, 0, 0, 0, (GLint)i, width, height, 1, GL_RGBA, GL_UNSIGNED_BYTE, imgData);
                 }
                 stbi_image_free(imgData);
             } else {
-                std::cout << "[TextureManager] Failed to load texture: " << filePaths[i] << std::endl;
+                GOOSE_LOG_ERROR("TextureManager", "Failed to load texture: " << filePaths[i]);
             }
         }
 
@@ -86,7 +87,7 @@ public:
             glGenerateTextureMipmap(textureID);
         }
 
-        std::cout << "[TextureManager] Created Texture Array with " << filePaths.size() << " layers. (ID: " << textureID << ")" << std::endl;
+        GOOSE_LOG_INFO("TextureManager", "Created Texture Array with " << filePaths.size() << " layers. (ID: " << textureID << ")");
         return textureID;
     }
 };
\ No newline at end of file
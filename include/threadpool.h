@@ -8,6 +8,7 @@
 #include <functional>
 #include <atomic>
 #include <iostream>
+#include "logger.h"
 
 class ThreadPool {
 public:
@@ -20,7 +21,7 @@ public:
             else threads = 1;
         }
 
-        std::cout << "[System] Initializing ThreadPool with " << threads << " workers." << std::endl;
+        GOOSE_LOG_INFO("System", "Initializing ThreadPool with " << threads << " workers.");
 
         for(size_t i = 0; i < threads; ++i)
             workers.emplace_back(
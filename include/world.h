@@ -11,6 +11,8 @@
 #include <unordered_map>
 #include <mutex>
 #include <shared_mutex>
+#include <condition_variable>
+#include <thread>
 #include <queue>
 #include <atomic>
 #include <chrono>
@@ -25,6 +27,9 @@
 
 // Engine Subsystems
 #include "chunkNode.h"
+#include "chunk_table.h"
+#include "chunk_clipmap.h"
+#include "chunk_payload_store.h"
 //#include "chunk.h"
 #include "mesher.h"
 #include "linearAllocator.h"
@@ -32,9 +37,16 @@
 #include "threadpool.h"
 #include "object_pool.h"
 #include "gpu_memory.h"
+#include "chunk_cost_map.h"
+#include "metrics.h"
+#include "logger.h"
 #include "packedVertex.h"
 #include "profiler.h"
 #include "gpu_culler.h"
+#include "chunk_visibility.h"
+#include "chunk_bounds.h"
+#include "streaming_predictor.h"
+#include "render_snapshot.h"
 #include "screen_quad.h"
 #include "terrain/terrain_system.h"
 #include "engine_config.h"
@@ -67,10 +79,14 @@ private:
     
     // --- Chunk Management ---
     std::unordered_map<int64_t, ChunkNode*> m_activeChunkMap; // Lookup for all currently tracked chunks.
-    std::shared_mutex m_chunkMapMutex;            // R/W lock for the chunk map (Read heavily by LOD thread, Written by Main thread).
+    std::shared_mutex m_chunkMapMutex;            // R/W lock for the chunk map (Read by the LOD job and Draw, Written by the streaming step).
+    ChunkHotTable m_chunkTable;                   // SoA mirror of the map for the LOD scans. Same lock as the map.
+    ChunkClipmap m_chunkClipmap;                  // Per-LOD toroidal arrays for coordinate lookups (see FindChunk). Same lock as the map.
     
     ObjectPool<ChunkNode> m_chunkMetadataPool;    // Memory pool for lightweight ChunkNodes.
     ObjectPool<Chunk> m_voxelDataPool;            // Memory pool for heavy Chunk (voxel) data.
+    ChunkPayloadStore m_payloadStore;             // Refcounted voxels/meshes shared by identical chunks.
+    ChunkCostMap m_chunkCosts;                    // Per-chunk generation / meshing / VRAM cost (opt-in).
 
     // --- Processing Queues ---
     std::queue<ChunkNode*> m_queueGeneratedChunks; // Chunks with data ready to be meshed.
@@ -97,17 +113,90 @@ private:
     std::mutex m_lodResultMutex;                      // Protects the pending result pointer.
     std::unique_ptr<LODUpdateResult> m_pendingLODResult = nullptr; // Result from the async thread waiting to be applied.
     glm::vec3 m_lastLODCalculationPos = glm::vec3(-9999.0f); // Camera position during last LOD calculation.
+    glm::vec3 m_lastLODPredictionPos = glm::vec3(-9999.0f);  // Predicted position used by the last LOD calculation.
+
+    // --- Predictive Streaming ---
+    StreamingPredictor m_streamingPredictor;          // Extrapolates the camera over the measured streaming latency.
+    bool m_predictiveStreaming = true;                // Also request the rings around the predicted position.
+    glm::vec3 m_predictedCameraPos = glm::vec3(0.0f); // Last prediction (debug display).
+    glm::vec3 m_streamingCameraPos = glm::vec3(0.0f); // Camera of the step being run (ShouldHoldDraw).
+    std::vector<ChunkNode*> m_heldChunks;             // Prefetched MESHED chunks not registered yet. Streaming step only.
+    std::chrono::steady_clock::time_point m_clockStart = std::chrono::steady_clock::now();
+    float m_lastUpdateTime = -1.0f;                   // Seconds since m_clockStart, for frame dt.
+
+    // "Holes": LOD 0 ring chunks with nothing drawable (not ACTIVE, parent not ACTIVE either)
+    size_t m_holesThisFrame = 0;
+    size_t m_holeFramesInWindow = 0;                  // Sum of per-frame hole counts over the current 1 s window.
+    float m_holeWindowStart = 0.0f;
+    float m_holesPerSecond = 0.0f;                    // Hole-frames per second, last full window.
+
+    // --- Always-on Metrics (metrics.h) ---
+    // Registered once, the registry owns them. Queue/pool/state gauges are set by the streaming step,
+    // VRAM gauges by Update() (main thread, synced), upload counters by the render thread.
+    struct WorldMetrics {
+        Engine::MetricsRegistry& r = Engine::MetricsRegistry::Get();
+        Engine::MetricGauge& pendingGeneration = r.Gauge("streaming.pending_generation");
+        Engine::MetricGauge& waitingMesh = r.Gauge("streaming.waiting_mesh");
+        Engine::MetricGauge& waitingUpload = r.Gauge("streaming.waiting_upload");
+        Engine::MetricGauge& activeTasks = r.Gauge("workers.active_tasks");
+        Engine::MetricGauge& trackedChunks = r.Gauge("chunks.tracked");
+        Engine::MetricGauge& holesPerSecond = r.Gauge("streaming.holes_per_second");
+        Engine::MetricGauge& voxelPoolUsedMB = r.Gauge("pool.voxel_used_mb");
+        Engine::MetricGauge& voxelPoolAllocatedMB = r.Gauge("pool.voxel_allocated_mb");
+        Engine::MetricGauge& nodePoolUsedMB = r.Gauge("pool.node_used_mb");
+        Engine::MetricGauge& nodePoolAllocatedMB = r.Gauge("pool.node_allocated_mb");
+        Engine::MetricGauge& vramUsedBytes = r.Gauge("vram.used_bytes");
+        Engine::MetricGauge& vramRetiredBytes = r.Gauge("vram.retired_bytes");
+        Engine::MetricGauge& vramFreeBlocks = r.Gauge("vram.free_blocks");
+        Engine::MetricGauge& vramFragmentation = r.Gauge("vram.fragmentation");
+        Engine::MetricGauge* chunkStates[6] = {             // Indexed by ChunkState
+            &r.Gauge("chunks.state.missing"), &r.Gauge("chunks.state.generating"), &r.Gauge("chunks.state.generated"),
+            &r.Gauge("chunks.state.meshing"), &r.Gauge("chunks.state.meshed"), &r.Gauge("chunks.state.active")
+        };
+        Engine::MetricCounter& uploadBytes = r.Counter("vram.upload_bytes");
+        Engine::MetricCounter& uploads = r.Counter("vram.uploads");
+        Engine::MetricCounter& fragmentationResets = r.Counter("vram.fragmentation_resets");
+        Engine::MetricHistogram& stepMs = r.Histogram("streaming.step_ms", { 0.25, 0.5, 1, 2, 4, 8, 16, 33 });
+        Engine::MetricHistogram& snapshotUploadBytes = r.Histogram("vram.snapshot_upload_bytes",
+            { 0, 64 * 1024, 256 * 1024, 1024 * 1024, 4 * 1024 * 1024, 16 * 1024 * 1024 });
+    };
+    WorldMetrics m_metrics;
+    float m_lastStateCountTime = -1.0f;               // Chunk-state census runs once per second (walks the map).
 
     // --- Control State ---
     int m_frameCounter = 0; 
     std::atomic<bool> m_isShuttingDown{false};
     bool m_freezeLODUpdates = false; // Debug flag to pause LOD updates.
 
+    // --- Streaming Thread ---
+    // Update() hands the streaming step (queues, LOD application, VRAM bookkeeping) to this thread and
+    // returns; it runs while Draw() renders and SyncStreaming() joins it before the main thread touches
+    // the world again. GL work it causes goes through the render snapshots below (see render_snapshot.h).
+    std::thread m_streamingThread;
+    std::mutex m_streamingMutex;
+    std::condition_variable m_streamingCv;
+    bool m_streamingStepQueued = false;               // Guarded by m_streamingMutex.
+    bool m_streamingThreadExit = false;               // Guarded by m_streamingMutex.
+    glm::vec3 m_stepCameraPos = glm::vec3(0.0f);      // Inputs of the queued step.
+    glm::vec3 m_stepCameraVelocity = glm::vec3(0.0f);
+    bool m_threadedStreaming = true;                  // false: the step runs inline in Update() (debugging).
+
+    RenderSnapshot m_renderWrite;                     // Ops of the step in progress (streaming side).
+    RenderSnapshotExchange m_renderExchange;          // Double-buffered handoff.
+    RenderSnapshot m_renderRead;                      // Ops being applied (render side).
+
     // --- GPU Subsystems ---
     std::unique_ptr<GpuMemoryManager> m_vramManager; // Manages the massive bindless SSBO for geometry.
     std::unique_ptr<GpuCuller> m_gpuOcclusionCuller; // Handles GPU-side frustum and occlusion culling.
+    std::unique_ptr<FrameConstantsBuffer> m_frameConstants; // Per-frame UBO shared by the cull and world shaders.
     GLuint m_dummyVAO = 0;                           // Empty VAO for index-less rendering.
     GLuint m_textureArrayID = 0;                     // Handle to the block texture array.
+
+    // --- Visibility (Cave Culling) ---
+    ChunkVisibilityGraph m_visibilityGraph;          // Reusable BFS scratch for the connectivity walk.
+    std::vector<int64_t> m_visibleChunkIDs;          // LOD 0 chunks reached this frame (fed to the culler).
+    std::vector<std::pair<float, OccluderBox>> m_occluderCandidates; // Scored solid boxes, reused every frame.
+    std::vector<OccluderBox> m_occluderBoxes;        // Best MAX_OCCLUDER_BOXES of them (fed to the culler).
     
     std::atomic<int> m_activeWorkerTaskCount{0};     // Number of tasks currently running on the thread pool.
 
@@ -137,7 +226,7 @@ public:
         
         // Add 20% buffer for transition states
         size_t nodeCapacity = steadyStateNodes + (steadyStateNodes / 5); 
-        std::cout << "[World] Estimated Node Capacity: " << nodeCapacity << std::endl;
+        GOOSE_LOG_INFO("World", "Estimated Node Capacity: " << nodeCapacity);
 
         // ID 0: Chunk Metadata
         m_chunkMetadataPool.Init(
@@ -146,6 +235,8 @@ public:
             nodeCapacity, 
             0 
         ); 
+        m_chunkTable.Reserve(nodeCapacity);
+        m_chunkClipmap.Init(m_config->settings.lodRadius, m_config->settings.lodCount, m_config->settings.worldHeightChunks);
 
         // ID 1: Voxel Data
         m_voxelDataPool.Init(
@@ -154,12 +245,17 @@ public:
             m_config->voxelPool.limit, 
             1 
         );
+        m_payloadStore.Init(&m_voxelDataPool);
 
         // -- Initialize GPU Systems --
         m_vramManager = std::make_unique<GpuMemoryManager>(static_cast<size_t>(m_config->VRAM_HEAP_ALLOCATION_MB) * 1024 * 1024);
         m_gpuOcclusionCuller = std::make_unique<GpuCuller>(nodeCapacity);
+        m_gpuOcclusionCuller->SetMeshletBuffer(m_vramManager->GetID()); // Meshlet records share the vertex heap
+        m_frameConstants = std::make_unique<FrameConstantsBuffer>();
         
         glCreateVertexArrays(1, &m_dummyVAO);
+
+        m_streamingThread = std::thread([this]() { StreamingThreadLoop(); });
     }
 
     ~World() { Dispose(); }
@@ -169,36 +265,69 @@ public:
      */
     void Dispose() {
         m_isShuttingDown = true;
+        {
+            std::lock_guard<std::mutex> lock(m_streamingMutex);
+            m_streamingThreadExit = true;
+        }
+        m_streamingCv.notify_all();
+        if (m_streamingThread.joinable()) m_streamingThread.join();
+
         // Spin-wait until all worker threads finish their current tasks.
         while(m_activeWorkerTaskCount > 0) { std::this_thread::yield(); }
         
         if (m_dummyVAO) { glDeleteVertexArrays(1, &m_dummyVAO); m_dummyVAO = 0; }
         m_gpuOcclusionCuller.reset();
+        m_frameConstants.reset();
     }
 
 
-    // retrieve block ID at worldspace x, y, z (FAST)
-  // Add this method to your World or ChunkManager class
-// Assumes you have: std::unordered_map<int64_t, ChunkNode*> chunks;
+    /**
+     * @brief Looks up a tracked chunk by grid coordinates.
+     * Clipmap array probe first; the hash map is only consulted while some node overflowed the clipmap.
+     * Caller must hold m_chunkMapMutex (shared is enough) or own the world (streaming step, or main thread after SyncStreaming).
+     * @return The node, or nullptr if the chunk isn't tracked.
+     */
+    ChunkNode* FindChunk(int x, int y, int z, int lod) const {
+        if (ChunkNode* node = m_chunkClipmap.Find(x, y, z, lod)) return node;
+        if (!m_chunkClipmap.HasOverflow()) return nullptr;
 
+        auto it = m_activeChunkMap.find(ChunkKey(x, y, z, lod));
+        return (it != m_activeChunkMap.end()) ? it->second : nullptr;
+    }
+
+    // retrieve block ID at worldspace x, y, z (FAST)
 inline uint8_t GetBlockAt(int x, int y, int z) const {
+    ChunkNode* chunkHint = nullptr;
+    return GetBlockAt(x, y, z, chunkHint);
+}
+
+/**
+ * @brief GetBlockAt for walks over nearby blocks (raycasts, collision boxes).
+ * @param chunkHint LOD 0 chunk of the previous call (nullptr to start). If the block is in the same
+ *        chunk or one of its 26 neighbours, the lookup is a pointer read instead of a clipmap/hash probe.
+ *        Updated to the chunk containing (x, y, z). Only valid within one frame on the main thread.
+ */
+inline uint8_t GetBlockAt(int x, int y, int z, ChunkNode*& chunkHint) const {
     // 1. Calculate Chunk Grid Coordinates
     // Standard floor ensures consistent behavior for negative coordinates
     int cx = static_cast<int>(std::floor(x / (float)CHUNK_SIZE));
     int cy = static_cast<int>(std::floor(y / (float)CHUNK_SIZE));
     int cz = static_cast<int>(std::floor(z / (float)CHUNK_SIZE));
 
-    // 2. Generate Hash Key
-    int64_t key = ChunkKey(cx, cy, cz, 0);
+    // 2. Find the ChunkNode (hint / neighbour link first, then clipmap, hash only on overflow)
+    ChunkNode* node = chunkHint;
+    if (node && (node->gridX != cx || node->gridY != cy || node->gridZ != cz)) {
+        int dx = cx - node->gridX, dy = cy - node->gridY, dz = cz - node->gridZ;
+        bool adjacent = std::abs(dx) <= 1 && std::abs(dy) <= 1 && std::abs(dz) <= 1;
+        node = adjacent ? node->neighbors[NeighborIndex(dx, dy, dz)] : nullptr;
+    }
+    if (!node) node = FindChunk(cx, cy, cz, 0);
 
-    // 3. Find the ChunkNode
-    auto it = m_activeChunkMap.find(key);
-    if (it == m_activeChunkMap.end()) {
+    chunkHint = node;
+    if (!node) {
         return 0; // Chunk doesn't exist yet
     }
 
-    ChunkNode* node = it->second;
-
     // 4. Optimization Check (DEBUGGING: DISABLED)
     // POTENTIAL BUG: In chunkNode.h, your Reset() function does not set 
     // isUniform = false. If a node is recycled from an Air chunk, this
@@ -245,12 +374,55 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
         return false;
     }
 
+    /**
+     * @brief Kicks off streaming for the spawn position right away, so the workers generate the spawn area
+     * while the main thread is still compiling shaders / loading textures.
+     * Blocks until the spawn LOD job is done and its first generation batch is on the pool (a step only
+     * applies a LOD result that is already there). Meshing and uploads follow through the next Update()
+     * steps and their render snapshots.
+     */
+    void BeginWarmStart(glm::vec3 spawnPos) {
+        GOOSE_LOG_INFO("World", "Warm start: streaming spawn area at (" << spawnPos.x << ", " << spawnPos.y << ", " << spawnPos.z << ")");
+        Update(spawnPos); // Queues the LOD job
+        SyncStreaming();
+        while (m_isLODWorkerRunning) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        Update(spawnPos); // Applies it: node creation + generation tasks
+        SyncStreaming();
+    }
+
+    /**
+     * @brief True once every LOD 0 chunk within radiusChunks (XZ) of pos has been requested and is ACTIVE.
+     * Used to hold the splash screen until the spawn area is playable.
+     * @param activeOut, trackedOut LOD 0 chunks in the area that are ACTIVE / tracked (for a progress bar).
+     */
+    bool IsAreaReady(glm::vec3 pos, int radiusChunks, size_t& activeOut, size_t& trackedOut) {
+        activeOut = 0;
+        trackedOut = 0;
+
+        // Still deciding / still creating nodes: can't be complete yet
+        bool requestsPending = m_isLODWorkerRunning;
+        {
+            std::lock_guard<std::mutex> lock(m_lodResultMutex);
+            if (m_pendingLODResult && m_pendingLODResult->loadIndex < m_pendingLODResult->chunksToLoad.size()) requestsPending = true;
+        }
+
+        int camX = (int)floor(pos.x / CHUNK_SIZE);
+        int camZ = (int)floor(pos.z / CHUNK_SIZE);
+        for (size_t row = 0; row < m_chunkTable.Size(); row++) {
+            if (m_chunkTable.lod[row] != 0) continue;
+            if (abs(m_chunkTable.gridX[row] - camX) > radiusChunks || abs(m_chunkTable.gridZ[row] - camZ) > radiusChunks) continue;
+            trackedOut++;
+            if (m_chunkTable.nodes[row]->currentState.load() == ChunkState::ACTIVE) activeOut++;
+        }
+        return !requestsPending && trackedOut > 0 && activeOut == trackedOut;
+    }
+
     /**
      * @brief Hot-swaps the terrain generator and resets the world.
      * Useful for live-editing terrain parameters or algorithms.
      */
     void SwitchGenerator(std::unique_ptr<ITerrainGenerator> newGen, GLuint newTextureArrayID) {
-        std::cout << "[World] Stopping tasks for generator switch..." << std::endl;
+        GOOSE_LOG_INFO("World", "Stopping tasks for generator switch...");
         bool wasFrozen = m_freezeLODUpdates;
         m_freezeLODUpdates = true;
 
@@ -259,9 +431,13 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
         while (m_activeWorkerTaskCount > 0) {
             std::this_thread::sleep_for(std::chrono::milliseconds(2));
             waitCycles++;
-            if (waitCycles % 100 == 0) std::cout << "[World] Waiting for " << m_activeWorkerTaskCount << " threads..." << std::endl;
+            if (waitCycles % 100 == 0) GOOSE_LOG_DEBUG("World", "Waiting for " << m_activeWorkerTaskCount << " threads...");
         }
 
+        // Report the old generator's numbers before its chunks go away
+        LogDedupStats();
+        m_payloadStore.ResetCounters();
+
         m_terrainGenerator = std::move(newGen);
         m_terrainGenerator->Init();
         
@@ -282,6 +458,8 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
     void setOcclusionCulling (bool mode){ m_config->settings.occlusionCulling = mode; }
     bool getOcclusionCulling () { return m_config->settings.occlusionCulling; }
     void SetLODFreeze(bool freeze) { m_freezeLODUpdates = freeze; }
+    void SetPredictiveStreaming(bool enabled) { m_predictiveStreaming = enabled; }
+    bool GetPredictiveStreaming() const { return m_predictiveStreaming; }
     bool GetLODFreeze() const { return m_freezeLODUpdates; }
     const EngineConfig& GetConfig() const { return *m_config; }
     size_t getVRAMUsed () {return m_vramManager.get()->GetUsedMemory();}
@@ -301,6 +479,55 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
         }
     }
 
+    /**
+     * @brief What one LOD ring costs, for comparing heightfield tiles against voxel chunks.
+     * RAM = node headers + voxel arrays (shared copies counted per user) + pending tile columns,
+     * VRAM = vertices + meshlet records (borrowed meshes counted per user as well).
+     */
+    struct LodFootprint {
+        bool heightfield = false;
+        size_t chunks = 0;
+        size_t meshedChunks = 0;    // ACTIVE with geometry
+        size_t ramBytes = 0;
+        size_t vramBytes = 0;
+    };
+
+    /**
+     * @brief Fills one entry per LOD. Main thread after SyncStreaming (the step is the only writer of the map).
+     */
+    void GetLodFootprints(std::vector<LodFootprint>& out) const {
+        int lodCount = m_config->settings.lodCount;
+        out.assign((size_t)lodCount, LodFootprint{});
+        for (int lod = 0; lod < lodCount; lod++) out[lod].heightfield = IsFarFieldLod(lod);
+
+        for (const auto& pair : m_activeChunkMap) {
+            const ChunkNode* node = pair.second;
+            if (node->lodLevel >= lodCount) continue;
+            LodFootprint& entry = out[node->lodLevel];
+            entry.chunks++;
+            entry.ramBytes += sizeof(ChunkNode) + node->heightfieldColumns.capacity() * sizeof(TerrainColumn);
+            if (node->voxelData) entry.ramBytes += sizeof(Chunk);
+
+            size_t vertices = node->vertexCountOpaque + node->vertexCountTransparent;
+            entry.vramBytes += vertices * sizeof(PackedVertex) + node->meshletCount * sizeof(ChunkMeshlet);
+            if (vertices > 0 && node->currentState == ChunkState::ACTIVE) entry.meshedChunks++;
+        }
+    }
+
+    /**
+     * @brief Prints GetLodFootprints, one line per LOD.
+     */
+    void LogLodFootprints() const {
+        std::vector<LodFootprint> footprints;
+        GetLodFootprints(footprints);
+        for (size_t lod = 0; lod < footprints.size(); lod++) {
+            const LodFootprint& f = footprints[lod];
+            if (f.chunks == 0) continue;
+            GOOSE_LOG_INFO("FarField", "LOD " << lod << (f.heightfield ? " (heightfield): " : " (voxel): ") << f.chunks << " chunks ("
+                               << f.meshedChunks << " with geometry), " << f.ramBytes / 1024 << " KB RAM, " << f.vramBytes / 1024 << " KB VRAM");
+        }
+    }
+
     /**
      * @brief Main update loop called every frame.
      * 1. Checks memory fragmentation.
@@ -309,26 +536,174 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
      * @param cameraPos Current player position.
      */
     void Update(glm::vec3 cameraPos) {
+        Update(cameraPos, glm::vec3(0.0f));
+    }
+
+    /**
+     * @brief Update with camera motion, enables predictive prefetch.
+     * Rings are requested around the current position AND around the position extrapolated over
+     * the measured streaming latency, so the leading edge is already generating when we get there.
+     * Returns right away: the step runs on the streaming thread, call SyncStreaming() after Draw().
+     * @param cameraPos Current player position.
+     * @param cameraVelocity Player velocity (world units / second).
+     */
+    void Update(glm::vec3 cameraPos, glm::vec3 cameraVelocity) {
         if (m_isShuttingDown) return;
-        Engine::Profiler::ScopedTimer timer("World::Update Total");
-        
+        SyncStreaming(); // Normally a no-op, the caller already synced after the last Draw
+
+        // VRAM bookkeeping is only consistent between steps, so its gauges are set here
+        float fragmentation = m_vramManager->GetFragmentationRatio();
+        m_metrics.vramFragmentation.Set(fragmentation);
+        m_metrics.vramUsedBytes.Set((double)m_vramManager->GetUsedMemory());
+        m_metrics.vramFreeBlocks.Set((double)m_vramManager->GetFreeBlockCount());
+        m_metrics.vramRetiredBytes.Set((double)m_vramManager->GetRetiredBytes());
+
         // Safety Valve: Reset world if VRAM fragmentation gets critical.
-        if (m_vramManager->GetFragmentationRatio() > 0.6f) { 
+        // Stays on this thread, ReloadWorld swaps the config Draw() reads. Skipped while the map is empty:
+        // right after a reload the freed ranges are still waiting for their fence, nothing would coalesce.
+        if (!m_activeChunkMap.empty() && fragmentation > 0.6f) { 
+             m_metrics.fragmentationResets.Add();
              ReloadWorld(*m_config);
+             m_renderExchange.Publish(m_renderWrite);
              return;
         }
 
+        if (!m_threadedStreaming) {
+            RunStreamingStep(cameraPos, cameraVelocity);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_streamingMutex);
+            m_stepCameraPos = cameraPos;
+            m_stepCameraVelocity = cameraVelocity;
+            m_streamingStepQueued = true;
+        }
+        m_streamingCv.notify_all();
+    }
+
+    /**
+     * @brief Waits for the streaming step queued by Update(). Until it returns the step owns the world:
+     * only Draw() (which applies render snapshots and reads the map under the shared lock) may run.
+     */
+    void SyncStreaming() {
+        std::unique_lock<std::mutex> lock(m_streamingMutex);
+        if (!m_streamingStepQueued) return;
+        Engine::Profiler::ScopedTimer timer("World::SyncStreaming");
+        m_streamingCv.wait(lock, [this]() { return !m_streamingStepQueued; });
+    }
+
+    void SetThreadedStreaming(bool enabled) {
+        SyncStreaming();
+        m_threadedStreaming = enabled;
+    }
+    bool IsThreadedStreaming() const { return m_threadedStreaming; }
+
+    /**
+     * @brief Render thread: performs the GL side of every streaming step published since the last call
+     * (vertex heap uploads, culler registrations and removals in the order the steps produced them, then the VRAM they freed).
+     * Draw() calls it first; anything that waits for chunks to become drawable without drawing calls it too.
+     */
+    void ApplyRenderSnapshot() {
+        // Freed VRAM the GPU has finished with goes back to the allocator (fenced at the end of Draw)
+        m_vramManager->ReclaimCompleted();
+
+        if (!m_renderExchange.Acquire(m_renderRead)) return;
+        Engine::Profiler::ScopedTimer timer("World::ApplyRenderSnapshot");
+
+        size_t uploadedBytes = 0;
+        for (const RenderOp& op : m_renderRead.ops) {
+            switch (op.type) {
+                case RenderOpType::UPLOAD: {
+                    const VramUpload& upload = m_renderRead.uploads[op.index];
+                    m_vramManager->Upload((size_t)upload.offset, upload.Data(), upload.Bytes());
+                    uploadedBytes += upload.Bytes();
+                    break;
+                }
+                case RenderOpType::REGISTER: {
+                    const ChunkDrawRecord& r = m_renderRead.records[op.index];
+                    m_gpuOcclusionCuller->AddOrUpdateChunk(r.chunkID, r.origin, r.aabbMin, r.aabbMax, r.scale,
+                                                           r.firstVertexOpaque, r.vertexCountOpaque,
+                                                           r.firstVertexTrans, r.vertexCountTrans,
+                                                           r.firstMeshlet, r.meshletCount);
+                    break;
+                }
+                case RenderOpType::REMOVE:
+                    m_gpuOcclusionCuller->RemoveChunk(op.chunkID);
+                    break;
+            }
+        }
+        // Ranges the steps freed: nothing registered above draws them anymore. They are fenced after
+        // this frame's draws, so the last frame that could read one is covered.
+        for (const VramRetire& range : m_renderRead.retired) m_vramManager->Free((size_t)range.offset, range.bytes);
+        m_metrics.uploads.Add(m_renderRead.uploads.size());
+        m_metrics.uploadBytes.Add(uploadedBytes);
+        m_metrics.snapshotUploadBytes.Record((double)uploadedBytes);
+        m_renderRead.Clear();
+    }
+
+    /**
+     * @brief Streaming thread body: one step per Update(), until Dispose().
+     */
+    void StreamingThreadLoop() {
+        Engine::FlightRecorder::Get().NameCurrentThread("Streaming");
+        std::unique_lock<std::mutex> lock(m_streamingMutex);
+        while (true) {
+            m_streamingCv.wait(lock, [this]() { return m_streamingStepQueued || m_streamingThreadExit; });
+            if (m_streamingThreadExit) {
+                m_streamingStepQueued = false;
+                m_streamingCv.notify_all();
+                return;
+            }
+
+            glm::vec3 cameraPos = m_stepCameraPos;
+            glm::vec3 cameraVelocity = m_stepCameraVelocity;
+            lock.unlock();
+            RunStreamingStep(cameraPos, cameraVelocity);
+            lock.lock();
+
+            m_streamingStepQueued = false;
+            m_streamingCv.notify_all();
+        }
+    }
+
+    /**
+     * @brief One streaming step, then hands its render ops to the render thread.
+     */
+    void RunStreamingStep(glm::vec3 cameraPos, glm::vec3 cameraVelocity) {
+        auto start = std::chrono::steady_clock::now();
+        StepStreaming(cameraPos, cameraVelocity);
+        m_metrics.stepMs.Record(ElapsedMicroseconds(start) / 1000.0f);
+        m_renderExchange.Publish(m_renderWrite);
+    }
+
+    /**
+     * @brief Queue draining, LOD scheduling/application and stats. No GL in here (see render_snapshot.h).
+     */
+    void StepStreaming(glm::vec3 cameraPos, glm::vec3 cameraVelocity) {
+        if (m_isShuttingDown) return;
+        Engine::Profiler::ScopedTimer timer("World::Update Total");
+
+        float now = GetWorldTime();
+        float dt = (m_lastUpdateTime < 0.0f) ? 0.0f : now - m_lastUpdateTime;
+        m_lastUpdateTime = now;
+        m_streamingPredictor.Update(cameraVelocity, dt);
+        m_streamingCameraPos = cameraPos;
+
         ProcessCompletedWorkerQueues(); 
+        ReleaseHeldChunks();
+        UpdateMetrics(now);
 
         if (m_freezeLODUpdates) return; 
+
+        // Don't predict further than the LOD 0 ring reaches, past that the coarse rings already cover it
+        float maxLookAhead = (float)(m_config->settings.lodRadius[0] * CHUNK_SIZE);
+        m_predictedCameraPos = m_predictiveStreaming ? m_streamingPredictor.Predict(cameraPos, cameraVelocity, maxLookAhead) : cameraPos;
         
-        ScheduleAsyncLODUpdate(cameraPos);
+        ScheduleAsyncLODUpdate(cameraPos, m_predictedCameraPos);
+        UpdateHoleMetric(cameraPos, now);
         UpdateProfilerPressure();
 
-
-        //if (m_frameCounter > 1)
-            
-        
         m_frameCounter++;
     }
 
@@ -369,10 +744,14 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
             if (node->currentState == ChunkState::GENERATING) {
                 // Uniform chunks (all air/solid) need no mesh
                 if (node->isUniform) {
-                    node->currentState = ChunkState::ACTIVE;
+                    node->SetState(ChunkState::ACTIVE);
+                } else if (node->payload && node->payload->hasMesh) {
+                    // Identical content is already on the GPU: draw that, skip meshing and the upload
+                    m_payloadStore.BorrowMesh(node);
+                    ActivateMeshedChunk(node);
                 } else {
                     // Send to ThreadPool for meshing
-                    node->currentState = ChunkState::MESHING;
+                    node->SetState(ChunkState::MESHING);
                     m_activeWorkerTaskCount++;
                     m_workerThreadPool.enqueue([this, node]() { 
                         this->ExecuteAsyncMeshingTask(node); 
@@ -382,20 +761,32 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
             }
         }
 
-        // 3. Upload Meshes to GPU (Must be on Main Thread)
+        // 3. Allocate VRAM and queue the uploads for the render thread (ApplyRenderSnapshot)
         for (ChunkNode* node : nodesToUpload) {
             if(m_isShuttingDown) return; 
             if (node->currentState == ChunkState::MESHING) {
+                if (node->payload && node->payload->hasMesh) {
+                    // An identical chunk got uploaded while we were meshing, use its copy
+                    m_payloadStore.BorrowMesh(node);
+                    ActivateMeshedChunk(node);
+                    continue;
+                }
+
+                // Remesh (SetBlock): free the previous ranges first, they'd leak otherwise.
+                // Borrowed ones (retiredPayload) stay with the payload and are released below.
+                FreeNodeMesh(node);
+                node->ownsMesh = true;
+                bool uploaded = true;
                 
                 // --- Upload Opaque Mesh ---
                 if (!node->cachedMeshOpaque.empty()) {
                     size_t bytes = node->cachedMeshOpaque.size() * sizeof(PackedVertex);
                     long long offset = m_vramManager->Allocate(bytes, sizeof(PackedVertex));
                     if (offset != -1) {
-                        m_vramManager->Upload(offset, node->cachedMeshOpaque.data(), bytes);
                         node->vramOffsetOpaque = offset;
                         node->vertexCountOpaque = node->cachedMeshOpaque.size();
-                    }
+                        m_renderWrite.Upload(offset, std::move(node->cachedMeshOpaque));
+                    } else uploaded = false;
                 }
 
                 // --- Upload Transparent Mesh ---
@@ -403,53 +794,246 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
                     size_t bytes = node->cachedMeshTransparent.size() * sizeof(PackedVertex);
                     long long offset = m_vramManager->Allocate(bytes, sizeof(PackedVertex));
                     if (offset != -1) {
-                        m_vramManager->Upload(offset, node->cachedMeshTransparent.data(), bytes);
                         node->vramOffsetTransparent = offset;
                         node->vertexCountTransparent = node->cachedMeshTransparent.size();
-                    }
+                        m_renderWrite.Upload(offset, std::move(node->cachedMeshTransparent));
+                    } else uploaded = false;
                 }
 
-                // Calculate element indices for the indirect draw command
-                size_t opaqueIdx = (node->vramOffsetOpaque != -1) ? (size_t)(node->vramOffsetOpaque / sizeof(PackedVertex)) : 0;
-                size_t transIdx = (node->vramOffsetTransparent != -1) ? (size_t)(node->vramOffsetTransparent / sizeof(PackedVertex)) : 0;
-
-                // Register with the GPU Culler (this updates the compute shader's buffer)
-                m_gpuOcclusionCuller->AddOrUpdateChunk(
-                    node->uniqueID, 
-                    node->aabbMinWorld, 
-                    node->aabbMaxWorld, 
-                    (float)node->scaleFactor, 
-                    opaqueIdx, node->vertexCountOpaque, 
-                    transIdx, node->vertexCountTransparent
-                );
-
-                // Clear CPU caches to save RAM
-                node->cachedMeshOpaque.clear(); 
-                node->cachedMeshOpaque.shrink_to_fit();
-                node->cachedMeshTransparent.clear(); 
-                node->cachedMeshTransparent.shrink_to_fit();
-
-                // CHANGE: Want to keep now for physics calcs, need to release voxel data when node is released
-                // Release Voxel Data to save RAM, BUT keep it for LOD 0 (Physics)
-                if (node->voxelData) {
-                    // If we are at LOD 0, we keep the data for GetBlockAt()
-                    // If we are at LOD > 0, we don't need it for physics, so release it.
-                    if (node->lodLevel != 0) {
-                        m_voxelDataPool.Release(node->voxelData);
-                        node->voxelData = nullptr;
+                // --- Upload Meshlets (cluster records for the culler, same heap) ---
+                // Without them the opaque mesh is simply culled and drawn as one range.
+                if (!node->cachedMeshlets.empty() && node->vramOffsetOpaque != -1) {
+                    size_t bytes = node->cachedMeshlets.size() * sizeof(ChunkMeshlet);
+                    long long offset = m_vramManager->Allocate(bytes, sizeof(ChunkMeshlet));
+                    if (offset != -1) {
+                        node->vramOffsetMeshlets = offset;
+                        node->meshletCount = node->cachedMeshlets.size();
+                        m_renderWrite.Upload(offset, std::move(node->cachedMeshlets));
                     }
                 }
-                
-                node->currentState = ChunkState::ACTIVE;
+
+                // First of its content to make it to the GPU: the ranges now belong to the payload.
+                // A partial upload (heap full) isn't shared, the next identical chunk tries on its own.
+                if (uploaded) m_payloadStore.PublishMesh(node);
+
+                ActivateMeshedChunk(node);
+
+                if (node->retiredPayload) {
+                    std::vector<ChunkPayloadStore::MeshRange> meshesToFree;
+                    m_payloadStore.ReleaseRetired(node, meshesToFree);
+                    FreeMeshRanges(meshesToFree);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Finishes a node's mesh (own or borrowed from its payload) and registers it with the culler,
+     * unless it is a prefetched chunk that has to wait (ShouldHoldDraw).
+     */
+    void ActivateMeshedChunk(ChunkNode* node) {
+        // Cull against what was actually emitted instead of the whole chunk cube
+        float scale = (float)node->scaleFactor;
+        const ChunkMeshBounds& bounds = node->meshBounds;
+        if (bounds.hasGeometry) {
+            node->aabbMinWorld = node->worldPosition + glm::vec3(bounds.geometryMin[0], bounds.geometryMin[1], bounds.geometryMin[2]) * scale;
+            node->aabbMaxWorld = node->worldPosition + glm::vec3(bounds.geometryMax[0], bounds.geometryMax[1], bounds.geometryMax[2]) * scale;
+        } else {
+            node->aabbMinWorld = node->worldPosition;
+            node->aabbMaxWorld = node->worldPosition + glm::vec3((float)CHUNK_SIZE * scale);
+        }
+
+        if (m_chunkCosts.IsEnabled()) {
+            m_chunkCosts.RecordVram(node, (node->vertexCountOpaque + node->vertexCountTransparent) * sizeof(PackedVertex) +
+                                          node->meshletCount * sizeof(ChunkMeshlet));
+        }
+
+        // Clear CPU caches to save RAM
+        node->cachedMeshOpaque.clear(); 
+        node->cachedMeshOpaque.shrink_to_fit();
+        node->cachedMeshTransparent.clear(); 
+        node->cachedMeshTransparent.shrink_to_fit();
+        node->cachedMeshlets.clear();
+        node->cachedMeshlets.shrink_to_fit();
+
+        // CHANGE: Want to keep now for physics calcs, need to release voxel data when node is released
+        // Release Voxel Data to save RAM, BUT keep it for LOD 0 (Physics)
+        // If we are at LOD 0, we keep the data for GetBlockAt()
+        // If we are at LOD > 0, we don't need it for physics, so release it.
+        if (node->voxelData && node->lodLevel != 0) {
+            ReleaseNodeVoxels(node);
+        }
+        
+        // Prefetched ahead of the camera: uploaded, but not drawn over its parent yet
+        if (ShouldHoldDraw(node)) {
+            node->SetState(ChunkState::MESHED);
+            if (!node->drawHeld) {
+                node->drawHeld = true;
+                m_heldChunks.push_back(node);
             }
+        } else {
+            RegisterChunkDraw(node);
+        }
+
+        // Streaming latency (request -> drawable) drives the prediction horizon. LOD 0 only, that's the leading edge.
+        if (node->requestTime >= 0.0f) {
+            if (node->lodLevel == 0) m_streamingPredictor.RecordLoadLatency(GetWorldTime() - node->requestTime);
+            node->requestTime = -1.0f;
         }
     }
 
+    /**
+     * @brief Hands the node's mesh to the culler and makes it ACTIVE (the state its parent and children wait on).
+     */
+    void RegisterChunkDraw(ChunkNode* node) {
+        // Calculate element indices for the indirect draw command
+        size_t opaqueIdx = (node->vramOffsetOpaque != -1) ? (size_t)(node->vramOffsetOpaque / sizeof(PackedVertex)) : 0;
+        size_t transIdx = (node->vramOffsetTransparent != -1) ? (size_t)(node->vramOffsetTransparent / sizeof(PackedVertex)) : 0;
+        size_t meshletIdx = (node->vramOffsetMeshlets != -1) ? (size_t)(node->vramOffsetMeshlets / sizeof(ChunkMeshlet)) : 0;
+
+        // Register with the GPU Culler (applied by the render thread, after this step's uploads)
+        ChunkDrawRecord record;
+        record.chunkID = node->uniqueID;
+        record.origin = node->worldPosition;
+        record.aabbMin = node->aabbMinWorld;
+        record.aabbMax = node->aabbMaxWorld;
+        record.scale = (float)node->scaleFactor;
+        record.firstVertexOpaque = opaqueIdx;  record.vertexCountOpaque = node->vertexCountOpaque;
+        record.firstVertexTrans = transIdx;    record.vertexCountTrans = node->vertexCountTransparent;
+        record.firstMeshlet = meshletIdx;      record.meshletCount = node->meshletCount;
+        m_renderWrite.Register(record);
+
+        node->SetState(ChunkState::ACTIVE);
+    }
+
+    /**
+     * @brief A chunk only the predicted ring asked for, while its coarser parent still draws that area.
+     * Registering it now would draw both (overdraw, z-fighting) until the camera gets there and the parent
+     * splits, so it waits as MESHED. Not ACTIVE also means the parent's AreChildrenReady() stays false.
+     */
+    bool ShouldHoldDraw(ChunkNode* node) {
+        int lod = node->lodLevel;
+        if (lod >= m_config->settings.lodCount - 1) return false; // Nothing coarser draws there
+        int scale = CHUNK_SIZE << lod;
+        int radius = m_config->settings.lodRadius[lod];
+        int camChunkX = (int)floor(m_streamingCameraPos.x / scale);
+        int camChunkZ = (int)floor(m_streamingCameraPos.z / scale);
+        if (std::abs(node->gridX - camChunkX) <= radius && std::abs(node->gridZ - camChunkZ) <= radius) return false;
+        return IsParentReady(node);
+    }
+
+    /**
+     * @brief Registers held chunks the camera ring has reached (or whose parent went away). Streaming step.
+     */
+    void ReleaseHeldChunks() {
+        size_t kept = 0;
+        for (ChunkNode* node : m_heldChunks) {
+            if (node->currentState != ChunkState::MESHED) {
+                node->drawHeld = false; // Remeshing, it is held again (or not) once it's back
+                continue;
+            }
+            if (ShouldHoldDraw(node)) {
+                m_heldChunks[kept++] = node;
+                continue;
+            }
+            node->drawHeld = false;
+            RegisterChunkDraw(node);
+        }
+        m_heldChunks.resize(kept);
+    }
+
+    /**
+     * @brief Takes an unloading node out of the held list (the pool hands it out again).
+     */
+    void DropHeldChunk(ChunkNode* node) {
+        if (!node->drawHeld) return;
+        m_heldChunks.erase(std::find(m_heldChunks.begin(), m_heldChunks.end(), node));
+        node->drawHeld = false;
+    }
+
+    // ============================================================================================
+    // CHUNK RESOURCES
+    // ============================================================================================
+
+    /**
+     * @brief Frees the node's own VRAM ranges (ownsMesh) and clears its handles. Borrowed ones are only
+     * cleared, they stay with the payload. The render thread retires the ranges when it applies this
+     * step's snapshot (see ApplyRenderSnapshot).
+     */
+    void FreeNodeMesh(ChunkNode* node) {
+        if (node->ownsMesh) {
+            if (node->vramOffsetOpaque != -1)
+                m_renderWrite.Retire(node->vramOffsetOpaque, node->vertexCountOpaque * sizeof(PackedVertex));
+            if (node->vramOffsetTransparent != -1)
+                m_renderWrite.Retire(node->vramOffsetTransparent, node->vertexCountTransparent * sizeof(PackedVertex));
+            if (node->vramOffsetMeshlets != -1)
+                m_renderWrite.Retire(node->vramOffsetMeshlets, node->meshletCount * sizeof(ChunkMeshlet));
+            node->ownsMesh = false;
+        }
+        node->vramOffsetOpaque = -1;
+        node->vramOffsetTransparent = -1;
+        node->vertexCountOpaque = 0;
+        node->vertexCountTransparent = 0;
+        node->vramOffsetMeshlets = -1;
+        node->meshletCount = 0;
+    }
+
+    void FreeMeshRanges(const std::vector<ChunkPayloadStore::MeshRange>& ranges) {
+        for (const ChunkPayloadStore::MeshRange& range : ranges) m_renderWrite.Retire(range.offset, range.bytes);
+    }
+
+    /**
+     * @brief Gives up the node's voxels: a shared copy goes through the payload store, a private one back to the pool.
+     */
+    void ReleaseNodeVoxels(ChunkNode* node) {
+        m_payloadStore.DropVoxels(node);
+        if (node->voxelData) {
+            m_voxelDataPool.Release(node->voxelData);
+            node->voxelData = nullptr;
+        }
+    }
+
+    /**
+     * @brief Everything a node holds besides its map entry: culler slot, payload links, VRAM and voxels.
+     */
+    void ReleaseChunkResources(ChunkNode* node) {
+        // Notify GPU Culler to stop drawing this (queued before any upload that reuses the freed ranges)
+        m_renderWrite.Remove(node->uniqueID);
+        DropHeldChunk(node);
+
+        // Shared content first (payloads that die hand back their ranges), then whatever the node owns
+        std::vector<ChunkPayloadStore::MeshRange> meshesToFree;
+        m_payloadStore.Unlink(node, meshesToFree);
+        FreeMeshRanges(meshesToFree);
+
+        // Free GPU Memory
+        FreeNodeMesh(node);
+
+        // when transitioning LODs, make sure we release voxel data or it would leak memory
+        ReleaseNodeVoxels(node);
+        node->heightfieldColumns.clear();
+        node->heightfieldColumns.shrink_to_fit();
+    }
+
+    /**
+     * @brief Prints how much identical content the current generator produced (see chunk_payload_store.h).
+     */
+    void LogDedupStats() {
+        ChunkPayloadStore::Stats stats = m_payloadStore.GetStats();
+        if (stats.linked == 0) return;
+        float ratio = (stats.livePayloads > 0) ? (float)stats.liveRefs / (float)stats.livePayloads : 1.0f;
+        GOOSE_LOG_INFO("Dedup", m_terrainGenerator->GetName() << ": " << stats.linked << " non-uniform chunks, "
+                                << stats.voxelHits << " shared voxel arrays, " << stats.meshHits << " shared meshes. Live: "
+                                << stats.liveRefs << " chunks / " << stats.livePayloads << " payloads (" << ratio << "x)");
+    }
+
     /**
      * @brief Asynchronous job to calculate which chunks need to be loaded/unloaded based on LOD logic.
      * Executes on a background thread.
+     * @param predictedPos Where the camera is expected to be once this batch is streamed in.
+     *        Its rings are requested too (after the current ones) and protected from unloading.
      */
-    void AsyncJob_CalculateLODs(glm::vec3 cameraPos) {
+    void AsyncJob_CalculateLODs(glm::vec3 cameraPos, glm::vec3 predictedPos) {
         if(m_isShuttingDown) return;
         Engine::Profiler::ScopedTimer timer("[ASYNC] World::LOD Calc");
         auto result = std::make_unique<LODUpdateResult>();
@@ -457,38 +1041,54 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
         std::shared_lock<std::shared_mutex> readLock(m_chunkMapMutex);
 
         // --- STEP 1: Unload Logic ---
-        // Iterate current chunks to see if they are out of range or need splitting/merging.
-        for (const auto& pair : m_activeChunkMap) {
-            ChunkNode* node = pair.second;
-            int lod = node->lodLevel;
+        // Scan the hot table (dense keys/grid/LOD arrays) to see which chunks are out of range or
+        // need splitting/merging. The ChunkNode is only touched once a row becomes a candidate.
+        const int lodCount = m_config->settings.lodCount;
+        int camChunkXByLod[12], camChunkZByLod[12];
+        int predChunkXByLod[12], predChunkZByLod[12];
+        for (int lod = 0; lod < lodCount; lod++) {
             int scale = 1 << lod;
+            camChunkXByLod[lod] = (int)floor(cameraPos.x / (CHUNK_SIZE * scale));
+            camChunkZByLod[lod] = (int)floor(cameraPos.z / (CHUNK_SIZE * scale));
+            predChunkXByLod[lod] = (int)floor(predictedPos.x / (CHUNK_SIZE * scale));
+            predChunkZByLod[lod] = (int)floor(predictedPos.z / (CHUNK_SIZE * scale));
+        }
+
+        // Inside the predicted ring of its LOD: prefetched, don't throw it away before we get there
+        auto InPredictedRing = [&](int gridX, int gridZ, int lod) {
+            int r = m_config->settings.lodRadius[lod];
+            return abs(gridX - predChunkXByLod[lod]) <= r && abs(gridZ - predChunkZByLod[lod]) <= r;
+        };
+
+        const size_t rowCount = m_chunkTable.Size();
+        const int32_t* rowX = m_chunkTable.gridX.data();
+        const int32_t* rowZ = m_chunkTable.gridZ.data();
+        const uint8_t* rowLod = m_chunkTable.lod.data();
+
+        for (size_t row = 0; row < rowCount; row++) {
+            int lod = rowLod[row];
+            int gridX = rowX[row];
+            int gridZ = rowZ[row];
             
-            int camChunkX = (int)floor(cameraPos.x / (CHUNK_SIZE * scale));
-            int camChunkZ = (int)floor(cameraPos.z / (CHUNK_SIZE * scale));
-            
-            int dx = abs(node->gridX - camChunkX);
-            int dz = abs(node->gridZ - camChunkZ);
+            int dx = abs(gridX - camChunkXByLod[lod]);
+            int dz = abs(gridZ - camChunkZByLod[lod]);
             
             bool shouldUnload = false;
 
             // Condition A: Too far for current LOD (Needs to switch to Lower Detail Parent)
-            if (dx > m_config->settings.lodRadius[lod] || dz > m_config->settings.lodRadius[lod]) {
+            if ((dx > m_config->settings.lodRadius[lod] || dz > m_config->settings.lodRadius[lod]) && !InPredictedRing(gridX, gridZ, lod)) {
                  // Only unload if the coarser parent is ready to take over (prevents holes)
-                 if (IsParentReady(node->gridX, node->gridY, node->gridZ, lod)) {
+                 if (IsParentReady(m_chunkTable.nodes[row])) {
                      shouldUnload = true;
                  }
                  // Edge Case: If we are at boundary of world, maybe unload anyway?
-                 else if (lod < m_config->settings.lodCount - 1) {
+                 else if (lod < lodCount - 1) {
                      int pLod = lod + 1;
                      int pRadius = m_config->settings.lodRadius[pLod];
-                     int pScale = 1 << pLod;
-                     
-                     int pCamX = (int)floor(cameraPos.x / (CHUNK_SIZE * pScale));
-                     int pCamZ = (int)floor(cameraPos.z / (CHUNK_SIZE * pScale));
-                     int px = node->gridX >> 1;
-                     int pz = node->gridZ >> 1;
+                     int px = gridX >> 1;
+                     int pz = gridZ >> 1;
                      
-                     if (abs(px - pCamX) > pRadius || abs(pz - pCamZ) > pRadius) {
+                     if (abs(px - camChunkXByLod[pLod]) > pRadius || abs(pz - camChunkZByLod[pLod]) > pRadius) {
                          shouldUnload = true;
                      }
                  }
@@ -499,17 +1099,18 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
                 int innerBoundary = ((prevRadius + 1) / 2);
                 if (dx < innerBoundary && dz < innerBoundary) {
                     // Only unload if the children are ready (prevents holes)
-                    if (AreChildrenReady(node->gridX, node->gridY, node->gridZ, lod)) {
+                    if (AreChildrenReady(m_chunkTable.nodes[row])) {
                         shouldUnload = true;
                     }
                 }
             }
 
             if (shouldUnload) {
-                ChunkState s = node->currentState.load();
+                // State is written lock-free by the streaming step, so it stays on the node (cold read, candidates only)
+                ChunkState s = m_chunkTable.nodes[row]->currentState.load();
                 // Don't unload mid-generation to avoid race conditions with worker threads
                 if (s != ChunkState::GENERATING && s != ChunkState::MESHING) {
-                    result->chunksToUnload.push_back(pair.first);
+                    result->chunksToUnload.push_back(m_chunkTable.keys[row]);
                 }
             }
         }
@@ -531,11 +1132,21 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
             });
         });
 
+        // Pass 0 fills the rings around the camera, pass 1 the rings around the predicted position.
+        // Priority is always the distance to the real camera, so prefetch never starves visible holes.
+        // What only pass 1 asked for isn't drawn over its parent until the camera ring gets there (ShouldHoldDraw).
+        bool predicting = (predictedPos.x != cameraPos.x || predictedPos.z != cameraPos.z);
+        int passCount = predicting ? 2 : 1;
+
+        for (int pass = 0; pass < passCount; pass++) {
         // Iterate through LOD levels (High Detail -> Low Detail)
         for(int lod = 0; lod < m_config->settings.lodCount; lod++) {
             int scale = 1 << lod;
-            int playerChunkX = (int)floor(cameraPos.x / (CHUNK_SIZE * scale));
-            int playerChunkZ = (int)floor(cameraPos.z / (CHUNK_SIZE * scale));
+            int playerChunkX = camChunkXByLod[lod];
+            int playerChunkZ = camChunkZByLod[lod];
+            int centerX = (pass == 0) ? playerChunkX : predChunkXByLod[lod];
+            int centerZ = (pass == 0) ? playerChunkZ : predChunkZByLod[lod];
+            if (pass == 1 && centerX == playerChunkX && centerZ == playerChunkZ) continue; // Same ring, already done
             
             int radius = m_config->settings.lodRadius[lod];
             int radiusSq = radius * radius; 
@@ -556,8 +1167,21 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
                 // Donut hole check
                 if (lod > 0 && std::abs(offset.first) < minRadius && std::abs(offset.second) < minRadius) continue;
 
-                int targetX = playerChunkX + offset.first;
-                int targetZ = playerChunkZ + offset.second;
+                int targetX = centerX + offset.first;
+                int targetZ = centerZ + offset.second;
+
+                // Predicted pass: only the cells the current ring doesn't own (the leading edge)
+                if (pass == 1 && std::abs(targetX - playerChunkX) <= radius && std::abs(targetZ - playerChunkZ) <= radius) continue;
+
+                // Far field: one heightfield tile per column, no vertical bands to work out
+                if (IsFarFieldLod(lod)) {
+                    if (!FindChunk(targetX, 0, targetZ, lod)) {
+                        int dx = targetX - playerChunkX;
+                        int dz = targetZ - playerChunkZ;
+                        result->chunksToLoad.push_back({targetX, 0, targetZ, lod, dx*dx + dz*dz});
+                    }
+                    continue;
+                }
                 
                 // Vertical Check: Ask generator for height bounds at this X/Z to skip empty sky/underground chunks
                 int minH, maxH;
@@ -567,9 +1191,7 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
                 int chunkYEnd = std::min(m_config->settings.worldHeightChunks - 1, (maxH / (CHUNK_SIZE * scale)) + 1);
 
                 for (int y = chunkYStart; y <= chunkYEnd; y++) {
-                    int64_t key = ChunkKey(targetX, y, targetZ, lod);
-                    
-                    if (m_activeChunkMap.find(key) == m_activeChunkMap.end()) {
+                    if (!FindChunk(targetX, y, targetZ, lod)) {
                         // Calculate priority distance (3D distance to camera)
                         int dx = targetX - playerChunkX; 
                         int dz = targetZ - playerChunkZ; 
@@ -582,6 +1204,7 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
                 }
             }
         }
+        }
         
         readLock.unlock(); 
 
@@ -589,7 +1212,7 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
         std::sort(result->chunksToLoad.begin(), result->chunksToLoad.end(), 
             [](const ChunkLoadRequest& a, const ChunkLoadRequest& b){ return a.distSq < b.distSq; });
 
-        // Submit result to main thread
+        // Submit result to the streaming step
         std::lock_guard<std::mutex> lock(m_lodResultMutex);
         m_pendingLODResult = std::move(result);
         m_isLODWorkerRunning = false;
@@ -597,9 +1220,10 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
 
     /**
      * @brief Manages the async dispatching of the LOD calculation job.
-     * Also applies the results (creating/destroying chunks) on the main thread.
+     * Also applies the results (creating/destroying chunks) in the streaming step.
+     * @param predictedPos Extrapolated camera position (== cameraPos when not predicting).
      */
-    void ScheduleAsyncLODUpdate(glm::vec3 cameraPos) {
+    void ScheduleAsyncLODUpdate(glm::vec3 cameraPos, glm::vec3 predictedPos) {
         // --- Helper: Process Deletions ---
         auto ProcessUnloads = [this]() {
             std::lock_guard<std::mutex> lock(m_lodResultMutex);
@@ -610,27 +1234,13 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
                     auto it = m_activeChunkMap.find(key);
                     if (it != m_activeChunkMap.end()) {
                         ChunkNode* node = it->second;
-                        
-                        // Notify GPU Culler to stop drawing this
-                        m_gpuOcclusionCuller->RemoveChunk(node->uniqueID);
-                        
-                        // Free GPU Memory
-                        if (node->vramOffsetOpaque != -1) {
-                            m_vramManager->Free(node->vramOffsetOpaque, node->vertexCountOpaque * sizeof(PackedVertex));
-                            node->vramOffsetOpaque = -1;
-                        }
-                        if (node->vramOffsetTransparent != -1) {
-                            m_vramManager->Free(node->vramOffsetTransparent, node->vertexCountTransparent * sizeof(PackedVertex));
-                            node->vramOffsetTransparent = -1;
-                        }
-
-                        // when transitioning LODs, make sure we release voxel data or it would leak memory
-                        if (node->voxelData) {
-                            m_voxelDataPool.Release(node->voxelData);
-                            node->voxelData = nullptr;
-                        }
+                        ReleaseChunkResources(node);
                         
                         // Return to Pool
+                        m_chunkTable.Remove(node);
+                        m_chunkClipmap.Remove(node);
+                        UnlinkLODHierarchy(node);
+                        UnlinkNeighbors(node);
                         m_chunkMetadataPool.Release(node);
                         m_activeChunkMap.erase(it);
                     }
@@ -642,9 +1252,10 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
         // --- Trigger Async Thread ---
         if (!m_isLODWorkerRunning) {
              float distSq = glm::dot(cameraPos - m_lastLODCalculationPos, cameraPos - m_lastLODCalculationPos);
+             float predDistSq = glm::dot(predictedPos - m_lastLODPredictionPos, predictedPos - m_lastLODPredictionPos);
              
-             // Only recalculate if player moved significantly (64 units)
-             if (distSq > 64.0f) { 
+             // Only recalculate if player (or where we expect them to be) moved significantly (64 units)
+             if (distSq > 64.0f || predDistSq > 64.0f) { 
                  // If teleported (huge distance), force immediate cleanup
                  if (distSq > 10000.0f) { 
                      ProcessUnloads(); 
@@ -653,12 +1264,13 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
                  }
                  
                  m_lastLODCalculationPos = cameraPos;
+                 m_lastLODPredictionPos = predictedPos;
                  m_isLODWorkerRunning = true;
                  m_activeWorkerTaskCount++;
                  
                  // Enqueue Job
-                 m_workerThreadPool.enqueue([this, cameraPos](){ 
-                     this->AsyncJob_CalculateLODs(cameraPos); 
+                 m_workerThreadPool.enqueue([this, cameraPos, predictedPos](){ 
+                     this->AsyncJob_CalculateLODs(cameraPos, predictedPos); 
                      m_activeWorkerTaskCount--; 
                  });
              }
@@ -693,14 +1305,20 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
                     idx++;
                     
                     int64_t key = ChunkKey(req.x, req.y, req.z, req.lod);
-                    if (m_activeChunkMap.find(key) == m_activeChunkMap.end()) {
+                    if (!FindChunk(req.x, req.y, req.z, req.lod)) {
                         ChunkNode* newNode = m_chunkMetadataPool.Acquire();
                         if (newNode) {
                             newNode->Reset(req.x, req.y, req.z, req.lod);
+                            newNode->isHeightfield = IsFarFieldLod(req.lod);
                             newNode->uniqueID = key; 
+                            newNode->requestTime = GetWorldTime();
                             m_activeChunkMap[key] = newNode;
+                            m_chunkTable.Add(newNode);
+                            m_chunkClipmap.Insert(newNode);
+                            LinkLODHierarchy(newNode);
+                            LinkNeighbors(newNode);
                             
-                            newNode->currentState = ChunkState::GENERATING;
+                            newNode->SetState(ChunkState::GENERATING);
                             m_activeWorkerTaskCount++; 
                             
                             m_workerThreadPool.enqueue([this, newNode]() { 
@@ -755,10 +1373,11 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
 
         float traveled = 0.0f;
         int lastX = x, lastY = y, lastZ = z;
+        ChunkNode* chunkHint = nullptr; // Consecutive steps stay in the same or a neighbouring chunk
 
         while (traveled < maxDist) {
-            // Check block (0 is Air)
-            if (GetBlockAt(x, y, z) != 0) { 
+            // Check block (anything that gets meshed counts as a hit)
+            if (IsVisibleBlock(GetBlockAt(x, y, z, chunkHint))) { 
                 res.success = true;
                 res.blockPos = glm::ivec3(x, y, z);
                 res.faceNormal = glm::ivec3(lastX - x, lastY - y, lastZ - z);
@@ -785,12 +1404,8 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
     int cy = (int)floor(y / (float)CHUNK_SIZE);
     int cz = (int)floor(z / (float)CHUNK_SIZE);
 
-    int64_t key = ChunkKey(cx, cy, cz, 0); 
-    
-    auto it = m_activeChunkMap.find(key);
-    if (it == m_activeChunkMap.end()) return; 
-
-    ChunkNode* node = it->second;
+    ChunkNode* node = FindChunk(cx, cy, cz, 0);
+    if (!node) return; 
     if (node->currentState != ChunkState::ACTIVE) return; 
 
     // 2. Handle Uniform Inflation
@@ -802,6 +1417,9 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
         node->isUniform = false;
     }
 
+    // Shared with identical chunks? Copy before writing
+    if (!m_payloadStore.Detach(node)) return;
+
     // 3. Update Voxel (Local)
     int lx = x % CHUNK_SIZE; if (lx < 0) lx += CHUNK_SIZE;
     int ly = y % CHUNK_SIZE; if (ly < 0) ly += CHUNK_SIZE;
@@ -810,7 +1428,7 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
     node->voxelData->Set(lx + 1, ly + 1, lz + 1, id);
 
     // 4. Trigger Re-Mesh (Current Chunk)
-    node->currentState = ChunkState::GENERATING;
+    node->SetState(ChunkState::GENERATING);
     {
         std::lock_guard<std::mutex> lock(m_queueMutex);
         m_queueGeneratedChunks.push(node);
@@ -818,11 +1436,9 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
 
     // 5. Update Neighbors (Fix Seams & Update Padding)
     auto TriggerNeighbor = [&](int offsetX, int offsetY, int offsetZ) {
-        int64_t nKey = ChunkKey(cx + offsetX, cy + offsetY, cz + offsetZ, 0);
-        auto nIt = m_activeChunkMap.find(nKey);
+        ChunkNode* nNode = node->neighbors[NeighborIndex(offsetX, offsetY, offsetZ)];
         
-        if (nIt != m_activeChunkMap.end()) {
-            ChunkNode* nNode = nIt->second;
+        if (nNode) {
 
             // CRITICAL FIX: Update the neighbor's padding memory!
             // If the neighbor is Uniform, we MUST inflate it to store this padding change,
@@ -836,7 +1452,7 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
                 }
             }
 
-            if (nNode->voxelData) {
+            if (nNode->voxelData && m_payloadStore.Detach(nNode)) {
                 // Map global pos to neighbor's local space
                 // Formula: local_coord - (offset * CHUNK_SIZE)
                 // If offsetX = -1 (Left Neighbor), lx=0 -> nx = 0 - (-32) = 32. 
@@ -848,9 +1464,9 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
                 nNode->voxelData->Set(nx + 1, ny + 1, nz + 1, id);
             }
 
-            // Flag for remesh
-            if (nNode->currentState == ChunkState::ACTIVE) {
-                nNode->currentState = ChunkState::GENERATING;
+            // Flag for remesh (held ones too, their mesh has the old padding)
+            if (nNode->currentState == ChunkState::ACTIVE || nNode->currentState == ChunkState::MESHED) {
+                nNode->SetState(ChunkState::GENERATING);
                 std::lock_guard<std::mutex> lock(m_queueMutex);
                 m_queueGeneratedChunks.push(nNode);
             }
@@ -876,25 +1492,41 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
      */
     void Draw(Shader& shader, const glm::mat4& viewProj, const glm::mat4& previousViewProjMatrix, const glm::mat4& proj, const int CUR_SCR_WIDTH, const int CUR_SCR_HEIGHT, Shader* depthDebugShader, bool depthDebug, bool frustumLock, glm::vec3 playerPosition) {
         if(m_isShuttingDown) return;
+
+        // GL side of the streaming steps finished so far
+        ApplyRenderSnapshot();
+
+        // Camera part of the per-frame constants, the culler adds its part and uploads the block
+        m_frameConstants->SetCamera(viewProj, previousViewProjMatrix, proj, playerPosition);
+        m_frameConstants->Data().debugMode = m_config->settings.cubeDebugMode;
         
         // --- PASS 1: GPU CULLING ---
         // Runs a compute shader to check every chunk against frustum and Hi-Z buffer.
         // Outputs draw commands to an Indirect Buffer.
         {
+            if (m_gpuOcclusionCuller->GetSettings().caveCullingEnabled) {
+                UpdatePotentiallyVisibleSet(playerPosition);
+            } else {
+                m_gpuOcclusionCuller->ClearPotentiallyVisibleSet();
+            }
+
+            const CullerSettings& cullSettings = m_gpuOcclusionCuller->GetSettings();
+            if (cullSettings.occlusionEnabled && cullSettings.boxOccluders) {
+                UpdateOccluders(playerPosition, viewProj);
+            }
+
             Engine::Profiler::Get().BeginGPU("GPU: Buffer and Cull Compute"); 
-            m_gpuOcclusionCuller->Cull(viewProj, previousViewProjMatrix, proj, g_fbo.hiZTex);
+            m_gpuOcclusionCuller->Cull(*m_frameConstants, g_fbo.hiZTex);
             Engine::Profiler::Get().EndGPU();
         }
 
         // --- PASS 2: RENDER GEOMETRY ---
         {   
-            Engine::Profiler::Get().BeginGPU("GPU: MDI DRAW"); 
+            // Opaque MDI timed under a name per emission order, so the profiler lists both side by side
+            Engine::Profiler::Get().BeginGPU(m_gpuOcclusionCuller->GetSettings().distanceBuckets ? "GPU: Opaque MDI (near to far)" : "GPU: Opaque MDI (unsorted)"); 
 
             shader.use();
-            // Standard Uniforms
-            glUniformMatrix4fv(glGetUniformLocation(shader.ID, "u_ViewProjection"), 1, GL_FALSE, glm::value_ptr(viewProj));
-            glUniform3fv(glGetUniformLocation(shader.ID, "u_CameraPos"), 1, glm::value_ptr(playerPosition)); 
-            glUniform1i(glGetUniformLocation(shader.ID, "u_DebugMode"), m_config->settings.cubeDebugMode);
+            // Matrices, camera and debug mode come from the FrameConstants block Cull uploaded (binding 0)
             
             // Bind SSBOs (Shader Storage Buffer Objects)
             glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, m_vramManager->GetID());           // Big Vertex Buffer
@@ -917,10 +1549,12 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
             // -- Draw Opaque --
             // uses glMultiDrawArraysIndirectCount to draw only visible chunks
             glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_gpuOcclusionCuller->GetIndirectOpaque());
-            glBindBuffer(GL_PARAMETER_BUFFER, m_gpuOcclusionCuller->GetAtomicCounter()); // Contains count of visible chunks
-            glMultiDrawArraysIndirectCount(GL_TRIANGLES, 0, 0, (GLsizei)m_gpuOcclusionCuller->GetMaxChunks(), 0);
+            glBindBuffer(GL_PARAMETER_BUFFER, m_gpuOcclusionCuller->GetAtomicCounter()); // Contains count of visible chunks / opaque commands
+            glMultiDrawArraysIndirectCount(GL_TRIANGLES, 0, GpuCuller::OPAQUE_COUNT_OFFSET, (GLsizei)m_gpuOcclusionCuller->GetMaxOpaqueCommands(), 0);
+            Engine::Profiler::Get().EndGPU();
 
             // -- Draw Transparent --
+            Engine::Profiler::Get().BeginGPU("GPU: Transparent MDI");
             // Drawn after opaque for blending
             glEnable(GL_BLEND);
             glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
@@ -965,9 +1599,13 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
 
             Engine::Profiler::Get().EndGPU();
         }
+
+        // Last use of the vertex heap this frame: what this frame's snapshot retired waits for these draws
+        m_vramManager->FenceRetired();
     }
 
     GpuCuller* GetCuller() { return m_gpuOcclusionCuller.get(); }
+    ChunkCostMap& GetChunkCostMap() { return m_chunkCosts; }
 
     void RenderHiZDebug(Shader* debugShader, GLuint hizTexture, int mipLevel, int screenW, int screenH) {
         glDisable(GL_DEPTH_TEST); 
@@ -994,34 +1632,39 @@ inline uint8_t GetBlockAt(int x, int y, int z) const {
     }
 
     void ReloadWorld(EngineConfig newConfig) {
+        Engine::Profiler::ScopedTimer timer("World::ReloadWorld");
+
+        // An LOD job still running reads the config and the old map, and would hand in a result for
+        // that map after the reset. Let it finish first, then drop what it produced.
+        while (m_isLODWorkerRunning && !m_isShuttingDown) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+        LogDedupStats();
+        LogLodFootprints();
         m_config = std::make_unique<EngineConfig>(newConfig);
         m_terrainGenerator->Init();
         {
             std::unique_lock<std::shared_mutex> lock(m_chunkMapMutex);
+            m_chunkTable.Clear();
+            m_chunkClipmap.Init(m_config->settings.lodRadius, m_config->settings.lodCount, m_config->settings.worldHeightChunks);
             for (auto& pair : m_activeChunkMap) {
                 ChunkNode* node = pair.second;
-                m_gpuOcclusionCuller->RemoveChunk(node->uniqueID); 
-                if (node->vramOffsetOpaque != -1) {
-                    m_vramManager->Free(node->vramOffsetOpaque, node->vertexCountOpaque * sizeof(PackedVertex));
-                    node->vramOffsetOpaque = -1;
-                }
-                if (node->vramOffsetTransparent != -1) {
-                    m_vramManager->Free(node->vramOffsetTransparent, node->vertexCountTransparent * sizeof(PackedVertex));
-                    node->vramOffsetTransparent = -1;
-                }
-
                 // same as updating lods, pretend as if we need to release all voxel data
-                if (node->voxelData) {
-                    m_voxelDataPool.Release(node->voxelData);
-                    node->voxelData = nullptr;
-                }
-
+                ReleaseChunkResources(node);
                 m_chunkMetadataPool.Release(node);
             }
             m_activeChunkMap.clear();
+
+            // Every node is unlinked by now, this only catches payloads of chunks that were mid-flight
+            std::vector<ChunkPayloadStore::MeshRange> meshesToFree;
+            m_payloadStore.Clear(meshesToFree);
+            FreeMeshRanges(meshesToFree);
         }
         m_lastLODCalculationPos = glm::vec3(-99999.0f);
-        m_pendingLODResult = nullptr;
+        m_lastLODPredictionPos = glm::vec3(-99999.0f);
+        {
+            std::lock_guard<std::mutex> lock(m_lodResultMutex);
+            m_pendingLODResult = nullptr;
+        }
     }
 
 private:
@@ -1036,17 +1679,49 @@ private:
     void ExecuteTask_GenerateVoxelData(ChunkNode* node) {
         if (m_isShuttingDown) return;
         Engine::Profiler::ScopedTimer timer("[ASYNC] Task: Generate");
+        bool recordCost = m_chunkCosts.IsEnabled();
+        auto start = recordCost ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+
+        if (node->isHeightfield) {
+            FillHeightfieldColumns(node);
+            if (recordCost) m_chunkCosts.RecordGeneration(node, ElapsedMicroseconds(start));
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            if (m_isShuttingDown) return;
+            m_queueGeneratedChunks.push(node);
+            return;
+        }
 
         float outMinY, outMaxY;
         FillChunkVoxels(node, outMinY, outMaxY);
         
-        // Note: outMinY/outMaxY can be used to tighten AABB here if desired.
+        // Note: the culling AABB is tightened by the mesher (ChunkMeshBounds), not from these.
+
+        // Share voxels (and later the mesh) with any identical chunk
+        m_payloadStore.Link(node);
+        if (recordCost) m_chunkCosts.RecordGeneration(node, ElapsedMicroseconds(start));
         
         std::lock_guard<std::mutex> lock(m_queueMutex);
         if (m_isShuttingDown) return;
         m_queueGeneratedChunks.push(node);
     }
 
+    static float ElapsedMicroseconds(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    /**
+     * @brief Far-field counterpart of FillChunkVoxels: 2D surface columns only, no voxel allocation.
+     * The tile's origin moves down to its lowest unit so the whole surface fits the vertex format.
+     */
+    void FillHeightfieldColumns(ChunkNode* node) {
+        int scale = node->scaleFactor;
+        node->isUniform = false;
+        node->voxelData = nullptr;
+        node->heightfieldColumns.resize(HEIGHTFIELD_COLUMNS);
+        m_terrainGenerator->GenerateSurfaceColumns(node->heightfieldColumns.data(), node->gridX, node->gridZ, scale);
+        node->worldPosition.y = (float)(ComputeHeightfieldBase(node->heightfieldColumns.data(), scale) * scale);
+    }
+
     /**
      * @brief Helper to allocate and fill the Chunk object with blocks.
      */
@@ -1076,7 +1751,7 @@ private:
         // Case: Fully Solid (Underground)
         if (chunkTopY < minGenH) {
                 node->isUniform = true;
-                node->uniformBlockID = 3; // Solid Stone
+                node->uniformBlockID = Block::STONE; // Solid Stone
                 node->voxelData = nullptr;
                 outMinY = (float)chunkBottomY;
                 outMaxY = (float)chunkTopY;
@@ -1098,35 +1773,10 @@ private:
         m_terrainGenerator->GenerateChunk(node->voxelData, cx, cy, cz, scale); // currently, the generator is dumb and has no way of marking if the block is all air
 
         // ************ If the generated chunk turned out to be all air, then check for that quickly and get rid of the allocated voxel data IDs and set as Uniform ********* //
-        // --- OPTIMIZED POST-GENERATION CHECK (Raw Memory Scan) ---
-        // Using raw pointers removes the overhead of index calculation in Get().
-        
-        bool allSame = true;
+        // --- POST-GENERATION CHECK (Layout-aware scan of the inner volume, padding skipped) ---
         uint8_t firstID = node->voxelData->Get(1, 1, 1); /// if things arent generating underground, this could be the culprit, maybe stricly set to ID 0 for air
-        
-        const uint8_t* voxels = node->voxelData->voxels;
-        // Precompute strides for X-Contiguous layout
-        const int strideY = CHUNK_SIZE_PADDED * CHUNK_SIZE_PADDED;
-        const int strideZ = CHUNK_SIZE_PADDED;
-
-        // Iterate strictly over the inner volume (1..32)
-        // We skip padding (0 and 33) to ensure we check only relevant data
-        for (int y = 1; y <= CHUNK_SIZE; ++y) {
-            int offsetY = y * strideY;
-            for (int z = 1; z <= CHUNK_SIZE; ++z) {
-                int offset = offsetY + (z * strideZ) + 1; // Start of row X at 1
-                
-                // Check 32 contiguous bytes (Compiler will likely auto-vectorize this)
-                for (int x = 0; x < CHUNK_SIZE; ++x) {
-                     if (voxels[offset + x] != firstID) {
-                         allSame = false;
-                         goto check_complete;
-                     }
-                }
-            }
-        }
+        bool allSame = node->voxelData->IsInnerUniform(firstID);
 
-        check_complete:
         if (allSame) {
             m_voxelDataPool.Release(node->voxelData);
             node->voxelData = nullptr;
@@ -1148,62 +1798,282 @@ private:
     void ExecuteAsyncMeshingTask(ChunkNode* node) {
         if (m_isShuttingDown) return;
         Engine::Profiler::ScopedTimer timer("[ASYNC] Task: Mesh"); 
+        bool recordCost = m_chunkCosts.IsEnabled();
+        auto start = recordCost ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
         
         // Temporary stack-like allocators for building mesh
         LinearAllocator<PackedVertex> opaqueAllocator(100000); 
         LinearAllocator<PackedVertex> transAllocator(50000); 
 
-        // Execute meshing algorithm
-        MeshChunk(*node->voxelData, opaqueAllocator, transAllocator, false);
+        if (node->isHeightfield) {
+            // Far-field tile: surface + skirts, no voxels (so no occluder box, connectivity stays open)
+            int scale = node->scaleFactor;
+            int baseUnits = (int)node->worldPosition.y / scale;
+            MeshHeightfieldTile(node->heightfieldColumns.data(), scale, baseUnits, opaqueAllocator, transAllocator);
+            node->heightfieldColumns.clear();
+            node->heightfieldColumns.shrink_to_fit();
+        } else {
+            // Execute meshing algorithm
+            MeshChunk(*node->voxelData, opaqueAllocator, transAllocator, false);
+
+            // Face-to-face connectivity for the visibility walk (flood fill over air/transparent cells)
+            node->faceConnectivity = ComputeChunkConnectivity(*node->voxelData);
+        }
 
         // trying to detect if a block is all air and uniform after this is just really the same maybe worse than doing it right after the generate call in fillChunk. could be empty but all underground or empty but all air either way check has to be run 
         
         // Copy to node cache (heap allocation happening here)
         node->cachedMeshOpaque.assign(opaqueAllocator.Data(), opaqueAllocator.Data() + opaqueAllocator.Count());
         node->cachedMeshTransparent.assign(transAllocator.Data(), transAllocator.Data() + transAllocator.Count());
+
+        // Cluster the opaque mesh for per-meshlet culling (transparent stays one range, it's small)
+        BuildMeshlets(node->cachedMeshOpaque.data(), node->cachedMeshOpaque.size(), node->cachedMeshlets);
+
+        // Tight culling box around what was emitted + a solid inner box for the occluder pass
+        ChunkMeshBounds bounds;
+        AccumulateGeometryBounds(node->cachedMeshlets, bounds);
+        AccumulateGeometryBounds(node->cachedMeshTransparent.data(), node->cachedMeshTransparent.size(), bounds);
+        if (node->voxelData) ComputeOccluderBox(*node->voxelData, bounds);
+        node->meshBounds = bounds;
+
+        if (recordCost) {
+            size_t vertices = node->cachedMeshOpaque.size() + node->cachedMeshTransparent.size();
+            m_chunkCosts.RecordMesh(node, ElapsedMicroseconds(start), (uint32_t)(vertices / 6)); // 2 triangles per quad
+        }
         
         std::lock_guard<std::mutex> lock(m_queueMutex);
         if (m_isShuttingDown) return;
         m_queueMeshedChunks.push(node);
     }
 
+    /**
+     * @brief Walks the LOD 0 chunk grid from the camera chunk through connected faces and
+     * hands the reachable chunk IDs to the culler as this frame's potentially visible set.
+     * Render thread, runs next to the streaming step: reads the map under the shared lock.
+     */
+    void UpdatePotentiallyVisibleSet(const glm::vec3& cameraPos) {
+        Engine::Profiler::ScopedTimer timer("World::VisibilityWalk");
+        std::shared_lock<std::shared_mutex> readLock(m_chunkMapMutex);
+
+        int camX = (int)std::floor(cameraPos.x / CHUNK_SIZE);
+        int camY = (int)std::floor(cameraPos.y / CHUNK_SIZE);
+        int camZ = (int)std::floor(cameraPos.z / CHUNK_SIZE);
+
+        // Unknown, unloaded or still (re)meshing chunks count as open so we never hide real geometry
+        auto GetConnectivity = [this](int x, int y, int z) -> uint64_t {
+            ChunkNode* node = FindChunk(x, y, z, 0);
+            if (!node) return CONNECTIVITY_ALL;
+            if (node->currentState.load() != ChunkState::ACTIVE) return CONNECTIVITY_ALL;
+            if (node->isUniform) return IsOpaque(node->uniformBlockID) ? CONNECTIVITY_NONE : CONNECTIVITY_ALL;
+            return node->faceConnectivity.load(std::memory_order_relaxed);
+        };
+
+        const auto& cells = m_visibilityGraph.Traverse(camX, camY, camZ,
+                                                       m_config->settings.lodRadius[0] + 1, // +1: chunks waiting on unload hysteresis
+                                                       0, m_config->settings.worldHeightChunks - 1,
+                                                       GetConnectivity);
+
+        m_visibleChunkIDs.clear();
+        for (const auto& cell : cells) {
+            m_visibleChunkIDs.push_back(ChunkKey(cell.x, cell.y, cell.z, 0));
+        }
+        m_gpuOcclusionCuller->SetPotentiallyVisibleSet(m_visibleChunkIDs);
+    }
+
+    /**
+     * @brief Collects the solid occluder boxes of the LOD 0 chunks around the camera, keeps the ones
+     * covering the most screen (volume / distance^2) and rasterises them for this frame's occlusion test.
+     * Uniform opaque chunks occlude with their whole cube. Render thread, same lock as the visibility walk.
+     */
+    void UpdateOccluders(const glm::vec3& cameraPos, const glm::mat4& viewProj) {
+        Engine::Profiler::ScopedTimer timer("World::Occluders");
+        std::shared_lock<std::shared_mutex> readLock(m_chunkMapMutex);
+
+        int camX = (int)std::floor(cameraPos.x / CHUNK_SIZE);
+        int camY = (int)std::floor(cameraPos.y / CHUNK_SIZE);
+        int camZ = (int)std::floor(cameraPos.z / CHUNK_SIZE);
+        int radius = std::max(0, m_gpuOcclusionCuller->GetSettings().occluderRadius);
+
+        glm::vec4 planes[6];
+        ExtractFrustumPlanes(viewProj, planes);
+
+        m_occluderCandidates.clear();
+        for (int y = camY - radius; y <= camY + radius; y++) {
+            if (y < 0 || y >= m_config->settings.worldHeightChunks) continue;
+            for (int z = camZ - radius; z <= camZ + radius; z++) {
+                for (int x = camX - radius; x <= camX + radius; x++) {
+                    ChunkNode* node = FindChunk(x, y, z, 0);
+                    if (!node || node->currentState.load() != ChunkState::ACTIVE) continue;
+
+                    glm::vec3 boxMin, boxMax;
+                    if (node->isUniform) {
+                        if (!IsOpaque(node->uniformBlockID)) continue;
+                        boxMin = node->worldPosition;
+                        boxMax = node->worldPosition + glm::vec3((float)CHUNK_SIZE);
+                    } else if (node->meshBounds.hasOccluder) {
+                        const ChunkMeshBounds& b = node->meshBounds;
+                        boxMin = node->worldPosition + glm::vec3(b.occluderMin[0], b.occluderMin[1], b.occluderMin[2]);
+                        boxMax = node->worldPosition + glm::vec3(b.occluderMax[0], b.occluderMax[1], b.occluderMax[2]);
+                    } else {
+                        continue;
+                    }
+
+                    // Inside solid rock (noclip) the box would hide everything past it
+                    glm::vec3 nearest = glm::clamp(cameraPos, boxMin, boxMax);
+                    glm::vec3 toBox = nearest - cameraPos;
+                    float distSq = glm::dot(toBox, toBox);
+                    if (distSq < 1.0f) continue;
+                    if (!IsBoxInFrustum(planes, boxMin, boxMax)) continue;
+
+                    glm::vec3 size = boxMax - boxMin;
+                    float score = (size.x * size.y * size.z) / distSq;
+                    m_occluderCandidates.push_back({ score, OccluderBox{ glm::vec4(boxMin, 0.0f), glm::vec4(boxMax, 0.0f) } });
+                }
+            }
+        }
+
+        size_t keep = std::min(m_occluderCandidates.size(), GpuCuller::MAX_OCCLUDER_BOXES);
+        auto byScore = [](const std::pair<float, OccluderBox>& a, const std::pair<float, OccluderBox>& b) { return a.first > b.first; };
+        if (keep < m_occluderCandidates.size()) {
+            std::nth_element(m_occluderCandidates.begin(), m_occluderCandidates.begin() + keep, m_occluderCandidates.end(), byScore);
+        }
+
+        m_occluderBoxes.clear();
+        for (size_t i = 0; i < keep; i++) m_occluderBoxes.push_back(m_occluderCandidates[i].second);
+        m_gpuOcclusionCuller->RenderOccluders(m_occluderBoxes, viewProj);
+    }
+
+    /**
+     * @brief Wires a freshly inserted node into the LOD hierarchy (parent at lod + 1, children at lod - 1).
+     * Streaming step, under the map's unique lock. 9 lookups per insert instead of 1-8 per node per LOD pass.
+     */
+    void LinkLODHierarchy(ChunkNode* node) {
+        int lod = node->lodLevel;
+
+        // No links across the voxel -> heightfield boundary: a tile has no Y bands for the child slots,
+        // IsParentReady / AreChildrenReady look those up directly instead.
+        bool parentLinkable = !IsFarFieldLod(lod + 1) || node->isHeightfield;
+        bool childrenLinkable = !node->isHeightfield || IsFarFieldLod(lod - 1);
+
+        if (lod + 1 < m_config->settings.lodCount && parentLinkable) {
+            if (ChunkNode* parent = FindChunk(node->gridX >> 1, node->gridY >> 1, node->gridZ >> 1, lod + 1)) {
+                node->parent = parent;
+                parent->children[node->childSlot] = node;
+                parent->childMask |= (uint8_t)(1u << node->childSlot);
+                if (node->currentState.load() == ChunkState::ACTIVE) parent->activeChildMask.fetch_or((uint8_t)(1u << node->childSlot));
+            }
+        }
+
+        if (lod > 0 && childrenLinkable) {
+            for (int slot = 0; slot < 8; slot++) {
+                int childX = node->gridX * 2 + (slot & 1);
+                int childZ = node->gridZ * 2 + ((slot >> 1) & 1);
+                int childY = node->gridY * 2 + ((slot >> 2) & 1);
+                ChunkNode* child = FindChunk(childX, childY, childZ, lod - 1);
+                if (!child) continue;
+
+                child->parent = node;
+                node->children[slot] = child;
+                node->childMask |= (uint8_t)(1u << slot);
+                if (child->currentState.load() == ChunkState::ACTIVE) node->activeChildMask.fetch_or((uint8_t)(1u << slot));
+            }
+        }
+    }
+
+    /**
+     * @brief Detaches a node from its parent and children before it goes back to the pool.
+     */
+    void UnlinkLODHierarchy(ChunkNode* node) {
+        if (ChunkNode* parent = node->parent) {
+            uint8_t bit = (uint8_t)(1u << node->childSlot);
+            parent->children[node->childSlot] = nullptr;
+            parent->childMask &= (uint8_t)~bit;
+            parent->activeChildMask.fetch_and((uint8_t)~bit);
+            node->parent = nullptr;
+        }
+        for (ChunkNode*& child : node->children) {
+            if (child) {
+                child->parent = nullptr;
+                child = nullptr;
+            }
+        }
+        node->childMask = 0;
+        node->activeChildMask = 0;
+    }
+
+    /**
+     * @brief Wires the 26 same-LOD neighbour links of a freshly inserted node (both directions).
+     * Streaming step, under the map's unique lock.
+     */
+    void LinkNeighbors(ChunkNode* node) {
+        for (int i = 0; i < 26; i++) {
+            int dx, dy, dz;
+            NeighborOffset(i, dx, dy, dz);
+            ChunkNode* neighbor = FindChunk(node->gridX + dx, node->gridY + dy, node->gridZ + dz, node->lodLevel);
+            node->neighbors[i] = neighbor;
+            if (neighbor) neighbor->neighbors[OppositeNeighbor(i)] = node;
+        }
+    }
+
+    /**
+     * @brief Clears every link pointing at a node that's about to go back to the pool.
+     */
+    void UnlinkNeighbors(ChunkNode* node) {
+        for (int i = 0; i < 26; i++) {
+            if (ChunkNode* neighbor = node->neighbors[i]) {
+                neighbor->neighbors[OppositeNeighbor(i)] = nullptr;
+                node->neighbors[i] = nullptr;
+            }
+        }
+    }
+
     /**
      * @brief Checks if the children (higher detail chunks) of a node are loaded.
      * Used to prevent cracks when transitioning LODs.
+     * Every tracked child must be ACTIVE and every child the terrain expects must be tracked,
+     * so this is a couple of mask tests once expectedChildMask is known.
      * @return true if all 8 children are ACTIVE or empty.
      */
-    bool AreChildrenReady(int cx, int cy, int cz, int lod) {
+    bool AreChildrenReady(ChunkNode* node) {
+        int lod = node->lodLevel;
         if (lod == 0) return true; // Lowest level has no children
-        
-        int childLod = lod - 1;
-        int scale = 1 << childLod; 
-        int startX = cx * 2; int startY = cy * 2; int startZ = cz * 2;
-
-        for (int x = 0; x < 2; x++) {
-            for (int z = 0; z < 2; z++) {
-                // Optimization: Check bounds before lookups
-                int minH, maxH;
-                m_terrainGenerator->GetHeightBounds((startX + x), (startZ + z), scale, minH, maxH);
-                int chunkYStart = (minH / (CHUNK_SIZE * scale)) - 1; 
-                int chunkYEnd = (maxH / (CHUNK_SIZE * scale)) + 1;
+        if (node->isHeightfield && !IsFarFieldLod(lod - 1)) return AreVoxelChildrenReady(node);
+
+        // Which children should exist depends only on the terrain, so ask the generator once per node.
+        // Only the LOD thread reads/writes these two fields.
+        if (!node->hasExpectedChildMask) {
+            int childLod = lod - 1;
+            int scale = 1 << childLod;
+            int startX = node->gridX * 2; int startY = node->gridY * 2; int startZ = node->gridZ * 2;
+            uint8_t expected = 0;
+
+            for (int x = 0; x < 2; x++) {
+                for (int z = 0; z < 2; z++) {
+                    // Heightfield children are one tile per column, at gridY 0
+                    if (node->isHeightfield) {
+                        expected |= (uint8_t)(1u << (x | (z << 1)));
+                        continue;
+                    }
+                    int minH, maxH;
+                    m_terrainGenerator->GetHeightBounds((startX + x), (startZ + z), scale, minH, maxH);
+                    int chunkYStart = (minH / (CHUNK_SIZE * scale)) - 1; 
+                    int chunkYEnd = (maxH / (CHUNK_SIZE * scale)) + 1;
 
-                for (int y = 0; y < 2; y++) {
-                    int64_t key = ChunkKey(startX + x, startY + y, startZ + z, childLod);
-                    auto it = m_activeChunkMap.find(key);
-                    
-                    // If chunk exists, it MUST be active (meshed & uploaded)
-                    if (it != m_activeChunkMap.end()) {
-                         if (it->second->currentState.load() != ChunkState::ACTIVE) return false;
-                    } else {
-                        // If chunk doesn't exist, ensure it's supposed to be empty
+                    for (int y = 0; y < 2; y++) {
                         int myY = startY + y;
                         if (myY >= chunkYStart && myY <= chunkYEnd) {
-                            return false; // Should exist but doesn't
+                            expected |= (uint8_t)(1u << (x | (z << 1) | (y << 2)));
                         }
                     }
                 }
             }
+            node->expectedChildMask = expected;
+            node->hasExpectedChildMask = true;
         }
+
+        uint8_t tracked = node->childMask;
+        if (tracked & ~node->activeChildMask.load()) return false;   // Tracked but not uploaded yet
+        if (node->expectedChildMask & ~tracked) return false;        // Should exist but doesn't
         return true;
     }
 
@@ -1212,34 +2082,94 @@ private:
      * @brief Checks if the parent (lower detail chunk) is loaded.
      * Used to prevent holes when unloading high detail chunks.
      */
-    bool IsParentReady(int cx, int cy, int cz, int lod) {
-        if (lod >= m_config->settings.lodCount - 1) return true; 
-        
-        int parentLod = lod + 1;
-        int px = cx >> 1; int py = cy >> 1; int pz = cz >> 1;
+    bool IsParentReady(ChunkNode* node) {
+        if (node->lodLevel >= m_config->settings.lodCount - 1) return true; 
+        if (!node->isHeightfield && IsFarFieldLod(node->lodLevel + 1)) {
+            ChunkNode* tile = FindChunk(node->gridX >> 1, 0, node->gridZ >> 1, node->lodLevel + 1);
+            return tile && tile->currentState.load() == ChunkState::ACTIVE;
+        }
+        return node->parent && node->parent->currentState.load() == ChunkState::ACTIVE;
+    }
 
-        int64_t key = ChunkKey(px, py, pz, parentLod);
-        auto it = m_activeChunkMap.find(key);
-        
-        if (it == m_activeChunkMap.end() || it->second->currentState.load() != ChunkState::ACTIVE) {
-            return false;
+    /**
+     * @brief AreChildrenReady for the first heightfield LOD: its children are voxel chunks in whatever
+     * Y bands the load logic requests for their columns, so those are looked up one by one.
+     * LOD thread, under the map's shared lock. Only runs for tiles that are about to split.
+     */
+    bool AreVoxelChildrenReady(ChunkNode* node) {
+        int childLod = node->lodLevel - 1;
+        int scale = 1 << childLod;
+        for (int x = 0; x < 2; x++) {
+            for (int z = 0; z < 2; z++) {
+                int childX = node->gridX * 2 + x;
+                int childZ = node->gridZ * 2 + z;
+                int minH, maxH;
+                m_terrainGenerator->GetHeightBounds(childX, childZ, scale, minH, maxH);
+                int chunkYStart = std::max(0, (minH / (CHUNK_SIZE * scale)) - 1);
+                int chunkYEnd = std::min(m_config->settings.worldHeightChunks - 1, (maxH / (CHUNK_SIZE * scale)) + 1);
+                for (int y = chunkYStart; y <= chunkYEnd; y++) {
+                    ChunkNode* child = FindChunk(childX, y, childZ, childLod);
+                    if (!child || child->currentState.load() != ChunkState::ACTIVE) return false;
+                }
+            }
         }
         return true;
     }
 
     /**
-     * @brief Pushes current world stats to the global profiler for UI visualization.
+     * @brief LODs from RuntimeConfig::farFieldStartLod on are heightfield tiles (see heightfield_tile.h).
+     * LOD 0 always stays voxels, GetBlockAt / physics / editing read them.
      */
-    void UpdateProfilerPressure() {
-
-        // auto usage = m_voxelDataPool.GetUsedMB()+m_chunkMetadataPool.GetUsedMB(); 
-        // if (usage > 5400.0f)
-        //     GUI::DrawScreenMessage("CRITICAL MEMORY USAGE: Approaching 6GB Memory Limit", GUI::LEVEL_CRITICAL);
-    
+    bool IsFarFieldLod(int lod) const {
+        return lod >= std::max(1, m_config->settings.farFieldStartLod) && lod < m_config->settings.lodCount;
+    }
 
+    /**
+     * @brief Seconds since the world was created (steady clock).
+     */
+    float GetWorldTime() const {
+        return std::chrono::duration<float>(std::chrono::steady_clock::now() - m_clockStart).count();
+    }
 
-        // this section will only happen if the profiler is enabled
+    /**
+     * @brief Counts LOD 0 ring chunks that currently show nothing: tracked but not ACTIVE, and no ACTIVE
+     * parent drawing over them. Summed per frame over 1 s windows -> hole-frames per second.
+     * Profiler only; walks the hot table and only dereferences LOD 0 rows inside the ring.
+     */
+    void UpdateHoleMetric(glm::vec3 cameraPos, float now) {
         if (!Engine::Profiler::Get().m_Enabled) return;
+        Engine::Profiler::ScopedTimer timer("World::Hole Metric");
+
+        int radius = m_config->settings.lodRadius[0];
+        int camX = (int)floor(cameraPos.x / CHUNK_SIZE);
+        int camZ = (int)floor(cameraPos.z / CHUNK_SIZE);
+
+        // The streaming step is the only writer of the table, no lock needed to read it here
+        size_t holes = 0;
+        for (size_t row = 0; row < m_chunkTable.Size(); row++) {
+            if (m_chunkTable.lod[row] != 0) continue;
+            if (abs(m_chunkTable.gridX[row] - camX) > radius || abs(m_chunkTable.gridZ[row] - camZ) > radius) continue;
+
+            const ChunkNode* node = m_chunkTable.nodes[row];
+            if (node->currentState.load() == ChunkState::ACTIVE) continue;
+            if (node->parent && node->parent->currentState.load() == ChunkState::ACTIVE) continue;
+            holes++;
+        }
+
+        m_holesThisFrame = holes;
+        m_holeFramesInWindow += holes;
+        if (now - m_holeWindowStart >= 1.0f) {
+            m_holesPerSecond = (float)m_holeFramesInWindow / (now - m_holeWindowStart);
+            m_holeFramesInWindow = 0;
+            m_holeWindowStart = now;
+        }
+    }
+
+    /**
+     * @brief Sets the streaming gauges of the metrics registry. Every step, profiler on or off:
+     * a try_lock and a few atomic stores, plus a walk over the chunk map once per second for the state counts.
+     */
+    void UpdateMetrics(float now) {
         size_t pendingGen = 0;
         {
             std::unique_lock<std::mutex> lock(m_lodResultMutex, std::try_to_lock);
@@ -1247,19 +2177,55 @@ private:
                 pendingGen = m_pendingLODResult->chunksToLoad.size() - m_pendingLODResult->loadIndex;
             }
         }
-        size_t waitingMesh = m_queueGeneratedChunks.size();
-        size_t waitingUpload = m_queueMeshedChunks.size();
-        size_t activeThreads = m_activeWorkerTaskCount.load();
-        size_t totalActive = m_activeChunkMap.size(); 
+        m_metrics.pendingGeneration.Set((double)pendingGen);
+        {
+            // Workers push into both queues while the step runs
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            m_metrics.waitingMesh.Set((double)m_queueGeneratedChunks.size());
+            m_metrics.waitingUpload.Set((double)m_queueMeshedChunks.size());
+        }
+        m_metrics.activeTasks.Set((double)m_activeWorkerTaskCount.load());
+        m_metrics.trackedChunks.Set((double)m_activeChunkMap.size());
+        m_metrics.holesPerSecond.Set(m_holesPerSecond);
+        m_metrics.voxelPoolUsedMB.Set(m_voxelDataPool.GetUsedMB());
+        m_metrics.voxelPoolAllocatedMB.Set(m_voxelDataPool.GetAllocatedMB());
+        m_metrics.nodePoolUsedMB.Set(m_chunkMetadataPool.GetUsedMB());
+        m_metrics.nodePoolAllocatedMB.Set(m_chunkMetadataPool.GetAllocatedMB());
+
+        if (m_lastStateCountTime >= 0.0f && now - m_lastStateCountTime < 1.0f) return;
+        m_lastStateCountTime = now;
+        size_t counts[6] = {};
+        for (const auto& pair : m_activeChunkMap) counts[(size_t)pair.second->currentState.load(std::memory_order_relaxed)]++;
+        for (size_t i = 0; i < 6; i++) m_metrics.chunkStates[i]->Set((double)counts[i]);
+    }
+
+    /**
+     * @brief Pushes current world stats to the global profiler for UI visualization.
+     */
+    void UpdateProfilerPressure() {
 
+        // auto usage = m_voxelDataPool.GetUsedMB()+m_chunkMetadataPool.GetUsedMB(); 
+        // if (usage > 5400.0f)
+        //     GUI::DrawScreenMessage("CRITICAL MEMORY USAGE: Approaching 6GB Memory Limit", GUI::LEVEL_CRITICAL);
+    
 
 
+        // this section will only happen if the profiler is enabled
+        if (!Engine::Profiler::Get().m_Enabled) return;
 
+        // Same numbers the metrics gauges got this step (UpdateMetrics)
         Engine::Profiler::Get().SetPipelineStats(
-            pendingGen, waitingMesh, waitingUpload, activeThreads, totalActive,
+            (size_t)m_metrics.pendingGeneration.Get(), (size_t)m_metrics.waitingMesh.Get(), (size_t)m_metrics.waitingUpload.Get(),
+            (size_t)m_metrics.activeTasks.Get(), (size_t)m_metrics.trackedChunks.Get(),
             (size_t)m_config->MAX_TRANSIENT_VOXEL_MESHES,
-            m_voxelDataPool.GetAllocatedMB(), m_voxelDataPool.GetUsedMB(),
-            m_chunkMetadataPool.GetAllocatedMB(), m_chunkMetadataPool.GetUsedMB()
+            m_metrics.voxelPoolAllocatedMB.Get(), m_metrics.voxelPoolUsedMB.Get(),
+            m_metrics.nodePoolAllocatedMB.Get(), m_metrics.nodePoolUsedMB.Get()
+        );
+
+        Engine::Profiler::Get().SetStreamingStats(
+            m_holesThisFrame, m_holesPerSecond,
+            m_streamingPredictor.GetLatency() * 1000.0f, m_streamingPredictor.GetHorizon() * 1000.0f,
+            glm::length(m_predictedCameraPos - m_lastLODCalculationPos)
         );
     }
 };
\ No newline at end of file
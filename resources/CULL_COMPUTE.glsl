@@ -3,12 +3,12 @@ layout(local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
 
 // --- CONFIGURATION ---
 #define ENABLE_OCCLUSION 
-#define ZERO_TO_ONE_DEPTH // Matches C++ glClipControl
 
 // --- INPUTS ---
 // Must match ChunkGpuData in gpu_culler.h (std430 layout)
 struct ChunkGpuData {
-    vec4 minAABB_scale; 
+    vec4 origin_scale;  // Chunk origin (vertex offset) + scale
+    vec4 minAABB_pad;   // Tight bounds of the emitted geometry
     vec4 maxAABB_pad;   
     
     // Opaque Mesh
@@ -18,6 +18,12 @@ struct ChunkGpuData {
     // Transparent Mesh
     uint firstVertexTrans;
     uint countTrans;      
+
+    // Opaque mesh clusters (0 = draw the whole opaque range)
+    uint firstMeshlet;
+    uint meshletCount;
+    uint pad0;
+    uint pad1;
 };
 
 // FIX: Changed Binding from 0 to 4.
@@ -27,18 +33,56 @@ layout(std430, binding = 4) readonly buffer GlobalBuffer {
     ChunkGpuData allChunks[];
 };
 
-uniform mat4 u_ViewProjection;     // CURRENT Frame (For Frustum Culling)
-uniform mat4 u_PrevViewProjection; // PREVIOUS Frame (For Occlusion Reprojection)
-uniform uint u_MaxChunks;
+// Per-frame constants, must match FrameConstants in frame_constants.h (std140 layout)
+#define CULL_FLAG_OCCLUSION        1u
+#define CULL_FLAG_OCCLUDER_BOXES   2u  // u_DepthPyramid holds this frame's occluder boxes (test with u_ViewProjection)
+#define CULL_FLAG_PVS              4u
+#define CULL_FLAG_CLUSTERS         8u
+#define CULL_FLAG_DISTANCE_BUCKETS 16u
+
+layout(std140, binding = 0) uniform FrameConstants {
+    mat4 u_ViewProjection;      // CURRENT Frame (For Frustum Culling)
+    mat4 u_PrevViewProjection;  // PREVIOUS Frame (For Occlusion Reprojection)
+    vec4 u_FrustumPlanes[6];    // Left, Right, Bottom, Top, Near, Far of u_ViewProjection (0..1 depth)
+    vec3 u_CameraPos;           // Eye position, for the face-direction test
+    float u_BucketBaseDistance; // Width of distance bucket 0, each further one doubles
+    vec4 u_ProjParams;          // Projection[0][0], Projection[1][1], zNear, zFar
+    vec2 u_PyramidSize;         // Size of Mip 0
+    uint u_MaxChunks;
+    uint u_MaxOpaqueCommands;   // Size of outOpaque
+    uint u_CullFlags;           // CULL_FLAG_*
+    int u_DebugMode;
+};
 
-// Helper uniforms for Occlusion
+// Helper sampler for Occlusion
 uniform sampler2D u_DepthPyramid;
-uniform vec2 u_PyramidSize; // Size of Mip 0
-uniform float u_P00;        // Projection[0][0]
-uniform float u_P11;        // Projection[1][1]
-uniform float u_zNear;      // Camera Z Near
-uniform float u_zFar;       // Camera Z Far
-uniform bool u_OcclusionEnabled; 
+
+// Binding 5: Potentially Visible Set from the CPU connectivity walk (1 bit per chunk slot)
+layout(std430, binding = 5) readonly buffer PotentiallyVisibleSet {
+    uint pvsBits[];
+};
+
+// Binding 6: Meshlet records (ChunkMeshlet in chunk_meshlets.h), chunk-local bounds in 8 bits per axis
+struct MeshletGpuData {
+    uint firstVertex;   // Relative to firstVertexOpaque
+    uint vertexCount;
+    uint boundsMin;     // x | y << 8 | z << 16 | faceMask << 24
+    uint boundsMax;     // x | y << 8 | z << 16
+};
+layout(std430, binding = 6) readonly buffer MeshletBuffer {
+    MeshletGpuData allMeshlets[];
+};
+
+// Bindings 7/8: distance buckets (draw_buckets.h). outOpaque is then a scratch buffer that
+// DRAW_BUCKET_COMPACT.glsl reorders near to far using these.
+#define DRAW_DISTANCE_BUCKETS 8
+#define DRAW_BUCKET_KEY_SHIFT 28
+layout(std430, binding = 7) buffer DrawBucketCounts {
+    uint bucketCounts[DRAW_DISTANCE_BUCKETS];
+};
+layout(std430, binding = 8) writeonly buffer DrawBucketKeys {
+    uint commandKeys[];     // bucket << DRAW_BUCKET_KEY_SHIFT | index inside the bucket
+};
 
 // --- OUTPUTS ---
 struct DrawCommand {
@@ -64,29 +108,18 @@ layout(std430, binding = 3) writeonly buffer OutputDrawCommandsTrans {
 };
 
 layout(binding = 0, offset = 0) uniform atomic_uint u_VisibleCount;
+layout(binding = 0, offset = 4) uniform atomic_uint u_OpaqueCommandCount; // Draw count of outOpaque
+layout(binding = 0, offset = 8) uniform atomic_uint u_SplitCommandCount;  // Meshlet commands asked for beyond one per chunk
 
 // --- FRUSTUM LOGIC ---
+// Planes come precomputed in the frame constants (ExtractFrustumPlanes on the CPU)
 bool IsFrustumVisible(vec3 minPos, vec3 maxPos) {
-    mat4 M = transpose(u_ViewProjection);
-    vec4 planes[6];
-    planes[0] = M[3] + M[0]; // Left
-    planes[1] = M[3] - M[0]; // Right
-    planes[2] = M[3] + M[1]; // Bottom
-    planes[3] = M[3] - M[1]; // Top
-#ifdef ZERO_TO_ONE_DEPTH
-    planes[4] = M[2];        // Near (0 <= z)
-    planes[5] = M[3] - M[2]; // Far  (z <= w)
-#else
-    planes[4] = M[3] + M[2]; 
-    planes[5] = M[3] - M[2]; 
-#endif
-
     for(int i = 0; i < 6; i++) {
         vec3 p = minPos;
-        if(planes[i].x >= 0) p.x = maxPos.x;
-        if(planes[i].y >= 0) p.y = maxPos.y;
-        if(planes[i].z >= 0) p.z = maxPos.z;
-        if(dot(vec4(p, 1.0), planes[i]) < 0.0) return false;
+        if(u_FrustumPlanes[i].x >= 0) p.x = maxPos.x;
+        if(u_FrustumPlanes[i].y >= 0) p.y = maxPos.y;
+        if(u_FrustumPlanes[i].z >= 0) p.z = maxPos.z;
+        if(dot(vec4(p, 1.0), u_FrustumPlanes[i]) < 0.0) return false;
     }
     return true;
 }
@@ -161,6 +194,105 @@ bool IsOccluded(vec3 minAABB, vec3 maxAABB) {
     return maxZ < (furthestOccluder - smartEpsilon);
 }
 
+// --- BOX OCCLUDER LOGIC ---
+// The pyramid was rasterised from solid boxes with the CURRENT matrix, so there is no reprojection
+// error and the test can be exact: pick the mip where the footprint spans at most 2x2 texels and
+// take the furthest of those (texelFetch, no filtering). Anything nearer than all of them is hidden.
+bool IsOccludedByBoxes(vec3 minAABB, vec3 maxAABB) {
+    vec2 minUV = vec2(1.0);
+    vec2 maxUV = vec2(0.0);
+    float maxZ = 0.0; // Closest Z (Reverse-Z: 1.0 is near)
+
+    for (int i = 0; i < 8; i++) {
+        vec3 corner = vec3((i & 1) != 0 ? maxAABB.x : minAABB.x,
+                           (i & 2) != 0 ? maxAABB.y : minAABB.y,
+                           (i & 4) != 0 ? maxAABB.z : minAABB.z);
+        vec4 clipPos = u_ViewProjection * vec4(corner, 1.0);
+        if (clipPos.w < 0.001) return false; // Crosses the near plane
+
+        vec3 ndc = clipPos.xyz / clipPos.w;
+        if (ndc.z > 1.0) return false;
+
+        vec2 uv = ndc.xy * 0.5 + 0.5;
+        minUV = min(minUV, uv);
+        maxUV = max(maxUV, uv);
+        maxZ = max(maxZ, ndc.z);
+    }
+
+    minUV = clamp(minUV, 0.0, 1.0);
+    maxUV = clamp(maxUV, 0.0, 1.0);
+
+    vec2 dims = (maxUV - minUV) * u_PyramidSize;
+    int maxLevel = textureQueryLevels(u_DepthPyramid) - 1;
+    int lod = clamp(int(ceil(log2(max(max(dims.x, dims.y), 1.0)))), 0, maxLevel);
+
+    ivec2 levelSize = textureSize(u_DepthPyramid, lod);
+    ivec2 texMin = clamp(ivec2(minUV * vec2(levelSize)), ivec2(0), levelSize - 1);
+    ivec2 texMax = clamp(ivec2(maxUV * vec2(levelSize)), ivec2(0), levelSize - 1);
+
+    float furthestOccluder = 1.0;
+    for (int y = texMin.y; y <= texMax.y; y++) {
+        for (int x = texMin.x; x <= texMax.x; x++) {
+            furthestOccluder = min(furthestOccluder, texelFetch(u_DepthPyramid, ivec2(x, y), lod).r);
+        }
+    }
+
+    return maxZ < furthestOccluder;
+}
+
+// --- MESHLET LOGIC (same math as CullMeshletsReference in chunk_meshlets.h) ---
+vec3 UnpackBounds(uint packed) {
+    return vec3(float(packed & 0xFFu), float((packed >> 8) & 0xFFu), float((packed >> 16) & 0xFFu));
+}
+
+bool IsMeshletVisible(MeshletGpuData m, vec3 origin, float scale) {
+    vec3 minPos = origin + UnpackBounds(m.boundsMin) * scale;
+    vec3 maxPos = origin + UnpackBounds(m.boundsMax) * scale;
+
+    // Face directions that can face the camera: a +X face at x = p needs camera.x > p, etc.
+    uint front = 0u;
+    if (u_CameraPos.x > minPos.x) front |= 1u;
+    if (u_CameraPos.x < maxPos.x) front |= 2u;
+    if (u_CameraPos.y > minPos.y) front |= 4u;
+    if (u_CameraPos.y < maxPos.y) front |= 8u;
+    if (u_CameraPos.z > minPos.z) front |= 16u;
+    if (u_CameraPos.z < maxPos.z) front |= 32u;
+    if (((m.boundsMin >> 24) & front) == 0u) return false;
+
+    return IsFrustumVisible(minPos, maxPos);
+}
+
+// --- DISTANCE BUCKETS (same math as DistanceToBox / DistanceBucket in draw_buckets.h) ---
+uint DistanceBucket(vec3 minPos, vec3 maxPos) {
+    vec3 outside = max(max(minPos - u_CameraPos, u_CameraPos - maxPos), vec3(0.0));
+    float distance = length(outside);
+    if (distance < u_BucketBaseDistance) return 0u;
+    return min(uint(log2(distance / u_BucketBaseDistance)) + 1u, uint(DRAW_DISTANCE_BUCKETS - 1));
+}
+
+// outOpaque always has room for one command per visible chunk (u_MaxChunks of it), the rest is a
+// shared budget for splitting chunks into meshlet commands. A chunk reserves its whole split up front
+// and falls back to its single whole-range command if it doesn't fit, so nothing is ever dropped.
+bool ReserveSplit(uint extraCommands) {
+    if (extraCommands == 0u) return true;
+    uint used = atomicCounterAdd(u_SplitCommandCount, extraCommands);
+    return used + extraCommands <= u_MaxOpaqueCommands - u_MaxChunks;
+}
+
+void WriteOpaqueCommand(uint index, uint first, uint count, uint baseInstance, uint bucket) {
+    if ((u_CullFlags & CULL_FLAG_DISTANCE_BUCKETS) != 0u) {
+        uint local = atomicAdd(bucketCounts[bucket], 1u);
+        commandKeys[index] = (bucket << DRAW_BUCKET_KEY_SHIFT) | local;
+    }
+
+    DrawCommand cmd;
+    cmd.count = count;
+    cmd.instanceCount = 1;
+    cmd.first = first;
+    cmd.baseInstance = baseInstance;
+    outOpaque[index] = cmd;
+}
+
 void main() {
     uint idx = gl_GlobalInvocationID.x;
     if (idx >= u_MaxChunks) return;
@@ -170,10 +302,15 @@ void main() {
     // Optimization: Skip if both meshes are empty
     if (chunk.countOpaque == 0 && chunk.countTrans == 0) return;
 
-    if (IsFrustumVisible(chunk.minAABB_scale.xyz, chunk.maxAABB_pad.xyz)) {
+    // Cave/indoor culling: not reachable from the camera chunk through open faces
+    if ((u_CullFlags & CULL_FLAG_PVS) != 0u && (pvsBits[idx >> 5] & (1u << (idx & 31u))) == 0u) return;
+
+    if (IsFrustumVisible(chunk.minAABB_pad.xyz, chunk.maxAABB_pad.xyz)) {
         bool visible = true;
-        if (u_OcclusionEnabled) {
-             if (IsOccluded(chunk.minAABB_scale.xyz, chunk.maxAABB_pad.xyz)) {
+        if ((u_CullFlags & CULL_FLAG_OCCLUSION) != 0u) {
+             bool occluded = (u_CullFlags & CULL_FLAG_OCCLUDER_BOXES) != 0u ? IsOccludedByBoxes(chunk.minAABB_pad.xyz, chunk.maxAABB_pad.xyz)
+                                                  : IsOccluded(chunk.minAABB_pad.xyz, chunk.maxAABB_pad.xyz);
+             if (occluded) {
                  visible = false;
              }
         }
@@ -181,13 +318,33 @@ void main() {
         if (visible) {
             uint outIndex = atomicCounterIncrement(u_VisibleCount);
 
-            // 1. Write Opaque Command
-            DrawCommand cmdOpaque;
-            cmdOpaque.count = chunk.countOpaque;
-            cmdOpaque.instanceCount = 1;
-            cmdOpaque.first = chunk.firstVertexOpaque;
-            cmdOpaque.baseInstance = outIndex;
-            outOpaque[outIndex] = cmdOpaque;
+            // 1. Write Opaque Commands: one per visible meshlet, or the whole range
+            if (chunk.countOpaque > 0) {
+                uint bucket = (u_CullFlags & CULL_FLAG_DISTANCE_BUCKETS) != 0u ? DistanceBucket(chunk.minAABB_pad.xyz, chunk.maxAABB_pad.xyz) : 0u;
+                uint visibleMeshlets = 1u;
+                bool split = false;
+                if ((u_CullFlags & CULL_FLAG_CLUSTERS) != 0u && chunk.meshletCount > 0) {
+                    visibleMeshlets = 0u;
+                    for (uint i = 0u; i < chunk.meshletCount; i++) {
+                        if (IsMeshletVisible(allMeshlets[chunk.firstMeshlet + i], chunk.origin_scale.xyz, chunk.origin_scale.w)) visibleMeshlets++;
+                    }
+                    split = visibleMeshlets > 0u && ReserveSplit(visibleMeshlets - 1u);
+                }
+
+                if (split) {
+                    // Same test as the counting loop, so exactly visibleMeshlets commands are written
+                    uint index = atomicCounterAdd(u_OpaqueCommandCount, visibleMeshlets);
+                    uint end = index + visibleMeshlets;
+                    for (uint i = 0u; i < chunk.meshletCount && index < end; i++) {
+                        MeshletGpuData m = allMeshlets[chunk.firstMeshlet + i];
+                        if (IsMeshletVisible(m, chunk.origin_scale.xyz, chunk.origin_scale.w)) {
+                            WriteOpaqueCommand(index++, chunk.firstVertexOpaque + m.firstVertex, m.vertexCount, outIndex, bucket);
+                        }
+                    }
+                } else if (visibleMeshlets > 0u) {
+                    WriteOpaqueCommand(atomicCounterIncrement(u_OpaqueCommandCount), chunk.firstVertexOpaque, chunk.countOpaque, outIndex, bucket);
+                }
+            }
 
             // 2. Write Transparent Command
             // Uses the SAME baseInstance so it gets the SAME transform from Binding 2
@@ -199,7 +356,7 @@ void main() {
             outTrans[outIndex] = cmdTrans;
 
             // 3. Write Shared Transform
-            outChunkOffsets[outIndex] = vec4(chunk.minAABB_scale.xyz, chunk.minAABB_scale.w);
+            outChunkOffsets[outIndex] = vec4(chunk.origin_scale.xyz, chunk.origin_scale.w);
         }
     }
 }
\ No newline at end of file
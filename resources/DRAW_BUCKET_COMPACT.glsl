@@ -0,0 +1,58 @@
+#version 460 core
+layout(local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
+
+// Second half of the distance-bucketed opaque emission (see draw_buckets.h, BinDrawsReference).
+// CULL_COMPUTE.glsl wrote the opaque commands unsorted into a scratch buffer together with a key
+// (bucket, index inside the bucket) and per-bucket counts. Here every command moves to
+// start of its bucket + its index, so the MDI draws near buckets first.
+
+#define DRAW_DISTANCE_BUCKETS 8
+#define DRAW_BUCKET_KEY_SHIFT 28
+#define DRAW_BUCKET_LOCAL_MASK ((1u << DRAW_BUCKET_KEY_SHIFT) - 1u)
+
+struct DrawCommand {
+    uint count;
+    uint instanceCount;
+    uint first;
+    uint baseInstance;
+};
+
+// Binding 1: Scratch commands from the cull pass (emission order)
+layout(std430, binding = 1) readonly buffer ScratchCommands {
+    DrawCommand scratch[];
+};
+
+// Binding 7: Commands per bucket
+layout(std430, binding = 7) readonly buffer DrawBucketCounts {
+    uint bucketCounts[DRAW_DISTANCE_BUCKETS];
+};
+
+// Binding 8: bucket << DRAW_BUCKET_KEY_SHIFT | index inside the bucket, per scratch command
+layout(std430, binding = 8) readonly buffer DrawBucketKeys {
+    uint commandKeys[];
+};
+
+// Binding 9: The opaque indirect buffer the MDI reads
+layout(std430, binding = 9) writeonly buffer OutputDrawCommandsOpaque {
+    DrawCommand outOpaque[];
+};
+
+uniform uint u_MaxOpaqueCommands;
+
+void main() {
+    uint idx = gl_GlobalInvocationID.x;
+    if (idx >= u_MaxOpaqueCommands) return;
+
+    // Exclusive prefix of the counts. The sum is the number of accepted commands (every written command is keyed).
+    uint starts[DRAW_DISTANCE_BUCKETS];
+    uint total = 0u;
+    for (int b = 0; b < DRAW_DISTANCE_BUCKETS; b++) {
+        starts[b] = total;
+        total += bucketCounts[b];
+    }
+    if (idx >= total) return;
+
+    uint key = commandKeys[idx];
+    uint bucket = key >> DRAW_BUCKET_KEY_SHIFT;
+    outOpaque[starts[bucket] + (key & DRAW_BUCKET_LOCAL_MASK)] = scratch[idx];
+}
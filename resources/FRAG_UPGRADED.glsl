@@ -2,11 +2,21 @@
 
 // --- UNIFORMS ---
 uniform sampler2DArray u_Textures;
-uniform int u_DebugMode;           // 0=Default, 1=Normals, 2=AO, 3=UVs
 
-// NOTE: If you don't have this uniform yet, the fog will look static (won't move with player).
-// You can temp replace this with vec3(0.0) inside main() if needed.
-uniform vec3 u_CameraPos; 
+// Per-frame constants (u_CameraPos drives the fog), must match FrameConstants in frame_constants.h
+layout(std140, binding = 0) uniform FrameConstants {
+    mat4 u_ViewProjection;
+    mat4 u_PrevViewProjection;
+    vec4 u_FrustumPlanes[6];
+    vec3 u_CameraPos;
+    float u_BucketBaseDistance;
+    vec4 u_ProjParams;
+    vec2 u_PyramidSize;
+    uint u_MaxChunks;
+    uint u_MaxOpaqueCommands;
+    uint u_CullFlags;
+    int u_DebugMode;           // 0=Default, 1=Normals, 2=AO, 3=UVs
+};
 
 // --- INPUTS ---
 in vec3 v_Normal;
@@ -0,0 +1,8 @@
+#version 460 core
+
+// Writes the (reverse-Z) depth as a colour so HI_Z_DOWN.glsl can reduce it like the main depth copy
+layout(location = 0) out float o_Depth;
+
+void main() {
+    o_Depth = gl_FragCoord.z;
+}
@@ -0,0 +1,30 @@
+#version 460 core
+
+// Solid occluder boxes (OccluderBox in gpu_culler.h), one instance per box.
+// No VBO: the 36 vertices of the cube come from gl_VertexID, corner bits are x | y << 1 | z << 2.
+struct OccluderBox {
+    vec4 minPos;
+    vec4 maxPos;
+};
+
+layout(std430, binding = 7) readonly buffer OccluderBoxes {
+    OccluderBox boxes[];
+};
+
+uniform mat4 u_ViewProjection;
+
+const int CUBE_CORNERS[36] = int[](
+    0, 2, 6,  0, 6, 4,   // -X
+    1, 5, 7,  1, 7, 3,   // +X
+    0, 4, 5,  0, 5, 1,   // -Y
+    2, 3, 7,  2, 7, 6,   // +Y
+    0, 1, 3,  0, 3, 2,   // -Z
+    4, 6, 7,  4, 7, 5    // +Z
+);
+
+void main() {
+    OccluderBox box = boxes[gl_InstanceID];
+    int corner = CUBE_CORNERS[gl_VertexID];
+    vec3 t = vec3(corner & 1, (corner >> 1) & 1, (corner >> 2) & 1);
+    gl_Position = u_ViewProjection * vec4(mix(box.minPos.xyz, box.maxPos.xyz, t), 1.0);
+}
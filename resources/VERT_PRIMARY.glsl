@@ -1,5 +1,14 @@
 #version 460 core
 
+// PackedVertex layout, injected by Shader::AddGlobalDefine (defaults = 32^3 chunks)
+#ifndef PACKED_COORD_BITS
+#define PACKED_COORD_BITS 6
+#endif
+#define PACKED_NORM_SHIFT (PACKED_COORD_BITS * 3)
+#define PACKED_AO_SHIFT   (PACKED_NORM_SHIFT + 3)
+#define PACKED_TEX_SHIFT  (PACKED_AO_SHIFT + 2)
+#define PACKED_TEX_BITS   (32 - PACKED_TEX_SHIFT)
+
 // Binding 0: Packed Voxel Data (1x uint32 per vertex)
 layout (std430, binding = 0) readonly buffer VoxelData {
     uint packedVertices[];
@@ -37,14 +46,14 @@ void main() {
     uint data = packedVertices[gl_VertexID];
 
     // 2. Unpack Geometry
-    float x = float(bitfieldExtract(data, 0,  6));
-    float y = float(bitfieldExtract(data, 6,  6));
-    float z = float(bitfieldExtract(data, 12, 6));
+    float x = float(bitfieldExtract(data, 0,                     PACKED_COORD_BITS));
+    float y = float(bitfieldExtract(data, PACKED_COORD_BITS,     PACKED_COORD_BITS));
+    float z = float(bitfieldExtract(data, PACKED_COORD_BITS * 2, PACKED_COORD_BITS));
     
     // 3. Unpack Attributes
-    int normIndex = int(bitfieldExtract(data, 18, 3));
-    int aoVal     = int(bitfieldExtract(data, 21, 2));
-    int texID     = int(bitfieldExtract(data, 23, 9));
+    int normIndex = int(bitfieldExtract(data, PACKED_NORM_SHIFT, 3));
+    int aoVal     = int(bitfieldExtract(data, PACKED_AO_SHIFT,   2));
+    int texID     = int(bitfieldExtract(data, PACKED_TEX_SHIFT,  PACKED_TEX_BITS));
 
     vec3 localPos = vec3(x, y, z);
     vec3 normal = getCubeNormal(normIndex);
@@ -0,0 +1,217 @@
+#include "alloc_tracker.h"
+
+#if GOOSE_ALLOC_TRACKING
+
+#include <atomic>
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+namespace Engine {
+
+namespace {
+
+constexpr uint32_t TABLE_SIZE = 1024;          // Power of two
+constexpr uint32_t MAX_SCOPE_DEPTH = 32;
+constexpr unsigned THREAD_SHIFT = 48;          // Key = thread << 48 | scope pointer (user-space pointers fit 48 bits)
+const char* const NO_SCOPE = "(no scope)";
+const char* const OVERFLOW_SCOPE = "(table full)";
+
+struct AllocSlot {
+    std::atomic<uint64_t> key{ 0 };            // 0 = empty
+    std::atomic<uint64_t> allocs{ 0 };
+    std::atomic<uint64_t> bytes{ 0 };
+    std::atomic<uint64_t> frees{ 0 };
+};
+
+// Zero-initialised statics only: operator new runs before (and after) dynamic initialisation.
+AllocSlot g_slots[TABLE_SIZE];
+AllocSlot g_overflow;
+std::atomic<uint32_t> g_nextThreadIndex{ 1 };
+std::atomic<bool> g_tableFull{ false };
+
+thread_local uint32_t t_threadIndex = 0;
+thread_local const char* t_scopes[MAX_SCOPE_DEPTH];
+thread_local uint32_t t_scopeDepth = 0;
+thread_local bool t_suppressed = false;        // The tracker's own bookkeeping allocations
+
+// Main thread only (EndFrame)
+uint64_t g_lastAllocs[TABLE_SIZE];
+uint64_t g_lastBytes[TABLE_SIZE];
+uint64_t g_lastFrees[TABLE_SIZE];
+uint64_t g_lastOverflow[3];
+std::vector<AllocScopeStats>* g_frame = nullptr;
+uint64_t g_frameAllocs = 0;
+uint64_t g_frameBytes = 0;
+uint32_t g_mainThread = 0;
+
+uint32_t ThreadIndex() {
+    if (t_threadIndex == 0) t_threadIndex = g_nextThreadIndex.fetch_add(1, std::memory_order_relaxed);
+    return t_threadIndex;
+}
+
+AllocSlot& SlotFor(const char* scope) {
+    uint64_t key = ((uint64_t)ThreadIndex() << THREAD_SHIFT) | ((uint64_t)(uintptr_t)scope & ((1ull << THREAD_SHIFT) - 1));
+    uint64_t h = key * 0x9E3779B97F4A7C15ull;
+    uint32_t index = (uint32_t)(h >> 54) & (TABLE_SIZE - 1);
+
+    for (uint32_t probe = 0; probe < TABLE_SIZE; probe++) {
+        AllocSlot& slot = g_slots[(index + probe) & (TABLE_SIZE - 1)];
+        uint64_t current = slot.key.load(std::memory_order_acquire);
+        if (current == key) return slot;
+        if (current == 0) {
+            uint64_t expected = 0;
+            if (slot.key.compare_exchange_strong(expected, key, std::memory_order_acq_rel) || expected == key) return slot;
+        }
+    }
+    g_tableFull.store(true, std::memory_order_relaxed);
+    return g_overflow;
+}
+
+const char* CurrentScope() {
+    return t_scopeDepth == 0 ? NO_SCOPE : t_scopes[std::min(t_scopeDepth, MAX_SCOPE_DEPTH) - 1];
+}
+
+void RecordAlloc(size_t size) {
+    if (t_suppressed) return;
+    AllocSlot& slot = SlotFor(CurrentScope());
+    slot.allocs.fetch_add(1, std::memory_order_relaxed);
+    slot.bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+void RecordFree(void* ptr) {
+    if (!ptr || t_suppressed) return;
+    SlotFor(CurrentScope()).frees.fetch_add(1, std::memory_order_relaxed);
+}
+
+void* Allocate(size_t size) {
+    RecordAlloc(size);
+    return std::malloc(size ? size : 1);
+}
+
+void* AllocateAligned(size_t size, std::align_val_t alignment) {
+    RecordAlloc(size);
+    size_t align = std::max((size_t)alignment, sizeof(void*));
+#if defined(_WIN32)
+    return _aligned_malloc(size ? size : 1, align);
+#else
+    size_t rounded = ((size ? size : 1) + align - 1) / align * align; // aligned_alloc wants a multiple
+    return std::aligned_alloc(align, rounded);
+#endif
+}
+
+void Release(void* ptr) {
+    RecordFree(ptr);
+    std::free(ptr);
+}
+
+void ReleaseAligned(void* ptr) {
+    RecordFree(ptr);
+#if defined(_WIN32)
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+} // namespace
+
+void AllocTracker::PushScope(const char* name) {
+    if (t_scopeDepth < MAX_SCOPE_DEPTH) t_scopes[t_scopeDepth] = name;
+    t_scopeDepth++; // Past the limit allocations stay on the deepest stored scope
+}
+
+void AllocTracker::PopScope() {
+    if (t_scopeDepth > 0) t_scopeDepth--;
+}
+
+void AllocTracker::EndFrame() {
+    t_suppressed = true;
+    if (!g_frame) g_frame = new std::vector<AllocScopeStats>();
+    if (g_mainThread == 0) g_mainThread = ThreadIndex();
+
+    std::vector<AllocScopeStats>& frame = *g_frame;
+    frame.clear();
+    g_frameAllocs = 0;
+    g_frameBytes = 0;
+
+    auto latch = [&](AllocSlot& slot, const char* scope, uint32_t thread, uint64_t& lastAllocs, uint64_t& lastBytes, uint64_t& lastFrees) {
+        uint64_t allocs = slot.allocs.load(std::memory_order_relaxed);
+        uint64_t bytes = slot.bytes.load(std::memory_order_relaxed);
+        uint64_t frees = slot.frees.load(std::memory_order_relaxed);
+        AllocScopeStats stats = { scope, thread, allocs - lastAllocs, bytes - lastBytes, frees - lastFrees };
+        lastAllocs = allocs;
+        lastBytes = bytes;
+        lastFrees = frees;
+        if (stats.allocs == 0 && stats.frees == 0) return;
+        g_frameAllocs += stats.allocs;
+        g_frameBytes += stats.bytes;
+        frame.push_back(stats);
+    };
+
+    for (uint32_t i = 0; i < TABLE_SIZE; i++) {
+        uint64_t key = g_slots[i].key.load(std::memory_order_acquire);
+        if (key == 0) continue;
+        const char* scope = (const char*)(uintptr_t)(key & ((1ull << THREAD_SHIFT) - 1));
+        latch(g_slots[i], scope, (uint32_t)(key >> THREAD_SHIFT), g_lastAllocs[i], g_lastBytes[i], g_lastFrees[i]);
+    }
+    latch(g_overflow, OVERFLOW_SCOPE, 0, g_lastOverflow[0], g_lastOverflow[1], g_lastOverflow[2]);
+
+    std::sort(frame.begin(), frame.end(), [](const AllocScopeStats& a, const AllocScopeStats& b) { return a.allocs > b.allocs; });
+    t_suppressed = false;
+}
+
+const std::vector<AllocScopeStats>& AllocTracker::GetLastFrame() {
+    static const std::vector<AllocScopeStats> empty;
+    return g_frame ? *g_frame : empty;
+}
+
+uint64_t AllocTracker::GetLastFrameAllocs() { return g_frameAllocs; }
+uint64_t AllocTracker::GetLastFrameBytes() { return g_frameBytes; }
+uint32_t AllocTracker::GetMainThreadIndex() { return g_mainThread; }
+bool AllocTracker::IsTableFull() { return g_tableFull.load(std::memory_order_relaxed); }
+
+} // namespace Engine
+
+// ------------------------------------------------------------------------------------------------
+// Global replacements
+// ------------------------------------------------------------------------------------------------
+void* operator new(std::size_t size) {
+    void* ptr = Engine::Allocate(size);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](std::size_t size) {
+    void* ptr = Engine::Allocate(size);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return Engine::Allocate(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return Engine::Allocate(size); }
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    void* ptr = Engine::AllocateAligned(size, alignment);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    void* ptr = Engine::AllocateAligned(size, alignment);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept { Engine::Release(ptr); }
+void operator delete[](void* ptr) noexcept { Engine::Release(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { Engine::Release(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { Engine::Release(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { Engine::Release(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { Engine::Release(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { Engine::ReleaseAligned(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { Engine::ReleaseAligned(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { Engine::ReleaseAligned(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { Engine::ReleaseAligned(ptr); }
+
+#endif // GOOSE_ALLOC_TRACKING
@@ -1,7 +1,7 @@
 #include "gpu_culler.h"
 #include "shader.h"
+#include "logger.h"
 
-#include <iostream>
 #include <cmath>
 #include <algorithm> 
 #include <glm/gtc/type_ptr.hpp>
@@ -14,7 +14,7 @@ struct DrawArraysIndirectCommand {
     uint32_t baseInstance;  
 };
 
-GpuCuller::GpuCuller(size_t maxChunks) : m_maxChunks(maxChunks) {
+GpuCuller::GpuCuller(size_t maxChunks) : m_maxChunks(maxChunks), m_maxOpaqueCommands(maxChunks * OPAQUE_COMMANDS_PER_CHUNK) {
     InitBuffers();
     
     // Fill the free slots stack (descending order so we use slot 0 first)
@@ -24,6 +24,9 @@ GpuCuller::GpuCuller(size_t maxChunks) : m_maxChunks(maxChunks) {
 
     m_cullShader = std::make_unique<Shader>("./resources/CULL_COMPUTE.glsl");
     m_hizShader = std::make_unique<Shader>("./resources/HI_Z_DOWN.glsl");
+    m_occluderShader = std::make_unique<Shader>("./resources/OCCLUDER_VERT.glsl", "./resources/OCCLUDER_FRAG.glsl");
+    m_bucketCompactShader = std::make_unique<Shader>("./resources/DRAW_BUCKET_COMPACT.glsl");
+    InitOccluderTarget();
 
     glCreateSamplers(1, &m_depthSampler);
     glSamplerParameteri(m_depthSampler, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_NEAREST);
@@ -39,7 +42,16 @@ GpuCuller::~GpuCuller() {
     if (m_visibleChunkBuffer)  glDeleteBuffers(1, &m_visibleChunkBuffer);
     if (m_atomicCounterBuffer) glDeleteBuffers(1, &m_atomicCounterBuffer);
     if (m_resultBuffer)        glDeleteBuffers(1, &m_resultBuffer);
+    if (m_pvsBuffer)           glDeleteBuffers(1, &m_pvsBuffer);
+    if (m_scratchOpaque)       glDeleteBuffers(1, &m_scratchOpaque);
+    if (m_bucketKeyBuffer)     glDeleteBuffers(1, &m_bucketKeyBuffer);
+    if (m_bucketCountBuffer)   glDeleteBuffers(1, &m_bucketCountBuffer);
     if (m_depthSampler)        glDeleteSamplers(1, &m_depthSampler);
+    if (m_occluderBoxBuffer)   glDeleteBuffers(1, &m_occluderBoxBuffer);
+    if (m_occluderFbo)         glDeleteFramebuffers(1, &m_occluderFbo);
+    if (m_occluderDepthTex)    glDeleteTextures(1, &m_occluderDepthTex);
+    if (m_occluderDepthRbo)    glDeleteRenderbuffers(1, &m_occluderDepthRbo);
+    if (m_occluderVao)         glDeleteVertexArrays(1, &m_occluderVao);
     if (m_fence)               glDeleteSync(m_fence);
 }
 
@@ -48,9 +60,9 @@ void GpuCuller::InitBuffers() {
     glCreateBuffers(1, &m_globalChunkBuffer);
     glNamedBufferStorage(m_globalChunkBuffer, m_maxChunks * sizeof(ChunkGpuData), nullptr, GL_DYNAMIC_STORAGE_BIT);
 
-    // 2a. Indirect Draw Command Buffer (Output - Opaque)
+    // 2a. Indirect Draw Command Buffer (Output - Opaque, one command per visible meshlet)
     glCreateBuffers(1, &m_indirectBufferOpaque);
-    glNamedBufferStorage(m_indirectBufferOpaque, m_maxChunks * sizeof(DrawArraysIndirectCommand), nullptr, 0);
+    glNamedBufferStorage(m_indirectBufferOpaque, m_maxOpaqueCommands * sizeof(DrawArraysIndirectCommand), nullptr, 0);
 
     // 2b. Indirect Draw Command Buffer (Output - Transparent)
     glCreateBuffers(1, &m_indirectBufferTrans);
@@ -60,26 +72,72 @@ void GpuCuller::InitBuffers() {
     glCreateBuffers(1, &m_visibleChunkBuffer);
     glNamedBufferStorage(m_visibleChunkBuffer, m_maxChunks * sizeof(glm::vec4), nullptr, 0);
 
-    // 4. Atomic Counter (Output)
+    // 4. Atomic Counters (Output): visible chunks, opaque commands, meshlet split requests
     glCreateBuffers(1, &m_atomicCounterBuffer);
-    glNamedBufferStorage(m_atomicCounterBuffer, sizeof(GLuint), nullptr, GL_DYNAMIC_STORAGE_BIT);
+    glNamedBufferStorage(m_atomicCounterBuffer, 3 * sizeof(GLuint), nullptr, GL_DYNAMIC_STORAGE_BIT);
 
-    // 5. Result Buffer (CPU Readback)
+    // 5. Result Buffer (CPU Readback): the three counters, then the bucket counts
     glCreateBuffers(1, &m_resultBuffer);
-    glNamedBufferStorage(m_resultBuffer, sizeof(GLuint), nullptr, GL_DYNAMIC_STORAGE_BIT);
+    glNamedBufferStorage(m_resultBuffer, (3 + DRAW_DISTANCE_BUCKETS) * sizeof(GLuint), nullptr, GL_DYNAMIC_STORAGE_BIT);
     
-    uint32_t zero = 0;
-    glNamedBufferSubData(m_resultBuffer, 0, sizeof(GLuint), &zero);
+    uint32_t zero[3 + DRAW_DISTANCE_BUCKETS] = {};
+    glNamedBufferSubData(m_resultBuffer, 0, sizeof(zero), zero);
+
+    // 6. Potentially Visible Set (Input, 1 bit per slot)
+    size_t pvsWords = (m_maxChunks + 31) / 32;
+    m_lodZeroSlotBits.assign(pvsWords, 0u);
+    m_pvsBits.assign(pvsWords, ~0u);
+    glCreateBuffers(1, &m_pvsBuffer);
+    glNamedBufferStorage(m_pvsBuffer, pvsWords * sizeof(uint32_t), m_pvsBits.data(), GL_DYNAMIC_STORAGE_BIT);
+
+    // 7. Distance buckets: unsorted commands + their keys, compacted into the opaque buffer after the cull
+    glCreateBuffers(1, &m_scratchOpaque);
+    glNamedBufferStorage(m_scratchOpaque, m_maxOpaqueCommands * sizeof(DrawArraysIndirectCommand), nullptr, 0);
+    glCreateBuffers(1, &m_bucketKeyBuffer);
+    glNamedBufferStorage(m_bucketKeyBuffer, m_maxOpaqueCommands * sizeof(GLuint), nullptr, 0);
+    glCreateBuffers(1, &m_bucketCountBuffer);
+    glNamedBufferStorage(m_bucketCountBuffer, DRAW_DISTANCE_BUCKETS * sizeof(GLuint), nullptr, GL_DYNAMIC_STORAGE_BIT);
+}
+
+void GpuCuller::InitOccluderTarget() {
+    glCreateBuffers(1, &m_occluderBoxBuffer);
+    glNamedBufferStorage(m_occluderBoxBuffer, MAX_OCCLUDER_BOXES * sizeof(OccluderBox), nullptr, GL_DYNAMIC_STORAGE_BIT);
+
+    int levels = 1 + (int)floor(log2(std::max(OCCLUDER_TARGET_WIDTH, OCCLUDER_TARGET_HEIGHT)));
+    glCreateTextures(GL_TEXTURE_2D, 1, &m_occluderDepthTex);
+    glTextureStorage2D(m_occluderDepthTex, levels, GL_R32F, OCCLUDER_TARGET_WIDTH, OCCLUDER_TARGET_HEIGHT);
+
+    glCreateRenderbuffers(1, &m_occluderDepthRbo);
+    glNamedRenderbufferStorage(m_occluderDepthRbo, GL_DEPTH_COMPONENT32F, OCCLUDER_TARGET_WIDTH, OCCLUDER_TARGET_HEIGHT);
+
+    glCreateVertexArrays(1, &m_occluderVao); // Empty, the vertex shader builds the boxes
+
+    glCreateFramebuffers(1, &m_occluderFbo);
+    glNamedFramebufferTexture(m_occluderFbo, GL_COLOR_ATTACHMENT0, m_occluderDepthTex, 0);
+    glNamedFramebufferRenderbuffer(m_occluderFbo, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, m_occluderDepthRbo);
+
+    if (glCheckNamedFramebufferStatus(m_occluderFbo, GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        GOOSE_LOG_ERROR("GpuCuller", "Occluder framebuffer incomplete, box occluders disabled.");
+        m_settings.boxOccluders = false;
+    }
+}
+
+// LOD lives in the top 3 bits of the chunk key (see ChunkKey in chunkNode.h)
+static bool IsLodZeroKey(int64_t chunkID) {
+    return ((uint64_t)chunkID >> 61) == 0;
 }
 
 uint32_t GpuCuller::AddOrUpdateChunk(int64_t chunkID, 
+                                     const glm::vec3& origin,
                                      const glm::vec3& minAABB, 
                                      const glm::vec3& maxAABB, 
                                      float scale, 
                                      size_t firstVertexOpaque, 
                                      size_t vertexCountOpaque, 
                                      size_t firstVertexTrans, 
-                                     size_t vertexCountTrans) 
+                                     size_t vertexCountTrans,
+                                     size_t firstMeshlet,
+                                     size_t meshletCount) 
 {
     uint32_t slot;
     auto it = m_chunkSlots.find(chunkID);
@@ -88,7 +146,7 @@ uint32_t GpuCuller::AddOrUpdateChunk(int64_t chunkID,
         slot = it->second;
     } else {
         if (m_freeSlots.empty()) {
-            std::cerr << "[GpuCuller] Error: No free slots available for new chunk!" << std::endl;
+            GOOSE_LOG_ERROR("GpuCuller", "No free slots available for new chunk!"); // Once per chunk while full, rate limited
             return 0; 
         }
         slot = m_freeSlots.top();
@@ -96,14 +154,21 @@ uint32_t GpuCuller::AddOrUpdateChunk(int64_t chunkID,
         m_chunkSlots[chunkID] = slot;
     }
 
+    if (IsLodZeroKey(chunkID)) m_lodZeroSlotBits[slot >> 5] |= (1u << (slot & 31));
+    else                       m_lodZeroSlotBits[slot >> 5] &= ~(1u << (slot & 31));
+
     ChunkGpuData data;
-    data.minAABB_scale = glm::vec4(minAABB, scale);
+    data.origin_scale  = glm::vec4(origin, scale);
+    data.minAABB_pad   = glm::vec4(minAABB, 0.0f);
     data.maxAABB_pad   = glm::vec4(maxAABB, 0.0f);
     
     data.firstVertexOpaque = (uint32_t)firstVertexOpaque;
     data.vertexCountOpaque = (uint32_t)vertexCountOpaque;
     data.firstVertexTrans  = (uint32_t)firstVertexTrans;
     data.vertexCountTrans  = (uint32_t)vertexCountTrans;
+    data.firstMeshlet      = (uint32_t)firstMeshlet;
+    data.meshletCount      = (uint32_t)meshletCount;
+    data.pad0 = data.pad1 = 0;
 
     glNamedBufferSubData(m_globalChunkBuffer, slot * sizeof(ChunkGpuData), sizeof(ChunkGpuData), &data);
     
@@ -117,15 +182,89 @@ void GpuCuller::RemoveChunk(int64_t chunkID) {
     uint32_t slot = it->second;
     m_chunkSlots.erase(it);
     m_freeSlots.push(slot);
+    m_lodZeroSlotBits[slot >> 5] &= ~(1u << (slot & 31));
 
     ChunkGpuData zeroData = {}; 
     glNamedBufferSubData(m_globalChunkBuffer, slot * sizeof(ChunkGpuData), sizeof(ChunkGpuData), &zeroData);
 }
 
+void GpuCuller::SetPotentiallyVisibleSet(const std::vector<int64_t>& visibleChunkIDs) {
+    // Everything that isn't LOD 0 stays visible, LOD 0 slots start hidden
+    for (size_t i = 0; i < m_pvsBits.size(); ++i) {
+        m_pvsBits[i] = ~m_lodZeroSlotBits[i];
+    }
+
+    for (int64_t id : visibleChunkIDs) {
+        auto it = m_chunkSlots.find(id);
+        if (it == m_chunkSlots.end()) continue;
+        uint32_t slot = it->second;
+        m_pvsBits[slot >> 5] |= (1u << (slot & 31));
+    }
+
+    glNamedBufferSubData(m_pvsBuffer, 0, m_pvsBits.size() * sizeof(uint32_t), m_pvsBits.data());
+    m_pvsActive = true;
+}
+
 void GpuCuller::GenerateHiZ(GLuint depthTexture, int width, int height) {
     m_depthPyramidWidth = width;
     m_depthPyramidHeight = height;
+    DownsampleDepthPyramid(depthTexture, width, height);
+}
+
+void GpuCuller::RenderOccluders(const std::vector<OccluderBox>& boxes, const glm::mat4& viewProj) {
+    m_occluderCount = (uint32_t)std::min(boxes.size(), MAX_OCCLUDER_BOXES);
+    if (!m_settings.boxOccluders) {
+        m_occludersReady = false;
+        return;
+    }
+    if (m_occluderCount > 0) {
+        glNamedBufferSubData(m_occluderBoxBuffer, 0, m_occluderCount * sizeof(OccluderBox), boxes.data());
+    }
 
+    // Save what the main pass has bound, this runs in the middle of it
+    GLint prevFbo = 0, prevDepthFunc = GL_GREATER;
+    GLint prevViewport[4];
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &prevFbo);
+    glGetIntegerv(GL_VIEWPORT, prevViewport);
+    glGetIntegerv(GL_DEPTH_FUNC, &prevDepthFunc);
+    GLboolean cullFace = glIsEnabled(GL_CULL_FACE);
+    GLboolean depthTest = glIsEnabled(GL_DEPTH_TEST);
+
+    // Reverse-Z: 0 is the far plane, so "nothing here" clears to 0 and nearer boxes win with GL_GREATER
+    const float farDepth[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    const float clearDepth = 0.0f;
+    glClearNamedFramebufferfv(m_occluderFbo, GL_COLOR, 0, farDepth);
+    glClearNamedFramebufferfv(m_occluderFbo, GL_DEPTH, 0, &clearDepth);
+
+    if (m_occluderCount > 0) {
+        glBindFramebuffer(GL_FRAMEBUFFER, m_occluderFbo);
+        glViewport(0, 0, OCCLUDER_TARGET_WIDTH, OCCLUDER_TARGET_HEIGHT);
+        glEnable(GL_DEPTH_TEST);
+        glDepthFunc(GL_GREATER);
+        glDepthMask(GL_TRUE);
+        glDisable(GL_CULL_FACE); // Winding doesn't matter, only the nearest surface
+
+        m_occluderShader->use();
+        m_occluderShader->setMat4("u_ViewProjection", glm::value_ptr(viewProj));
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 7, m_occluderBoxBuffer);
+        glBindVertexArray(m_occluderVao);
+
+        // 36 vertices per box generated from gl_VertexID, one instance per box
+        glDrawArraysInstanced(GL_TRIANGLES, 0, 36, (GLsizei)m_occluderCount);
+
+        glBindFramebuffer(GL_FRAMEBUFFER, (GLuint)prevFbo);
+        glViewport(prevViewport[0], prevViewport[1], prevViewport[2], prevViewport[3]);
+        glDepthFunc((GLenum)prevDepthFunc);
+        if (cullFace) glEnable(GL_CULL_FACE);
+        if (!depthTest) glDisable(GL_DEPTH_TEST);
+    }
+
+    glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT | GL_TEXTURE_FETCH_BARRIER_BIT);
+    DownsampleDepthPyramid(m_occluderDepthTex, OCCLUDER_TARGET_WIDTH, OCCLUDER_TARGET_HEIGHT);
+    m_occludersReady = true;
+}
+
+void GpuCuller::DownsampleDepthPyramid(GLuint depthTexture, int width, int height) {
     int numLevels = 1 + (int)floor(log2(std::max(width, height)));
     m_hizShader->use();
     
@@ -153,53 +292,101 @@ void GpuCuller::GenerateHiZ(GLuint depthTexture, int width, int height) {
     }
 }
 
-void GpuCuller::Cull(const glm::mat4& viewProj, const glm::mat4& prevViewProj, const glm::mat4& proj, GLuint depthTexture) {
+void GpuCuller::Cull(FrameConstantsBuffer& frame, GLuint depthTexture) {
     if (m_fence) {
         GLenum waitReturn = glClientWaitSync(m_fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
         if (waitReturn == GL_ALREADY_SIGNALED || waitReturn == GL_CONDITION_SATISFIED) {
-            glGetNamedBufferSubData(m_resultBuffer, 0, sizeof(GLuint), &m_drawnCount);
+            GLuint counts[3 + DRAW_DISTANCE_BUCKETS];
+            glGetNamedBufferSubData(m_resultBuffer, 0, sizeof(counts), counts);
+            m_drawnCount = counts[0];
+            m_opaqueCommandCount = counts[1];
+            m_splitCommandCount = counts[2];
+            std::copy(counts + 3, counts + 3 + DRAW_DISTANCE_BUCKETS, m_bucketCounts);
             glDeleteSync(m_fence);
             m_fence = nullptr;
         }
     }
     
-    uint32_t zero = 0;
-    glNamedBufferSubData(m_atomicCounterBuffer, 0, sizeof(GLuint), &zero);
+    uint32_t zero[DRAW_DISTANCE_BUCKETS] = {};
+    glNamedBufferSubData(m_atomicCounterBuffer, 0, 3 * sizeof(GLuint), zero);
+    bool distanceBuckets = m_settings.distanceBuckets;
+    if (distanceBuckets) glNamedBufferSubData(m_bucketCountBuffer, 0, sizeof(zero), zero);
+
+    FrameConstants& constants = frame.Data();
+    constants.maxChunks = (uint32_t)m_maxChunks;
+    constants.maxOpaqueCommands = (uint32_t)m_maxOpaqueCommands;
+    constants.projParams.z = m_settings.zNear;
+    constants.projParams.w = m_settings.zFar;
+    constants.bucketBaseDistance = std::max(m_settings.bucketBaseDistance, 1.0f);
+    constants.pyramidSize = glm::vec2(0.0f);
+    uint32_t flags = 0;
 
     m_cullShader->use();
-    m_cullShader->setMat4("u_ViewProjection", glm::value_ptr(viewProj));
-    m_cullShader->setMat4("u_PrevViewProjection", glm::value_ptr(prevViewProj));
-    m_cullShader->setUInt("u_MaxChunks", (uint32_t)m_maxChunks);
-    
-    m_cullShader->setFloat("u_P00", proj[0][0]);
-    m_cullShader->setFloat("u_P11", proj[1][1]);
-    m_cullShader->setFloat("u_zNear", m_settings.zNear);
-    m_cullShader->setFloat("u_zFar", m_settings.zFar);
-    
+
+    // Box occluders are this frame's and always safe. The reprojected depth needs a previous frame that drew something.
+    bool boxOcclusion = m_settings.occlusionEnabled && m_settings.boxOccluders && m_occludersReady;
     bool occlusionActive = m_settings.occlusionEnabled && depthTexture != 0 && m_depthPyramidWidth > 0 && m_drawnCount > 0;
+    m_occludersReady = false;
+    if (!boxOcclusion) m_occluderCount = 0;
 
-    if (occlusionActive) {
+    if (boxOcclusion) {
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, m_occluderDepthTex);
+        glBindSampler(0, 0); // texelFetch only
+        m_cullShader->setInt("u_DepthPyramid", 0);
+        constants.pyramidSize = glm::vec2(OCCLUDER_TARGET_WIDTH, OCCLUDER_TARGET_HEIGHT);
+        flags |= CULL_FLAG_OCCLUSION | CULL_FLAG_OCCLUDER_BOXES;
+    } else if (occlusionActive) {
         glActiveTexture(GL_TEXTURE0);
         glBindTexture(GL_TEXTURE_2D, depthTexture);
         glBindSampler(0, m_depthSampler); 
         m_cullShader->setInt("u_DepthPyramid", 0);
-        m_cullShader->setVec2("u_PyramidSize", glm::vec2(m_depthPyramidWidth, m_depthPyramidHeight));
-        m_cullShader->setBool("u_OcclusionEnabled", true);
-    } else {
-        m_cullShader->setBool("u_OcclusionEnabled", false);
+        constants.pyramidSize = glm::vec2(m_depthPyramidWidth, m_depthPyramidHeight);
+        flags |= CULL_FLAG_OCCLUSION;
     }
 
+    if (m_settings.caveCullingEnabled && m_pvsActive) flags |= CULL_FLAG_PVS;
+    if (m_settings.clusterCullingEnabled && m_meshletBuffer != 0) flags |= CULL_FLAG_CLUSTERS;
+    if (distanceBuckets) flags |= CULL_FLAG_DISTANCE_BUCKETS;
+    constants.cullFlags = flags;
+
+    // One upload per frame, the world draw reads the same block
+    frame.Upload();
+
     // MATCH THESE NUMBERS TO SHADER FILE BUFFERS
     glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 4, m_globalChunkBuffer); 
     
-    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, m_indirectBufferOpaque);      
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, distanceBuckets ? m_scratchOpaque : m_indirectBufferOpaque);      
     glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, m_visibleChunkBuffer);  
     glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, m_indirectBufferTrans); 
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 5, m_pvsBuffer);
+    if (m_meshletBuffer) glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 6, m_meshletBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 7, m_bucketCountBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 8, m_bucketKeyBuffer);
     glBindBufferBase(GL_ATOMIC_COUNTER_BUFFER, 0, m_atomicCounterBuffer); 
 
     glDispatchCompute((GLuint)(m_maxChunks + 63) / 64, 1, 1);
-    glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT | GL_ATOMIC_COUNTER_BARRIER_BIT);
-    glCopyNamedBufferSubData(m_atomicCounterBuffer, m_resultBuffer, 0, 0, sizeof(GLuint));
+
+    if (distanceBuckets) {
+        // Scatter the scratch commands near to far into the real opaque buffer (see draw_buckets.h)
+        glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+        m_bucketCompactShader->use();
+        m_bucketCompactShader->setUInt("u_MaxOpaqueCommands", (uint32_t)m_maxOpaqueCommands);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, m_scratchOpaque);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 7, m_bucketCountBuffer);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 8, m_bucketKeyBuffer);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 9, m_indirectBufferOpaque);
+        glDispatchCompute((GLuint)(m_maxOpaqueCommands + 63) / 64, 1, 1);
+    }
+
+    glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT | GL_ATOMIC_COUNTER_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT);
+    glCopyNamedBufferSubData(m_atomicCounterBuffer, m_resultBuffer, 0, 0, 3 * sizeof(GLuint));
+    if (distanceBuckets) {
+        glCopyNamedBufferSubData(m_bucketCountBuffer, m_resultBuffer, 0, 3 * sizeof(GLuint), DRAW_DISTANCE_BUCKETS * sizeof(GLuint));
+    } else {
+        std::fill(m_bucketCounts, m_bucketCounts + DRAW_DISTANCE_BUCKETS, 0u);
+        glNamedBufferSubData(m_resultBuffer, 3 * sizeof(GLuint), DRAW_DISTANCE_BUCKETS * sizeof(GLuint), zero);
+    }
 
     if (m_fence) glDeleteSync(m_fence); 
     m_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
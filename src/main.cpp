@@ -21,6 +21,8 @@
 #include "shader.h"
 #include "ImGuiManager.hpp"
 #include "profiler.h"
+#include "metrics.h"
+#include "logger.h"
 #include "screen_quad.h"
 #include "splash_screen.hpp"
 #include "texture_manager.h"
@@ -52,6 +54,21 @@ const unsigned int SCR_WIDTH = 1920;
 const unsigned int SCR_HEIGHT = 1080;
 const bool START_FULLSCREEN = true; 
 
+// Warm start: block the splash until this many LOD 0 chunks around spawn (XZ radius) are ACTIVE
+const int WARM_START_RADIUS_CHUNKS = 4;
+const float WARM_START_TIMEOUT_SECONDS = 20.0f;
+
+// Metrics registry snapshots, one JSON line per interval (0 = off, the metrics are still kept)
+const char* METRICS_SNAPSHOT_PATH = "metrics.jsonl";
+const float METRICS_SNAPSHOT_INTERVAL_SECONDS = 10.0f;
+
+// Flight recorder: frames longer than this dump the preceding window as a Chrome trace (hitch_*.json)
+const float HITCH_THRESHOLD_MS = 100.0f;
+const float HITCH_WINDOW_SECONDS = 3.0f;
+
+// Structured copy of the console log (time, level, thread), appended per session
+const char* LOG_FILE_PATH = "goose.log";
+
 //static const uint16_t GLOBAL_VRAM_ALLOC_SIZE_MB = 1024 * 2;
 
 // Camera 
@@ -188,7 +205,7 @@ void processInput(GLFWwindow *window, World& world) {
     if (Input::IsJustPressed(window, GLFW_KEY_O)) {
         bool current = world.GetLODFreeze();
         world.SetLODFreeze(!current);
-        std::cout << "[DEBUG] LOD Freeze: " << (!current ? "ON" : "OFF") << std::endl;
+        GOOSE_LOG_DEBUG("DEBUG", "LOD Freeze: " << (!current ? "ON" : "OFF"));
     }
 
 
@@ -260,6 +277,8 @@ void processInput(GLFWwindow *window, World& world) {
 // ======================================================================================
 
 int main() {
+    Engine::Logger::Get().OpenFile(LOG_FILE_PATH);
+
     /////////////////// ******* Initialize GLFW ********* /////////
     glfwInit();
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
@@ -318,7 +337,7 @@ int main() {
     if (curScrWidth > 0 && curScrHeight > 0) {
         g_fbo.Resize(curScrWidth, curScrHeight);
     } else {
-        std::cout << "[Main] Warning: Initial window size is 0x0. Deferring FBO creation." << std::endl;
+        GOOSE_LOG_WARN("Main", "Initial window size is 0x0. Deferring FBO creation.");
     }
     
     // NOTE: g_fbo is assumed to be an external global. 
@@ -338,18 +357,6 @@ int main() {
     // World & Resources Scope
    try { 
 
-        ////// ************* SHADERS *********** //////////
-        // shader for world and then shader that helped me debug depth buffer
-        Shader worldShader("./resources/VERT_UPGRADED.glsl", "./resources/FRAG_UPGRADED.glsl");
-        //Shader worldShader("./resources/VERT_PRIMARY.glsl", "./resources/FRAG_PRIMARY.glsl");
-        Shader depthDebug("./resources/debug_quad_vert.glsl", "./resources/debug_quad_frag.glsl"); // press F3 to see depth buffer
-
-        Shader chunkDebugShader("./resources/shaders/chunkDebugVert.glsl", "./resources/shaders/chunkDebugFrag.glsl");
-        Shader selectionShader("./resources/shaders/cubeSelectionVert.glsl", "./resources/shaders/cubeSelectionFrag.glsl");;
-        ////// ************* SHADERS *********** //////////
-
-
-
         // --- World Configuration --- //
         EngineConfig globalConfig; // GLOBAL CONFIG overwrites the engine config sent into world
         //globalConfig.VRAM_HEAP_ALLOCATION_MB = GLOBAL_VRAM_ALLOC_SIZE_MB; // *********************************** VRAM STATIC ALLOCATION 
@@ -361,13 +368,33 @@ int main() {
 
         ////////////// *********** create our start terrain generator by choosing which class we send in
         auto defaultTerrainGenerator = std::make_unique<AdvancedGenerator>(); // seed input
-        // Ask the generator what textures it needs
+        // Ask the generator what textures it needs (before World takes ownership)
         std::vector<std::string> texturePaths = defaultTerrainGenerator->GetTexturePaths();
-        // Load them into GPU
-        GLuint texArray = TextureManager::LoadTextureArray(texturePaths);
         World world(globalConfig, std::move(defaultTerrainGenerator));
         ////////////// *********** create our start terrain generator by choosing which class we send in
 
+        // Warm start: worker threads generate the spawn area while we compile shaders and load textures below
+        world.BeginWarmStart(player.camera.Position);
+
+
+
+        ////// ************* SHADERS *********** //////////
+        // PackedVertex bit layout depends on CHUNK_SIZE, tell GLSL before anything compiles
+        Shader::AddGlobalDefine("PACKED_COORD_BITS", (int)PACKED_COORD_BITS);
+
+        // shader for world and then shader that helped me debug depth buffer
+        Shader worldShader("./resources/VERT_UPGRADED.glsl", "./resources/FRAG_UPGRADED.glsl");
+        //Shader worldShader("./resources/VERT_PRIMARY.glsl", "./resources/FRAG_PRIMARY.glsl");
+        Shader depthDebug("./resources/debug_quad_vert.glsl", "./resources/debug_quad_frag.glsl"); // press F3 to see depth buffer
+
+        Shader chunkDebugShader("./resources/shaders/chunkDebugVert.glsl", "./resources/shaders/chunkDebugFrag.glsl");
+        Shader selectionShader("./resources/shaders/cubeSelectionVert.glsl", "./resources/shaders/cubeSelectionFrag.glsl");;
+        ////// ************* SHADERS *********** //////////
+
+
+        // Load block textures into GPU
+        GLuint texArray = TextureManager::LoadTextureArray(texturePaths);
+
 
 
         // *********** 
@@ -382,6 +409,15 @@ int main() {
         // GLuint texArray = TextureManager::LoadTextureArray(texturePaths);
         world.SetTextureArray(texArray);
 
+        // Hold the splash until the chunks around spawn are ACTIVE (0 = drop straight into the game)
+        if (WARM_START_RADIUS_CHUNKS > 0) {
+            RenderWarmStartScreen(window, gui, world, player.camera.Position, WARM_START_RADIUS_CHUNKS, WARM_START_TIMEOUT_SECONDS);
+        }
+        GOOSE_LOG_INFO("Main", "Time to playable: " << std::fixed << std::setprecision(2) << glfwGetTime() << "s");
+
+
+        Engine::MetricsRegistry::Get().EnableSnapshots(METRICS_SNAPSHOT_PATH, METRICS_SNAPSHOT_INTERVAL_SECONDS);
+        Engine::FlightRecorder::Get().Start("hitch", HITCH_THRESHOLD_MS, HITCH_WINDOW_SECONDS); // after the warm start, its frames are long by design
 
         // initialize for occlusion culler retroprojection
         glm::mat4 prevViewProj = glm::mat4(1.0f);
@@ -400,6 +436,7 @@ int main() {
             deltaTime = std::min(deltaTime, 0.05f); 
 
             Engine::Profiler::Get().Update();
+            Engine::MetricsRegistry::Get().Tick();
             //////// *************** Timing
 
             
@@ -422,7 +459,8 @@ int main() {
 
             }
             processInput(window, world); // process keyboard and mouse input
-            world.Update(player.camera.Position); // calc world updates like chunk loading/unloading
+            // calc world updates like chunk loading/unloading (velocity feeds the streaming predictor, player is frozen outside game mode)
+            world.Update(player.camera.Position, appState.isGameMode ? player.velocity : glm::vec3(0.0f));
             
 
             ///////// *****************  logic/world gen, chunk loading/unloading
@@ -509,7 +547,8 @@ int main() {
             // Triggers: Cull(PrevDepth) -> MultiDrawIndirect, then HI-Z occlusion calc for next frame
             // see GPU_CULLING_RENDER_SYSTEM.md for render pipeline info
             world.Draw(worldShader, viewProj, prevViewProj, projection, 
-                curScrWidth, curScrHeight, &depthDebug, f3DepthDebug, lockFrustum, player.position);
+                curScrWidth, curScrHeight, &depthDebug, f3DepthDebug, lockFrustum, player.camera.Position);
+            world.SyncStreaming(); // streaming step ran next to Draw, the world is ours again from here
                 //////////////////// ****************************** World Draw Call
                 
                 
@@ -549,7 +588,8 @@ int main() {
         } ///// ************ GAME LOOP CLOSE SCOPE ************* 
     }
     catch (const std::exception& e) {
-        std::cerr << "\n[FATAL CRASH]: " << e.what() << "\n" << std::endl;
+        GOOSE_LOG_ERROR("FATAL CRASH", e.what());
+        Engine::Logger::Get().Shutdown(); // Drains the queue before we go
         
         return -1;
     }
@@ -557,8 +597,10 @@ int main() {
     // Shutdown
     BlockSelection::Get().Shutdown();
     ChunkDebugger::Get().Shutdown();
+    Engine::FlightRecorder::Get().Shutdown();
     Engine::Profiler::Get().Shutdown();
     gui.Shutdown();
     glfwTerminate();
+    Engine::Logger::Get().Shutdown();
     return 0;
 }
\ No newline at end of file
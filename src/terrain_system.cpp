@@ -61,26 +61,25 @@ uint8_t StandardGenerator::GetBlock(float x, float y, float z, int lodScale) con
     // 3D Cave Check (Only cut holes if we are below surface)
     if (wy < heightAtXZ && lodScale == 1) { 
         float val = m_caveNoise->GenSingle3D(x * 0.02f, y * 0.04f, z * 0.02f, m_settings.seed);
-        if (val > m_settings.caveThreshold) return 0; // Air
+        if (val > m_settings.caveThreshold) return Block::AIR; // Air
     }
 
-    if (wy > heightAtXZ) return 0; 
+    if (wy > heightAtXZ) return Block::AIR; 
 
     if (wy == heightAtXZ) {
-        if (wy > 180) return 4; // Snow/Bedrock
-        return 1; // Grass
+        if (wy > 180) return Block::SNOW; // Snow on high peaks
+        return Block::GRASS; // Grass
     } 
     else if (wy > heightAtXZ - (4 * lodScale)) {
-        return 2; // Dirt
+        return Block::DIRT; // Dirt
     }
     
-    if (wy == 0) return 4; // Bedrock floor
+    if (wy == 0) return Block::SNOW; // The y = 0 floor layer is snow
 
-    return 3; // Stone
+    return Block::STONE; // Stone
 }
 
 void StandardGenerator::GetHeightBounds(int cx, int cz, int scale, int& minH, int& maxH) {
-    const int CHUNK_SIZE = 32; 
     int worldX = cx * CHUNK_SIZE * scale;
     int worldZ = cz * CHUNK_SIZE * scale;
     int size = CHUNK_SIZE * scale;
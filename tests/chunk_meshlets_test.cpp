@@ -0,0 +1,233 @@
+// Meshlet builder and CPU reference culler (chunk_meshlets.h) on real mesher output, checked
+// against a brute-force per-quad cull.
+
+#include <vector>
+#include <cmath>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "mesher.h"
+#include "chunk_meshlets.h"
+#include "test_common.h"
+
+struct QuadInfo {
+    uint32_t face;
+    glm::vec3 minLocal, maxLocal;
+};
+
+static glm::vec3 VertexLocal(uint32_t data) {
+    return glm::vec3((float)(data & PACKED_COORD_MASK),
+                     (float)((data >> PACKED_COORD_BITS) & PACKED_COORD_MASK),
+                     (float)((data >> (PACKED_COORD_BITS * 2)) & PACKED_COORD_MASK));
+}
+
+static QuadInfo GetQuad(const PackedVertex* vertices, size_t quad) {
+    const PackedVertex* v = vertices + quad * MESHLET_VERTICES_PER_QUAD;
+    QuadInfo info;
+    info.face = (v[0].data >> PACKED_NORM_SHIFT) & 0x7;
+    info.minLocal = info.maxLocal = VertexLocal(v[0].data);
+    for (uint32_t i = 1; i < MESHLET_VERTICES_PER_QUAD; i++) {
+        glm::vec3 p = VertexLocal(v[i].data);
+        info.minLocal = glm::min(info.minLocal, p);
+        info.maxLocal = glm::max(info.maxLocal, p);
+    }
+    return info;
+}
+
+// Hills with caves, water on top and some glass: every face direction, lots of direction changes
+static void FillTestChunk(Chunk& chunk) {
+    for (int y = 0; y < CHUNK_SIZE_PADDED; y++)
+        for (int z = 0; z < CHUNK_SIZE_PADDED; z++)
+            for (int x = 0; x < CHUNK_SIZE_PADDED; x++) {
+                int height = CHUNK_SIZE / 2 + (int)(4.0f * std::sin(x * 0.4f) + 3.0f * std::cos(z * 0.3f));
+                uint8_t id = Block::AIR;
+                if (y < height) id = ((x * 7 + y * 5 + z * 3) % 11 == 0) ? Block::AIR : Block::STONE;
+                else if (y == height) id = Block::GRASS;
+                else if (y < CHUNK_SIZE / 2 + 2) id = Block::WATER;
+                if (id == Block::STONE && (x + z) % 9 == 0 && y > 3) id = Block::GLASS;
+                chunk.Set(x, y, z, id);
+            }
+}
+
+// A quad with `face` whose corners span [minCorner, maxCorner] (flat along the face axis)
+static void PushQuad(std::vector<PackedVertex>& out, uint32_t face, glm::vec3 minCorner, glm::vec3 maxCorner) {
+    glm::vec3 corners[6] = { minCorner, maxCorner, glm::vec3(minCorner.x, maxCorner.y, maxCorner.z),
+                             minCorner, glm::vec3(maxCorner.x, minCorner.y, minCorner.z), maxCorner };
+    for (const glm::vec3& c : corners) out.push_back(PackedVertex(c.x, c.y, c.z, (float)face, 0.0f, 1));
+}
+
+// --- Builder ---
+static void TestBuilderSynthetic() {
+    std::vector<ChunkMeshlet> meshlets = { ChunkMeshlet{} };
+    BuildMeshlets(nullptr, 0, meshlets);
+    CHECK(meshlets.empty());
+
+    // 130 +X quads, then 3 -Y quads: cut at 64, 128 and at the direction change
+    std::vector<PackedVertex> vertices;
+    for (int i = 0; i < 130; i++) {
+        float y = (float)(i % CHUNK_SIZE);
+        PushQuad(vertices, 0, glm::vec3(3.0f, y, 0.0f), glm::vec3(3.0f, y + 1.0f, 1.0f));
+    }
+    for (int i = 0; i < 3; i++) PushQuad(vertices, 3, glm::vec3((float)i, 0.0f, 5.0f), glm::vec3((float)i + 1.0f, 0.0f, 7.0f));
+
+    BuildMeshlets(vertices.data(), vertices.size(), meshlets);
+    CHECK_EQ(meshlets.size(), 4);
+    if (meshlets.size() != 4) return;
+    CHECK_EQ(meshlets[0].vertexCount, 64 * MESHLET_VERTICES_PER_QUAD);
+    CHECK_EQ(meshlets[1].vertexCount, 64 * MESHLET_VERTICES_PER_QUAD);
+    CHECK_EQ(meshlets[2].vertexCount, 2 * MESHLET_VERTICES_PER_QUAD);
+    CHECK_EQ(meshlets[3].firstVertex, 130 * MESHLET_VERTICES_PER_QUAD);
+    CHECK_EQ(MeshletFaceMask(meshlets[0]), 1u << 0);
+    CHECK_EQ(MeshletFaceMask(meshlets[3]), 1u << 3);
+    CHECK(MeshletBoundsMin(meshlets[3]) == glm::vec3(0.0f, 0.0f, 5.0f));
+    CHECK(MeshletBoundsMax(meshlets[3]) == glm::vec3(3.0f, 0.0f, 7.0f));
+}
+
+static void TestBuilderOnMesherOutput(const std::vector<PackedVertex>& mesh, const std::vector<ChunkMeshlet>& meshlets) {
+    CHECK(!meshlets.empty());
+    uint32_t expectedFirst = 0;
+    uint32_t previousFace = 0xFFFFFFFFu;
+    uint32_t previousQuads = 0;
+    for (const ChunkMeshlet& m : meshlets) {
+        // Contiguous, whole quads, at most MESHLET_MAX_QUADS of them
+        CHECK_EQ(m.firstVertex, expectedFirst);
+        CHECK(m.vertexCount > 0 && m.vertexCount % MESHLET_VERTICES_PER_QUAD == 0);
+        CHECK(m.vertexCount <= MESHLET_MAX_QUADS * MESHLET_VERTICES_PER_QUAD);
+        expectedFirst += m.vertexCount;
+
+        // One direction per cluster, bounds hold every vertex of every quad
+        uint32_t mask = MeshletFaceMask(m);
+        CHECK(mask != 0 && (mask & (mask - 1)) == 0);
+        glm::vec3 bMin = MeshletBoundsMin(m), bMax = MeshletBoundsMax(m);
+        CHECK(bMax.x <= (float)CHUNK_SIZE && bMax.y <= (float)CHUNK_SIZE && bMax.z <= (float)CHUNK_SIZE);
+        uint32_t face = 0;
+        for (uint32_t q = m.firstVertex / MESHLET_VERTICES_PER_QUAD; q < (m.firstVertex + m.vertexCount) / MESHLET_VERTICES_PER_QUAD; q++) {
+            QuadInfo quad = GetQuad(mesh.data(), q);
+            face = quad.face;
+            CHECK_EQ(1u << quad.face, mask);
+            CHECK(quad.minLocal.x >= bMin.x && quad.minLocal.y >= bMin.y && quad.minLocal.z >= bMin.z);
+            CHECK(quad.maxLocal.x <= bMax.x && quad.maxLocal.y <= bMax.y && quad.maxLocal.z <= bMax.z);
+        }
+
+        // Only cut when it had to be: full cluster or new direction
+        if (previousFace != 0xFFFFFFFFu) CHECK(previousQuads == MESHLET_MAX_QUADS || previousFace != face);
+        previousFace = face;
+        previousQuads = m.vertexCount / MESHLET_VERTICES_PER_QUAD;
+    }
+    CHECK_EQ(expectedFirst, mesh.size());
+}
+
+// --- Culler vs brute force ---
+
+// Same projection as Camera::GetProjectionMatrix (reverse-Z, infinite far plane)
+static glm::mat4 ReverseZProjection(float aspect, float tanHalfFov, float zNear) {
+    float f = 1.0f / tanHalfFov;
+    glm::mat4 projection(0.0f);
+    projection[0][0] = f / aspect;
+    projection[1][1] = f;
+    projection[2][3] = -1.0f;
+    projection[3][2] = zNear;
+    return projection;
+}
+
+// Per quad: front-facing (camera on the positive side of its plane) and its own box in the frustum
+static bool IsQuadVisible(const QuadInfo& quad, glm::vec3 origin, float scale, const glm::vec4 planes[6], glm::vec3 cameraPos) {
+    glm::vec3 minPos = origin + quad.minLocal * scale;
+    glm::vec3 maxPos = origin + quad.maxLocal * scale;
+    bool front = false;
+    switch (quad.face) {
+        case 0: front = cameraPos.x > minPos.x; break;
+        case 1: front = cameraPos.x < minPos.x; break;
+        case 2: front = cameraPos.y > minPos.y; break;
+        case 3: front = cameraPos.y < minPos.y; break;
+        case 4: front = cameraPos.z > minPos.z; break;
+        case 5: front = cameraPos.z < minPos.z; break;
+    }
+    return front && IsBoxInFrustum(planes, minPos, maxPos);
+}
+
+static void TestCullerAgainstBruteForce(const std::vector<PackedVertex>& mesh, const std::vector<ChunkMeshlet>& meshlets) {
+    const glm::mat4 projection = ReverseZProjection(16.0f / 9.0f, 0.7f, 0.1f);
+    const size_t quadCount = mesh.size() / MESHLET_VERTICES_PER_QUAD;
+
+    std::vector<uint32_t> meshletOfQuad(quadCount);
+    for (uint32_t i = 0; i < (uint32_t)meshlets.size(); i++)
+        for (uint32_t v = meshlets[i].firstVertex; v < meshlets[i].firstVertex + meshlets[i].vertexCount; v += MESHLET_VERTICES_PER_QUAD)
+            meshletOfQuad[v / MESHLET_VERTICES_PER_QUAD] = i;
+
+    int views = 0, viewsThatCulled = 0;
+    for (float scale : { 1.0f, 2.0f }) {
+        const glm::vec3 origin(64.0f, -16.0f, -96.0f);
+        const float extent = CHUNK_SIZE * scale;
+        const glm::vec3 center = origin + glm::vec3(extent * 0.5f);
+
+        // Orbit at three heights (looking at the chunk, and looking past it), plus one camera inside it
+        std::vector<std::pair<glm::vec3, glm::vec3>> poses;
+        for (int i = 0; i < 8; i++) {
+            float angle = i * 0.785f;
+            for (float height : { -0.8f, 0.1f, 1.3f }) {
+                glm::vec3 eye = center + glm::vec3(std::cos(angle), height, std::sin(angle)) * (extent * 1.5f);
+                poses.push_back({ eye, center });
+                poses.push_back({ eye, center + glm::vec3(-std::sin(angle), 0.0f, std::cos(angle)) * (extent * 0.8f) });
+            }
+        }
+        poses.push_back({ center + glm::vec3(0.3f, 0.2f, 0.1f), center + glm::vec3(10.0f, 0.0f, 3.0f) });
+
+        for (const auto& pose : poses) {
+            glm::vec3 cameraPos = pose.first;
+            glm::mat4 view = glm::lookAt(cameraPos, pose.second, glm::vec3(0.0f, 1.0f, 0.0f));
+            glm::vec4 planes[6];
+            ExtractFrustumPlanes(projection * view, planes);
+
+            std::vector<uint32_t> visible;
+            size_t survivingVertices = CullMeshletsReference(meshlets, origin, scale, planes, cameraPos, &visible);
+            std::vector<bool> meshletVisible(meshlets.size(), false);
+            size_t summed = 0;
+            for (uint32_t i : visible) {
+                meshletVisible[i] = true;
+                summed += meshlets[i].vertexCount;
+            }
+            CHECK_EQ(summed, survivingVertices);
+
+            // Conservative: every quad the brute force draws is in a surviving cluster
+            size_t missed = 0, bruteVertices = 0;
+            for (size_t q = 0; q < quadCount; q++) {
+                if (!IsQuadVisible(GetQuad(mesh.data(), q), origin, scale, planes, cameraPos)) continue;
+                bruteVertices += MESHLET_VERTICES_PER_QUAD;
+                if (!meshletVisible[meshletOfQuad[q]]) missed++;
+            }
+            CHECK_EQ(missed, 0);
+            CHECK(survivingVertices >= bruteVertices);
+
+            views++;
+            if (survivingVertices < mesh.size()) viewsThatCulled++;
+        }
+    }
+    // From outside, at least the back-facing directions go, so nearly every view must cull something
+    CHECK(viewsThatCulled >= views - 2);
+
+    // Looking straight away from the chunk: nothing survives
+    glm::vec3 eye(0.0f, 0.0f, 0.0f);
+    glm::vec4 planes[6];
+    ExtractFrustumPlanes(projection * glm::lookAt(eye, glm::vec3(-10.0f, 0.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f)), planes);
+    CHECK_EQ(CullMeshletsReference(meshlets, glm::vec3(64.0f, -16.0f, -96.0f), 1.0f, planes, eye), 0);
+}
+
+int main() {
+    TestBuilderSynthetic();
+
+    Chunk* chunk = new Chunk();
+    FillTestChunk(*chunk);
+    LinearAllocator<PackedVertex> opaque(1u << 20), trans(1u << 18);
+    MeshChunk(*chunk, opaque, trans);
+    std::vector<PackedVertex> mesh(opaque.Data(), opaque.Data() + opaque.Count());
+    CHECK(mesh.size() > MESHLET_MAX_QUADS * MESHLET_VERTICES_PER_QUAD * 6);
+
+    std::vector<ChunkMeshlet> meshlets;
+    BuildMeshlets(mesh.data(), mesh.size(), meshlets);
+    TestBuilderOnMesherOutput(mesh, meshlets);
+    TestCullerAgainstBruteForce(mesh, meshlets);
+
+    delete chunk;
+    return TestResult("chunk_meshlets");
+}
@@ -0,0 +1,151 @@
+// Connectivity flood fill and PVS traversal (chunk_visibility.h) on hand-built cave layouts.
+
+#include <set>
+#include <tuple>
+#include <map>
+
+#include "chunk_visibility.h"
+#include "test_common.h"
+
+using CellSet = std::set<std::tuple<int, int, int>>;
+
+static void FillInner(Chunk& chunk, uint8_t id) {
+    for (int y = 0; y < CHUNK_SIZE; y++)
+        for (int z = 0; z < CHUNK_SIZE; z++)
+            for (int x = 0; x < CHUNK_SIZE; x++) chunk.Set(x + PADDING, y + PADDING, z + PADDING, id);
+}
+
+static uint64_t Connect(int faceA, int faceB) {
+    return ConnectivityFromFaceMask((uint8_t)((1u << faceA) | (1u << faceB)));
+}
+
+static CellSet ToSet(const std::vector<ChunkVisibilityGraph::Cell>& cells) {
+    CellSet set;
+    for (const auto& cell : cells) set.insert({ cell.x, cell.y, cell.z });
+    return set;
+}
+
+// --- Voxel level: what one chunk's flood fill reports ---
+static void TestChunkConnectivity() {
+    Chunk chunk;
+    FillInner(chunk, Block::AIR);
+    CHECK(ComputeChunkConnectivity(chunk) == CONNECTIVITY_ALL);
+
+    FillInner(chunk, Block::STONE);
+    CHECK(ComputeChunkConnectivity(chunk) == CONNECTIVITY_NONE);
+
+    // Sealed room: a 4^3 air pocket in the middle that touches no face
+    const int mid = CHUNK_SIZE / 2;
+    for (int y = mid - 2; y < mid + 2; y++)
+        for (int z = mid - 2; z < mid + 2; z++)
+            for (int x = mid - 2; x < mid + 2; x++) chunk.Set(x + PADDING, y + PADDING, z + PADDING, Block::AIR);
+    CHECK(ComputeChunkConnectivity(chunk) == CONNECTIVITY_NONE);
+
+    // L-shaped tunnel: in through -X, along X to the middle, then out through +Z
+    FillInner(chunk, Block::STONE);
+    for (int x = 0; x <= mid; x++) chunk.Set(x + PADDING, mid + PADDING, mid + PADDING, Block::AIR);
+    for (int z = mid; z < CHUNK_SIZE; z++) chunk.Set(mid + PADDING, mid + PADDING, z + PADDING, Block::AIR);
+    uint64_t tunnel = ComputeChunkConnectivity(chunk);
+    CHECK(tunnel == Connect(1, 4));
+    CHECK(AreFacesConnected(tunnel, 1, 4) && AreFacesConnected(tunnel, 4, 1));
+    CHECK(!AreFacesConnected(tunnel, 1, 0));
+
+    // Glass doesn't block the walk, water doesn't either
+    FillInner(chunk, Block::STONE);
+    for (int x = 0; x < CHUNK_SIZE; x++) chunk.Set(x + PADDING, mid + PADDING, mid + PADDING, (x & 1) ? Block::GLASS : Block::WATER);
+    CHECK(ComputeChunkConnectivity(chunk) == Connect(0, 1));
+}
+
+// --- Grid level: Traverse over synthetic per-chunk connectivity ---
+static void TestSealedRoom() {
+    // Open surface at y = 1, solid layer at y = 0, a sealed open room at y = -1 under the camera
+    ChunkVisibilityGraph graph;
+    auto connectivity = [](int, int y, int) -> uint64_t {
+        if (y == 1) return CONNECTIVITY_ALL;
+        if (y == 0) return CONNECTIVITY_NONE;
+        return CONNECTIVITY_ALL;
+    };
+    CellSet cells = ToSet(graph.Traverse(0, 1, 0, 3, -1, 1, connectivity));
+
+    int surface = 0, crust = 0, room = 0;
+    for (const auto& cell : cells) {
+        int y = std::get<1>(cell);
+        if (y == 1) surface++;
+        else if (y == 0) crust++;
+        else room++;
+    }
+    CHECK_EQ(surface, 7 * 7);
+    CHECK_EQ(crust, 7 * 7); // Visible themselves (the ground), nothing behind them
+    CHECK_EQ(room, 0);
+}
+
+static void TestLShapedTunnel() {
+    // Everything solid except an L: (1..2, 0, 0) along X, corner (3, 0, 0), then (3, 0, 1..2) along Z
+    std::map<std::tuple<int, int, int>, uint64_t> open = {
+        { { 1, 0, 0 }, Connect(0, 1) },
+        { { 2, 0, 0 }, Connect(0, 1) },
+        { { 3, 0, 0 }, Connect(1, 4) },
+        { { 3, 0, 1 }, Connect(4, 5) },
+        { { 3, 0, 2 }, Connect(4, 5) },
+    };
+    auto connectivity = [&](int x, int y, int z) -> uint64_t {
+        auto it = open.find({ x, y, z });
+        return it != open.end() ? it->second : CONNECTIVITY_NONE;
+    };
+
+    ChunkVisibilityGraph graph;
+    const auto& list = graph.Traverse(0, 0, 0, 4, -1, 1, connectivity);
+    CellSet cells = ToSet(list);
+    CHECK_EQ(list.size(), cells.size()); // Each cell listed once
+
+    CellSet expected = {
+        { 0, 0, 0 },                                                    // Camera
+        { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 }, // Walls around it
+        { 1, 0, 0 }, { 2, 0, 0 }, { 3, 0, 0 }, { 3, 0, 1 }, { 3, 0, 2 },   // The tunnel
+        { 3, 0, 3 },                                                    // The wall at its end
+    };
+    CHECK(cells == expected);
+    CHECK(cells.count({ 4, 0, 0 }) == 0);  // Straight on past the corner is rock
+    CHECK(cells.count({ 2, 0, 1 }) == 0);  // Beside the tunnel
+}
+
+static void TestDeadEndFromOneSideOnly() {
+    // T = (1, 1, 0) only links -X to +X. BFS reaches it first from below (through (1, 0, 0)), where it is
+    // a dead end, and only then from -X through (0, 1, 0). (2, 1, 0) behind it is only reachable that way.
+    std::map<std::tuple<int, int, int>, uint64_t> open = {
+        { { 1, 0, 0 }, CONNECTIVITY_ALL },
+        { { 0, 1, 0 }, CONNECTIVITY_ALL },
+        { { 1, 1, 0 }, Connect(0, 1) },
+        { { 2, 1, 0 }, CONNECTIVITY_ALL },
+    };
+    auto connectivity = [&](int x, int y, int z) -> uint64_t {
+        auto it = open.find({ x, y, z });
+        return it != open.end() ? it->second : CONNECTIVITY_NONE;
+    };
+
+    ChunkVisibilityGraph graph;
+    const auto& list = graph.Traverse(0, 0, 0, 4, -2, 2, connectivity);
+    CellSet cells = ToSet(list);
+    CHECK_EQ(list.size(), cells.size());
+    CHECK(cells.count({ 1, 1, 0 }) == 1);
+    CHECK(cells.count({ 2, 1, 0 }) == 1); // Lost when visits were tracked per cell only
+    CHECK(cells.count({ 3, 1, 0 }) == 1); // Wall behind it
+}
+
+static void TestScratchReuse() {
+    // Same graph object, different extent: results must not depend on the previous walk
+    ChunkVisibilityGraph graph;
+    auto allOpen = [](int, int, int) { return CONNECTIVITY_ALL; };
+    CHECK_EQ(graph.Traverse(0, 0, 0, 2, 0, 0, allOpen).size(), 5 * 5);
+    CHECK_EQ(graph.Traverse(10, 3, -4, 1, 0, 5, allOpen).size(), 3 * 3 * 6);
+    CHECK_EQ(graph.Traverse(0, 0, 0, 2, 0, 0, allOpen).size(), 5 * 5);
+}
+
+int main() {
+    TestChunkConnectivity();
+    TestSealedRoom();
+    TestLShapedTunnel();
+    TestDeadEndFromOneSideOnly();
+    TestScratchReuse();
+    return TestResult("chunk_visibility");
+}
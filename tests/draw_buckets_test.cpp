@@ -0,0 +1,137 @@
+// Distance-bucketed draw order (draw_buckets.h): bucket boundaries, the cull + compact binning, and
+// opaque emission staying inside the command buffer when meshlet splits ask for more than it holds.
+
+#include <vector>
+#include <random>
+#include <algorithm>
+
+#include "draw_buckets.h"
+#include "test_common.h"
+
+static void TestBucketBoundaries() {
+    const float base = 32.0f;
+    CHECK_EQ(DistanceBucket(0.0f, base), 0);
+    CHECK_EQ(DistanceBucket(base * 0.999f, base), 0);
+    CHECK_EQ(DistanceBucket(base, base), 1);
+    CHECK_EQ(DistanceBucket(base * 1.999f, base), 1);
+    CHECK_EQ(DistanceBucket(base * 2.0f, base), 2);
+    CHECK_EQ(DistanceBucket(base * 4.0f, base), 3);
+    CHECK_EQ(DistanceBucket(base * 64.0f, base), 7);
+    CHECK_EQ(DistanceBucket(base * 63.9f, base), 6);
+    CHECK_EQ(DistanceBucket(1.0e9f, base), DRAW_DISTANCE_BUCKETS - 1); // Last bucket is open-ended
+
+    CHECK_EQ(DistanceToBox(glm::vec3(1.0f), glm::vec3(0.0f), glm::vec3(2.0f)), 0.0f);
+    CHECK_EQ(DistanceToBox(glm::vec3(5.0f, 1.0f, 1.0f), glm::vec3(0.0f), glm::vec3(2.0f)), 3.0f);
+}
+
+// Order must be a permutation sorted by bucket, with commands of one bucket in emission order
+static void CheckBinned(const std::vector<float>& distances, float base, const std::vector<uint32_t>& order, const uint32_t* counts) {
+    CHECK_EQ(order.size(), distances.size());
+    std::vector<bool> seen(distances.size(), false);
+    for (uint32_t i : order) {
+        CHECK(i < distances.size());
+        if (i < distances.size()) { CHECK(!seen[i]); seen[i] = true; }
+    }
+
+    uint32_t expected[DRAW_DISTANCE_BUCKETS] = {};
+    for (float d : distances) expected[DistanceBucket(d, base)]++;
+    for (uint32_t b = 0; b < DRAW_DISTANCE_BUCKETS; b++) CHECK_EQ(counts[b], expected[b]);
+
+    for (size_t k = 1; k < order.size(); k++) {
+        uint32_t prev = DistanceBucket(distances[order[k - 1]], base);
+        uint32_t cur = DistanceBucket(distances[order[k]], base);
+        CHECK(prev <= cur);
+        if (prev == cur) CHECK(order[k - 1] < order[k]);
+    }
+}
+
+static void TestBinning() {
+    const float base = 16.0f;
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> dist(0.0f, base * 300.0f);
+
+    for (size_t n : { 0, 1, 5, 1000 }) {
+        std::vector<float> distances(n);
+        for (float& d : distances) d = dist(rng);
+        std::vector<uint32_t> order;
+        uint32_t counts[DRAW_DISTANCE_BUCKETS];
+        BinDrawsReference(distances, base, order, counts);
+        CheckBinned(distances, base, order, counts);
+    }
+
+    // Exactly on the boundaries, both sides
+    std::vector<float> edges = { base * 2.0f, base, 0.0f, base * 128.0f, base * 0.5f, base * 2.0f, base * 4.0f };
+    std::vector<uint32_t> order;
+    uint32_t counts[DRAW_DISTANCE_BUCKETS];
+    BinDrawsReference(edges, base, order, counts);
+    CheckBinned(edges, base, order, counts);
+    CHECK_EQ(order.front(), 2);
+    CHECK_EQ(order.back(), 3);
+}
+
+static void TestSplitOverflow() {
+    // 64 chunk slots, 4 commands each: 192 commands of split budget
+    const uint32_t maxChunks = 64;
+    const uint32_t maxOpaque = maxChunks * 4;
+    const uint32_t budget = maxOpaque - maxChunks;
+    std::mt19937 rng(11);
+
+    for (uint32_t maxMeshlets : { 1u, 3u, 8u, 40u }) {
+        std::vector<uint32_t> visible(maxChunks);
+        std::vector<float> chunkDistances(maxChunks);
+        uint32_t asked = 0, drawing = 0;
+        for (uint32_t i = 0; i < maxChunks; i++) {
+            visible[i] = rng() % (maxMeshlets + 1);
+            chunkDistances[i] = (float)(rng() % 5000);
+            if (visible[i] > 1) asked += visible[i] - 1;
+            if (visible[i] > 0) drawing++;
+        }
+
+        std::vector<float> commands;
+        uint32_t splitRequested = EmitOpaqueCommandsReference(visible, chunkDistances, maxChunks, maxOpaque, commands);
+        CHECK_EQ(splitRequested, asked);
+        CHECK(commands.size() <= maxOpaque);
+        CHECK(commands.size() >= drawing);      // Every drawn chunk keeps at least its whole-range command
+        uint32_t overflow = splitRequested > budget ? splitRequested - budget : 0;
+        if (overflow == 0) CHECK_EQ(commands.size(), drawing + asked);
+
+        // Per chunk: all of its meshlets or one command, never something in between
+        size_t pos = 0;
+        for (uint32_t i = 0; i < maxChunks; i++) {
+            if (visible[i] == 0) continue;
+            size_t run = 0;
+            while (pos + run < commands.size() && commands[pos + run] == chunkDistances[i] && run < visible[i]) run++;
+            CHECK(run == 1 || run == visible[i]);
+            pos += run;
+        }
+        CHECK_EQ(pos, commands.size());
+
+        // The compact pass sees exactly what was emitted, bucket counts add up to it
+        std::vector<uint32_t> order;
+        uint32_t counts[DRAW_DISTANCE_BUCKETS];
+        BinDrawsReference(commands, 64.0f, order, counts);
+        CheckBinned(commands, 64.0f, order, counts);
+        uint32_t total = 0;
+        for (uint32_t c : counts) total += c;
+        CHECK_EQ(total, commands.size());
+    }
+
+    // Every chunk asking for the maximum: the budget fills exactly, the rest fall back
+    std::vector<uint32_t> visible(maxChunks, 9);
+    std::vector<float> chunkDistances(maxChunks);
+    for (uint32_t i = 0; i < maxChunks; i++) chunkDistances[i] = (float)i;
+    std::vector<float> commands;
+    uint32_t splitRequested = EmitOpaqueCommandsReference(visible, chunkDistances, maxChunks, maxOpaque, commands);
+    CHECK_EQ(splitRequested, maxChunks * 8);
+    uint32_t splitChunks = budget / 8;
+    CHECK_EQ(commands.size(), splitChunks * 9 + (maxChunks - splitChunks));
+    CHECK(commands.size() <= maxOpaque);
+    CHECK_EQ(splitRequested - budget, maxChunks * 8 - budget); // GetClusterOverflow()
+}
+
+int main() {
+    TestBucketBoundaries();
+    TestBinning();
+    TestSplitOverflow();
+    return TestResult("draw_buckets");
+}
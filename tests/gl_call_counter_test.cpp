@@ -0,0 +1,188 @@
+// GL call counting (gl_call_counter.h) over stub entry points: Install() must wrap exactly the glad
+// pointers that are set, forward every call to the stub, and count it under the right kind, bytes,
+// frame and scope. Uninstall() must put the stubs back.
+// GOOSE_TEST_NEEDS_GLAD: links src/vendor/glad.c for the function pointers (tests/CMakeLists.txt).
+
+#include <string>
+
+#include "gl_call_counter.h"
+#include "test_common.h"
+
+using Engine::GlCallCounter;
+using Engine::GlCallKind;
+using Engine::GlCallStats;
+
+// ================================================================================================
+//                                      STUB GL
+// ================================================================================================
+
+namespace StubGL {
+    int drawArrays = 0;
+    int multiDrawIndirect = 0;
+    int dispatch = 0;
+    int namedBufferSubData = 0;
+    int copyNamedBufferSubData = 0;
+    int uniform1i = 0;
+    int useProgram = 0;
+    int memoryBarrier = 0;
+    GLboolean isEnabledResult = GL_TRUE;
+    int isEnabled = 0;
+
+    void APIENTRY DrawArrays(GLenum, GLint, GLsizei) { drawArrays++; }
+    void APIENTRY MultiDrawArraysIndirect(GLenum, const void*, GLsizei, GLsizei) { multiDrawIndirect++; }
+    void APIENTRY DispatchCompute(GLuint, GLuint, GLuint) { dispatch++; }
+    void APIENTRY NamedBufferSubData(GLuint, GLintptr, GLsizeiptr, const void*) { namedBufferSubData++; }
+    void APIENTRY CopyNamedBufferSubData(GLuint, GLuint, GLintptr, GLintptr, GLsizeiptr) { copyNamedBufferSubData++; }
+    void APIENTRY Uniform1i(GLint, GLint) { uniform1i++; }
+    void APIENTRY UseProgram(GLuint) { useProgram++; }
+    void APIENTRY MemoryBarrier(GLbitfield) { memoryBarrier++; }
+    GLboolean APIENTRY IsEnabled(GLenum) { isEnabled++; return isEnabledResult; }
+
+    constexpr size_t INSTALLED = 9;
+
+    void Install() {
+        glad_glDrawArrays = DrawArrays;
+        glad_glMultiDrawArraysIndirect = MultiDrawArraysIndirect;
+        glad_glDispatchCompute = DispatchCompute;
+        glad_glNamedBufferSubData = NamedBufferSubData;
+        glad_glCopyNamedBufferSubData = CopyNamedBufferSubData;
+        glad_glUniform1i = Uniform1i;
+        glad_glUseProgram = UseProgram;
+        glad_glMemoryBarrier = MemoryBarrier;
+        glad_glIsEnabled = IsEnabled;
+    }
+}
+
+// ================================================================================================
+
+static const GlCallStats* FindScope(const char* name) {
+    for (const auto& [scope, stats] : GlCallCounter::Get().GetLastScopes()) {
+        if (scope == name) return &stats;
+    }
+    return nullptr;
+}
+
+static void TestInstall() {
+    GlCallCounter& counter = GlCallCounter::Get();
+    CHECK(!counter.IsInstalled());
+
+    counter.Install();
+    CHECK(counter.IsInstalled());
+    CHECK_EQ(counter.GetHookCount(), StubGL::INSTALLED);     // Only the pointers that were set
+    CHECK(glad_glDrawArrays != StubGL::DrawArrays);
+    CHECK(glad_glIsEnabled != StubGL::IsEnabled);
+    CHECK(glad_glDrawElements == nullptr);                   // Unresolved stays unhooked
+    CHECK(glad_glBufferSubData == nullptr);
+
+    // Installing twice must not wrap the wrappers
+    counter.Install();
+    CHECK_EQ(counter.GetHookCount(), StubGL::INSTALLED);
+}
+
+static void TestPerFunctionCounts() {
+    GlCallCounter& counter = GlCallCounter::Get();
+    counter.EndFrame(); // Start from an empty frame
+
+    for (int i = 0; i < 3; i++) glDrawArrays(GL_TRIANGLES, 0, 36);
+    glMultiDrawArraysIndirect(GL_TRIANGLES, nullptr, 100, 0);
+    for (int i = 0; i < 2; i++) glDispatchCompute(8, 8, 1);
+    glNamedBufferSubData(1, 0, 4096, nullptr);
+    glNamedBufferSubData(1, 4096, 256, nullptr);
+    glCopyNamedBufferSubData(1, 2, 0, 0, 1000);
+    for (int i = 0; i < 5; i++) glUniform1i(0, i);
+    glUseProgram(3);
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+    CHECK(glIsEnabled(GL_DEPTH_TEST) == GL_TRUE);            // Return value forwarded
+
+    // Every call reached its stub exactly once
+    CHECK_EQ(StubGL::drawArrays, 3);
+    CHECK_EQ(StubGL::multiDrawIndirect, 1);
+    CHECK_EQ(StubGL::dispatch, 2);
+    CHECK_EQ(StubGL::namedBufferSubData, 2);
+    CHECK_EQ(StubGL::copyNamedBufferSubData, 1);
+    CHECK_EQ(StubGL::uniform1i, 5);
+    CHECK_EQ(StubGL::useProgram, 1);
+    CHECK_EQ(StubGL::memoryBarrier, 1);
+    CHECK_EQ(StubGL::isEnabled, 1);
+
+    counter.EndFrame();
+    const GlCallStats& frame = counter.GetLastFrame();
+    CHECK_EQ(frame.calls, 17);
+    CHECK_EQ(frame.Count(GlCallKind::DRAW), 4);
+    CHECK_EQ(frame.Count(GlCallKind::DISPATCH), 2);
+    CHECK_EQ(frame.Count(GlCallKind::UPLOAD), 2);
+    CHECK_EQ(frame.Count(GlCallKind::COPY), 1);
+    CHECK_EQ(frame.Count(GlCallKind::UNIFORM), 5);
+    CHECK_EQ(frame.Count(GlCallKind::STATE), 1);
+    CHECK_EQ(frame.Count(GlCallKind::SYNC), 1);
+    CHECK_EQ(frame.Count(GlCallKind::QUERY), 1);
+    CHECK_EQ(frame.uploadBytes, 4096 + 256);
+    CHECK_EQ(frame.copyBytes, 1000);
+
+    // The next frame starts at zero
+    counter.EndFrame();
+    CHECK_EQ(counter.GetLastFrame().calls, 0);
+}
+
+static void TestScopes() {
+    GlCallCounter& counter = GlCallCounter::Get();
+    counter.EndFrame();
+
+    glUseProgram(1);                          // Unscoped
+    CHECK(counter.BeginScope("Cull"));
+    glDispatchCompute(1, 1, 1);
+    CHECK(counter.BeginScope("Compact"));     // Innermost wins
+    glDispatchCompute(1, 1, 1);
+    glMemoryBarrier(GL_COMMAND_BARRIER_BIT);
+    counter.EndScope();
+    glUniform1i(0, 1);
+    counter.EndScope();
+    glDrawArrays(GL_TRIANGLES, 0, 3);         // Unscoped again
+    counter.EndFrame();
+
+    const GlCallStats* cull = FindScope("Cull");
+    const GlCallStats* compact = FindScope("Compact");
+    const GlCallStats* outside = FindScope("(outside scopes)");
+    CHECK(cull && compact && outside);
+    if (cull) {
+        CHECK_EQ(cull->calls, 2);
+        CHECK_EQ(cull->Count(GlCallKind::DISPATCH), 1);
+        CHECK_EQ(cull->Count(GlCallKind::UNIFORM), 1);
+    }
+    if (compact) {
+        CHECK_EQ(compact->calls, 2);
+        CHECK_EQ(compact->Count(GlCallKind::SYNC), 1);
+    }
+    if (outside) CHECK_EQ(outside->calls, 2);
+    CHECK_EQ(counter.GetLastFrame().calls, 6);
+
+    // Scopes with no calls this frame are left out
+    counter.EndFrame();
+    CHECK(counter.GetLastScopes().empty());
+}
+
+static void TestUninstall() {
+    GlCallCounter& counter = GlCallCounter::Get();
+    counter.Uninstall();
+    CHECK(!counter.IsInstalled());
+    CHECK(glad_glDrawArrays == StubGL::DrawArrays);
+    CHECK(glad_glIsEnabled == StubGL::IsEnabled);
+    CHECK(glad_glDrawElements == nullptr);
+
+    int before = StubGL::drawArrays;
+    uint64_t frames = counter.GetFrameCount();
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    CHECK_EQ(StubGL::drawArrays, before + 1);
+    counter.EndFrame(); // Ignored when not installed
+    CHECK_EQ(counter.GetFrameCount(), frames);
+    CHECK(!counter.BeginScope("Cull"));
+}
+
+int main() {
+    StubGL::Install();
+    TestInstall();
+    TestPerFunctionCounts();
+    TestScopes();
+    TestUninstall();
+    return TestResult("gl_call_counter");
+}
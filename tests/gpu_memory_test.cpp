@@ -0,0 +1,186 @@
+// Deferred VRAM reuse (gpu_memory.h) without a GL context: the glad entry points the heap calls are
+// pointed at fakes, and fences only signal when the test says so.
+// GOOSE_TEST_NEEDS_GLAD: links src/vendor/glad.c for the function pointers (tests/CMakeLists.txt).
+
+#include <vector>
+#include <set>
+#include <cstdint>
+
+#include "gpu_memory.h"
+#include "test_common.h"
+
+// ================================================================================================
+//                                      FAKE GL
+// ================================================================================================
+
+namespace FakeGL {
+    std::vector<uint8_t> mapped;
+    uintptr_t nextFence = 1;
+    std::set<uintptr_t> signalled;
+    int fencesCreated = 0;
+    int fencesDeleted = 0;
+
+    GLsync MakeSync(uintptr_t id) { return reinterpret_cast<GLsync>(id); }
+    uintptr_t SyncId(GLsync sync) { return reinterpret_cast<uintptr_t>(sync); }
+
+    void APIENTRY CreateBuffers(GLsizei n, GLuint* buffers) { for (GLsizei i = 0; i < n; i++) buffers[i] = 1 + i; }
+    void APIENTRY NamedBufferStorage(GLuint, GLsizeiptr size, const void*, GLbitfield) { mapped.assign((size_t)size, 0); }
+    void* APIENTRY MapNamedBufferRange(GLuint, GLintptr offset, GLsizeiptr, GLbitfield) { return mapped.data() + offset; }
+    GLboolean APIENTRY UnmapNamedBuffer(GLuint) { return GL_TRUE; }
+    void APIENTRY DeleteBuffers(GLsizei, const GLuint*) {}
+    void APIENTRY FlushMappedNamedBufferRange(GLuint, GLintptr, GLsizeiptr) {}
+
+    GLsync APIENTRY FenceSync(GLenum, GLbitfield) {
+        fencesCreated++;
+        return MakeSync(nextFence++);
+    }
+    GLenum APIENTRY ClientWaitSync(GLsync sync, GLbitfield, GLuint64) {
+        return signalled.count(SyncId(sync)) ? GL_ALREADY_SIGNALED : GL_TIMEOUT_EXPIRED;
+    }
+    void APIENTRY DeleteSync(GLsync) { fencesDeleted++; }
+
+    void Install() {
+        glad_glCreateBuffers = CreateBuffers;
+        glad_glNamedBufferStorage = NamedBufferStorage;
+        glad_glMapNamedBufferRange = MapNamedBufferRange;
+        glad_glUnmapNamedBuffer = UnmapNamedBuffer;
+        glad_glDeleteBuffers = DeleteBuffers;
+        glad_glFlushMappedNamedBufferRange = FlushMappedNamedBufferRange;
+        glad_glFenceSync = FenceSync;
+        glad_glClientWaitSync = ClientWaitSync;
+        glad_glDeleteSync = DeleteSync;
+    }
+
+    // The GPU finished everything up to and including this fence
+    void Signal(uintptr_t fence) { signalled.insert(fence); }
+}
+
+// ================================================================================================
+
+constexpr size_t BLOCK = 1024;
+
+static void TestNotReusedBeforeFence() {
+    GpuMemoryManager heap(4 * BLOCK);
+    long long blocks[4];
+    for (long long& offset : blocks) offset = heap.Allocate(BLOCK);
+    CHECK(blocks[0] != -1 && blocks[3] != -1);
+    CHECK_EQ(heap.Allocate(BLOCK), -1); // Full
+
+    uintptr_t fence = FakeGL::nextFence;
+    heap.Free((size_t)blocks[1], BLOCK);
+    CHECK_EQ(heap.GetRetiredBytes(), BLOCK);
+    CHECK_EQ(heap.Allocate(BLOCK), -1); // Retired, not free
+
+    // Still in flight: fenced, but not signalled
+    heap.FenceRetired();
+    heap.ReclaimCompleted();
+    CHECK_EQ(heap.Allocate(BLOCK), -1);
+    CHECK_EQ(heap.GetFragmentationRatio(), 0.0f);
+
+    // GPU done with that frame: reusable, at the same place
+    FakeGL::Signal(fence);
+    heap.ReclaimCompleted();
+    CHECK_EQ(heap.Allocate(BLOCK), blocks[1]);
+    CHECK_EQ(heap.GetRetiredBytes(), 0);
+    CHECK_EQ(heap.GetUsedMemory(), 4 * BLOCK);
+}
+
+static void TestUnfencedNeverReclaimed() {
+    GpuMemoryManager heap(2 * BLOCK);
+    long long a = heap.Allocate(BLOCK);
+    long long b = heap.Allocate(BLOCK);
+    CHECK(a != -1 && b != -1);
+
+    // Freed after the last fence: even with every fence so far signalled it has to wait for the next one
+    heap.Free((size_t)a, BLOCK);
+    for (uintptr_t f = 1; f < FakeGL::nextFence; f++) FakeGL::Signal(f);
+    heap.ReclaimCompleted();
+    CHECK_EQ(heap.Allocate(BLOCK), -1);
+
+    uintptr_t fence = FakeGL::nextFence;
+    heap.FenceRetired();
+    FakeGL::Signal(fence);
+    heap.ReclaimCompleted();
+    CHECK_EQ(heap.Allocate(BLOCK), a);
+}
+
+static void TestBucketsReclaimInOrder() {
+    GpuMemoryManager heap(4 * BLOCK);
+    long long blocks[4];
+    for (long long& offset : blocks) offset = heap.Allocate(BLOCK);
+
+    // Two frames, one range each
+    uintptr_t first = FakeGL::nextFence;
+    heap.Free((size_t)blocks[0], BLOCK);
+    heap.FenceRetired();
+    uintptr_t second = FakeGL::nextFence;
+    heap.Free((size_t)blocks[2], BLOCK);
+    heap.FenceRetired();
+    CHECK(second != first);
+    CHECK_EQ(heap.GetRetiredBytes(), 2 * BLOCK);
+
+    // Fences signal in submission order, the heap doesn't look past an unsignalled one
+    FakeGL::Signal(second);
+    heap.ReclaimCompleted();
+    CHECK_EQ(heap.Allocate(BLOCK), -1);
+
+    FakeGL::Signal(first);
+    heap.ReclaimCompleted();
+    long long x = heap.Allocate(BLOCK);
+    long long y = heap.Allocate(BLOCK);
+    CHECK_EQ(heap.GetRetiredBytes(), 0); // Counted until Allocate() takes them back
+    CHECK((x == blocks[0] && y == blocks[2]) || (x == blocks[2] && y == blocks[0]));
+}
+
+static void TestCoalesceAfterReclaim() {
+    GpuMemoryManager heap(4 * BLOCK);
+    long long blocks[4];
+    for (long long& offset : blocks) offset = heap.Allocate(BLOCK);
+
+    uintptr_t fence = FakeGL::nextFence;
+    for (long long offset : blocks) heap.Free((size_t)offset, BLOCK);
+    heap.FenceRetired();
+    FakeGL::Signal(fence);
+    heap.ReclaimCompleted();
+
+    // Back to one block: the whole heap fits in one allocation again
+    CHECK_EQ(heap.GetFragmentationRatio(), 0.0f);
+    CHECK_EQ(heap.GetFreeBlockCount(), 1);
+    CHECK_EQ(heap.GetUsedMemory(), 0);
+    CHECK_EQ(heap.Allocate(4 * BLOCK), 0);
+}
+
+static void TestFencesReleased() {
+    int created = FakeGL::fencesCreated;
+    int deleted = FakeGL::fencesDeleted;
+    {
+        GpuMemoryManager heap(2 * BLOCK);
+        long long a = heap.Allocate(BLOCK);
+        long long b = heap.Allocate(BLOCK);
+        heap.FenceRetired(); // Nothing retired: no fence
+        CHECK_EQ(FakeGL::fencesCreated, created);
+
+        uintptr_t fence = FakeGL::nextFence;
+        heap.Free((size_t)a, BLOCK);
+        heap.FenceRetired();
+        heap.Free((size_t)b, BLOCK);
+        heap.FenceRetired();
+        CHECK_EQ(FakeGL::fencesCreated, created + 2);
+
+        FakeGL::Signal(fence);
+        heap.ReclaimCompleted();
+        CHECK_EQ(FakeGL::fencesDeleted, deleted + 1);
+    }
+    // The unsignalled one goes with the heap
+    CHECK_EQ(FakeGL::fencesDeleted, deleted + 2);
+}
+
+int main() {
+    FakeGL::Install();
+    TestNotReusedBeforeFence();
+    TestUnfencedNeverReclaimed();
+    TestBucketsReclaimInOrder();
+    TestCoalesceAfterReclaim();
+    TestFencesReleased();
+    return TestResult("gpu_memory");
+}
@@ -0,0 +1,134 @@
+// Render snapshot handoff (render_snapshot.h): steps published while the consumer lags behind
+// must be appended, not dropped, with every op still pointing at its own data.
+
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+#include "render_snapshot.h"
+#include "test_common.h"
+
+// Step n: one upload of n vertices at offset n * 1000, a register and a remove for chunk n, a retired range
+static void FillStep(RenderSnapshot& snapshot, uint64_t n) {
+    std::vector<PackedVertex> vertices(n % 7 + 1);
+    snapshot.Upload((long long)n * 1000, std::move(vertices));
+    ChunkDrawRecord record;
+    record.chunkID = (int64_t)n;
+    record.vertexCountOpaque = n % 7 + 1;
+    snapshot.Register(record);
+    if (n > 1) snapshot.Remove((int64_t)n - 1);
+    snapshot.Retire((long long)n * 1000 + 500, 64);
+}
+
+// Ops of a consumed snapshot covering steps [first, last] must be exactly the steps' ops, in order
+static void CheckCovers(const RenderSnapshot& snapshot, uint64_t first, uint64_t last) {
+    CHECK(snapshot.IsConsistent());
+    CHECK_EQ(snapshot.firstStep, first);
+    CHECK_EQ(snapshot.lastStep, last);
+
+    size_t op = 0;
+    for (uint64_t n = first; n <= last; n++) {
+        CHECK(op < snapshot.ops.size() && snapshot.ops[op].type == RenderOpType::UPLOAD);
+        if (op < snapshot.ops.size()) {
+            const VramUpload& upload = snapshot.uploads[snapshot.ops[op].index];
+            CHECK_EQ(upload.offset, (long long)n * 1000);
+            CHECK_EQ(upload.vertices.size(), n % 7 + 1);
+        }
+        op++;
+        CHECK(op < snapshot.ops.size() && snapshot.ops[op].type == RenderOpType::REGISTER);
+        if (op < snapshot.ops.size()) CHECK_EQ(snapshot.records[snapshot.ops[op].index].chunkID, (int64_t)n);
+        op++;
+        if (n > 1) {
+            CHECK(op < snapshot.ops.size() && snapshot.ops[op].type == RenderOpType::REMOVE);
+            if (op < snapshot.ops.size()) CHECK_EQ(snapshot.ops[op].chunkID, (int64_t)n - 1);
+            op++;
+        }
+    }
+    CHECK_EQ(op, snapshot.ops.size());
+    CHECK_EQ(snapshot.retired.size(), last - first + 1);
+}
+
+static void TestLaggingConsumer() {
+    RenderSnapshotExchange exchange;
+    RenderSnapshot back, front;
+
+    CHECK(!exchange.Acquire(front));
+
+    // Consumer keeps up for one step, then misses three, then catches up
+    FillStep(back, 1);
+    exchange.Publish(back);
+    CHECK(back.Empty());
+    CHECK(exchange.Acquire(front));
+    CheckCovers(front, 1, 1);
+    front.Clear();
+
+    for (uint64_t n = 2; n <= 4; n++) {
+        FillStep(back, n);
+        exchange.Publish(back);
+        CHECK(back.Empty());
+    }
+    CHECK(exchange.Acquire(front));
+    CheckCovers(front, 2, 4);
+    front.Clear();
+    CHECK(!exchange.Acquire(front));
+
+    // An empty step still counts as a step
+    exchange.Publish(back);
+    CHECK(exchange.Acquire(front));
+    CHECK(front.IsConsistent());
+    CHECK_EQ(front.firstStep, 5);
+    CHECK(front.Empty());
+    front.Clear();
+
+    CHECK_EQ(exchange.GetPublishedSteps(), 5);
+    CHECK_EQ(exchange.GetConsumedSteps(), 5);
+    CHECK_EQ(exchange.GetGapCount(), 0);
+}
+
+static void TestThreadedLaggingConsumer() {
+    // Producer publishes as fast as it can, the consumer sleeps between acquires, so most acquires
+    // pick up several appended steps. Every step must show up exactly once, in order.
+    RenderSnapshotExchange exchange;
+    const uint64_t stepCount = 2000;
+    std::atomic<bool> done{ false };
+
+    std::thread producer([&]() {
+        RenderSnapshot back;
+        for (uint64_t n = 1; n <= stepCount; n++) {
+            FillStep(back, n);
+            exchange.Publish(back);
+        }
+        done = true;
+    });
+
+    RenderSnapshot front;
+    uint64_t expectedFirst = 1;
+    size_t acquires = 0, merged = 0;
+    while (true) {
+        bool finished = done.load();
+        if (exchange.Acquire(front)) {
+            CheckCovers(front, expectedFirst, front.lastStep);
+            if (front.lastStep > front.firstStep) merged++;
+            expectedFirst = front.lastStep + 1;
+            acquires++;
+            front.Clear();
+        } else if (finished) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+    producer.join();
+
+    CHECK_EQ(expectedFirst, stepCount + 1);
+    CHECK_EQ(exchange.GetConsumedSteps(), stepCount);
+    CHECK_EQ(exchange.GetGapCount(), 0);
+    CHECK(acquires > 0);
+    std::printf("  %zu acquires for %llu steps, %zu of them merged several steps\n", acquires, (unsigned long long)stepCount, merged);
+}
+
+int main() {
+    TestLaggingConsumer();
+    TestThreadedLaggingConsumer();
+    return TestResult("render_snapshot");
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdio>
+
+// ================================================================================================
+//                                      TEST HELPERS
+// Headless tests are plain executables registered with CTest (tests/CMakeLists.txt): CHECK logs
+// every failed condition and keeps going, main() returns TestResult() (non-zero on any failure).
+// ================================================================================================
+
+namespace TestState {
+    inline int failures = 0;
+}
+
+#define CHECK(cond)                                                                             \
+    do {                                                                                        \
+        if (!(cond)) {                                                                          \
+            std::fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond);      \
+            ::TestState::failures++;                                                            \
+        }                                                                                       \
+    } while (0)
+
+#define CHECK_EQ(a, b)                                                                          \
+    do {                                                                                        \
+        long long checkA = (long long)(a), checkB = (long long)(b);                             \
+        if (checkA != checkB) {                                                                 \
+            std::fprintf(stderr, "%s:%d: CHECK_EQ failed: %s == %s (%lld vs %lld)\n",           \
+                         __FILE__, __LINE__, #a, #b, checkA, checkB);                           \
+            ::TestState::failures++;                                                            \
+        }                                                                                       \
+    } while (0)
+
+inline int TestResult(const char* name) {
+    if (TestState::failures == 0) std::printf("[%s] all checks passed\n", name);
+    else std::fprintf(stderr, "[%s] %d check(s) failed\n", name, TestState::failures);
+    return TestState::failures == 0 ? 0 : 1;
+}